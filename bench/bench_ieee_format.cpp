@@ -0,0 +1,100 @@
+#include "softfloat.hpp"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Latency of the generic ieee_format<E, F> engine next to the hand-written
+ * SoftFloat routines for the same format.  Same dependency-chain method as
+ * bench_ops.c; the engine is inlined, the library calls are not.
+ *
+ * To compile:
+ * g++ -std=c++11 -O2 bench_ieee_format.cpp -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -o bench_ieee_format
+ *
+ * Usage:
+ * ./bench_ieee_format [iterations]
+ *
+ */
+
+static double now_ns()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void report(const char *name, double t0, double t1, long iters, uint64_t sink)
+{
+	printf("%-18s %8.2f ns/op   (%016llx)\n", name, (t1 - t0) / iters,
+	       (unsigned long long)sink);
+}
+
+template <typename T> static T bits(uint64_t v)
+{
+	T t;
+	t.v = v;
+	return t;
+}
+
+template <typename T, typename Op>
+static void bench_binary(const char *name, long iters, Op op, uint64_t init_a, uint64_t init_b)
+{
+	T a = bits<T>(init_a), b = bits<T>(init_b);
+	double t0 = now_ns();
+	for (long i = 0; i < iters; ++i)
+		a = op(a, b);
+	report(name, t0, now_ns(), iters, a.v);
+}
+
+template <typename T, typename Op>
+static void bench_unary(const char *name, long iters, Op op, uint64_t init_a)
+{
+	T a = bits<T>(init_a);
+	double t0 = now_ns();
+	for (long i = 0; i < iters; ++i) {
+		a = op(a);
+		a.v |= 1;
+	}
+	report(name, t0, now_ns(), iters, a.v);
+}
+
+typedef ieee_format<5, 10> ieee16;
+typedef ieee_format<8, 23> ieee32;
+typedef ieee_format<11, 52> ieee64;
+typedef ieee_format<4, 3> ieee8;
+
+int main(int argc, char **argv)
+{
+	long iters = (argc > 1) ? atol(argv[1]) : 10000000L;
+
+	printf("%ld iterations per operation\n\n", iters);
+
+	bench_binary<float16_t>("f16_add", iters, f16_add, 0x3C01, 0x1001);
+	bench_binary<ieee16>("ieee<5,10>::add", iters, ieee16::add, 0x3C01, 0x1001);
+	bench_binary<float16_t>("f16_mul", iters, f16_mul, 0x3C01, 0x3C00);
+	bench_binary<ieee16>("ieee<5,10>::mul", iters, ieee16::mul, 0x3C01, 0x3C00);
+	bench_binary<float16_t>("f16_div", iters, f16_div, 0x3C01, 0x3C00);
+	bench_binary<ieee16>("ieee<5,10>::div", iters, ieee16::div, 0x3C01, 0x3C00);
+	bench_unary<float16_t>("f16_sqrt", iters, f16_sqrt, 0x3C01);
+	bench_unary<ieee16>("ieee<5,10>::sqrt", iters, ieee16::sqrt, 0x3C01);
+
+	bench_binary<float32_t>("f32_add", iters, f32_add, 0x3F800001, 0x30000001);
+	bench_binary<ieee32>("ieee<8,23>::add", iters, ieee32::add, 0x3F800001, 0x30000001);
+	bench_binary<float32_t>("f32_mul", iters, f32_mul, 0x3F800001, 0x3F800000);
+	bench_binary<ieee32>("ieee<8,23>::mul", iters, ieee32::mul, 0x3F800001, 0x3F800000);
+
+	bench_binary<float64_t>("f64_add", iters, f64_add,
+	                        UINT64_C(0x3FF0000000000001), UINT64_C(0x3000000000000001));
+	bench_binary<ieee64>("ieee<11,52>::add", iters, ieee64::add,
+	                     UINT64_C(0x3FF0000000000001), UINT64_C(0x3000000000000001));
+	bench_binary<float64_t>("f64_mul", iters, f64_mul,
+	                        UINT64_C(0x3FF0000000000001), UINT64_C(0x3FF0000000000000));
+	bench_binary<ieee64>("ieee<11,52>::mul", iters, ieee64::mul,
+	                     UINT64_C(0x3FF0000000000001), UINT64_C(0x3FF0000000000000));
+
+	bench_binary<ieee8>("ieee<4,3>::add", iters, ieee8::add, 0x39, 0x01);
+	bench_binary<ieee8>("ieee<4,3>::mul", iters, ieee8::mul, 0x39, 0x38);
+
+	return 0;
+}
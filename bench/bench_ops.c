@@ -0,0 +1,110 @@
+#include "softfloat.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Per-operation latency benchmark for the SoftFloat library.
+ *
+ * Every operation is run as a dependency chain (the result of one call feeds
+ * the next one), so the reported figure is the latency of a single call,
+ * including the call overhead into the library.
+ *
+ * To compile:
+ * gcc -O2 bench_ops.c -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -o bench_ops
+ *
+ * Usage:
+ * ./bench_ops [iterations]
+ *
+ */
+
+static double now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void report(const char *name, double t0, double t1, long iters, uint64_t sink)
+{
+	/* 'sink' is printed to keep the chain from being optimized away */
+	printf("%-14s %8.2f ns/op   (%016llx)\n", name, (t1 - t0) / iters,
+	       (unsigned long long)sink);
+}
+
+#define BENCH_BINARY(name, type, func, init_a, init_b)                        \
+	do {                                                                  \
+		type a = { init_a }, b = { init_b };                          \
+		long i;                                                       \
+		double t0 = now_ns();                                         \
+		for (i = 0; i < iters; ++i) {                                 \
+			a = func(a, b);                                       \
+		}                                                             \
+		report(name, t0, now_ns(), iters, a.v);                       \
+	} while (0)
+
+#define BENCH_UNARY(name, type, func, init_a)                                 \
+	do {                                                                  \
+		type a = { init_a };                                          \
+		long i;                                                       \
+		double t0 = now_ns();                                         \
+		for (i = 0; i < iters; ++i) {                                 \
+			a = func(a);                                          \
+			a.v |= 1;                                             \
+		}                                                             \
+		report(name, t0, now_ns(), iters, a.v);                       \
+	} while (0)
+
+#define BENCH_CONVERT(name, from_t, to_t, func, back, init_a)                 \
+	do {                                                                  \
+		from_t a = { init_a };                                        \
+		to_t z;                                                       \
+		long i;                                                       \
+		double t0 = now_ns();                                         \
+		for (i = 0; i < iters; ++i) {                                 \
+			z = func(a);                                          \
+			a = back(z);                                          \
+		}                                                             \
+		report(name, t0, now_ns(), iters, a.v);                       \
+	} while (0)
+
+int main(int argc, char **argv)
+{
+	long iters = (argc > 1) ? atol(argv[1]) : 10000000L;
+
+	printf("%ld iterations per operation\n\n", iters);
+
+	BENCH_BINARY("f8_add", float8_t, f8_add, 0x3D, 0x05);
+	BENCH_BINARY("f8_mul", float8_t, f8_mul, 0x3D, 0x3C);
+	BENCH_BINARY("f8_div", float8_t, f8_div, 0x3D, 0x3C);
+	BENCH_UNARY("f8_sqrt", float8_t, f8_sqrt, 0x3D);
+
+	BENCH_BINARY("f16_add", float16_t, f16_add, 0x3C01, 0x1001);
+	BENCH_BINARY("f16_mul", float16_t, f16_mul, 0x3C01, 0x3C00);
+	BENCH_BINARY("f16_div", float16_t, f16_div, 0x3C01, 0x3C00);
+	BENCH_UNARY("f16_sqrt", float16_t, f16_sqrt, 0x3C01);
+
+	BENCH_BINARY("f32_add", float32_t, f32_add, 0x3F800001, 0x30000001);
+	BENCH_BINARY("f32_mul", float32_t, f32_mul, 0x3F800001, 0x3F800000);
+	BENCH_BINARY("f32_div", float32_t, f32_div, 0x3F800001, 0x3F800000);
+	BENCH_UNARY("f32_sqrt", float32_t, f32_sqrt, 0x3F800001);
+
+	BENCH_BINARY("f64_add", float64_t, f64_add,
+	             UINT64_C(0x3FF0000000000001), UINT64_C(0x3000000000000001));
+	BENCH_BINARY("f64_mul", float64_t, f64_mul,
+	             UINT64_C(0x3FF0000000000001), UINT64_C(0x3FF0000000000000));
+	BENCH_BINARY("f64_div", float64_t, f64_div,
+	             UINT64_C(0x3FF0000000000001), UINT64_C(0x3FF0000000000000));
+	BENCH_UNARY("f64_sqrt", float64_t, f64_sqrt, UINT64_C(0x3FF0000000000001));
+
+	BENCH_CONVERT("f32<->f16", float32_t, float16_t, f32_to_f16, f16_to_f32,
+	              0x3F8CCCCD);
+	BENCH_CONVERT("f32<->f8", float32_t, float8_t, f32_to_f8, f8_to_f32,
+	              0x3F8CCCCD);
+	BENCH_CONVERT("f64<->f32", float64_t, float32_t, f64_to_f32, f32_to_f64,
+	              UINT64_C(0x3FF199999999999A));
+
+	return 0;
+}
@@ -41,6 +41,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "softfloat_types.h"
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility push(hidden)
+#endif
+
 /*----------------------------------------------------------------------------
 | Default value for `softfloat_detectTininess'.
 *----------------------------------------------------------------------------*/
@@ -68,6 +72,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define i64_fromNegOverflow  (-UINT64_C( 0x7FFFFFFFFFFFFFFF ) - 1)
 #define i64_fromNaN          UINT64_C( 0x7FFFFFFFFFFFFFFF )
 
+/*----------------------------------------------------------------------------
+| The values to return on conversions to 128-bit integer formats that raise an
+| invalid exception.
+*----------------------------------------------------------------------------*/
+#define ui128_fromPosOverflow packToUI128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) )
+#define ui128_fromNegOverflow packToUI128( 0, 0 )
+#define ui128_fromNaN         packToUI128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) )
+#define i128_fromPosOverflow \
+    packToI128( UINT64_C( 0x7FFFFFFFFFFFFFFF ), ~UINT64_C( 0 ) )
+#define i128_fromNegOverflow  packToI128( UINT64_C( 0x8000000000000000 ), 0 )
+#define i128_fromNaN \
+    packToI128( UINT64_C( 0x7FFFFFFFFFFFFFFF ), ~UINT64_C( 0 ) )
+
 /*----------------------------------------------------------------------------
 | "Common NaN" structure, used to transfer NaN representations from one format
 | to another.
@@ -371,5 +388,8 @@ void
 
 #endif
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility pop
 #endif
 
+#endif
@@ -47,6 +47,10 @@ Extended for float8 by Stefan Mach, Integrated Systems Institute, ETH Zurich
 #include "primitiveTypes.h"
 #include "softfloat.h"
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility push(hidden)
+#endif
+
 /*----------------------------------------------------------------------------
 | Default value for 'softfloat_detectTininess'.
 *----------------------------------------------------------------------------*/
@@ -74,6 +78,17 @@ Extended for float8 by Stefan Mach, Integrated Systems Institute, ETH Zurich
 #define i64_fromNegOverflow  (-INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1)
 #define i64_fromNaN          (-INT64_C( 0x7FFFFFFFFFFFFFFF ) - 1)
 
+/*----------------------------------------------------------------------------
+| The values to return on conversions to 128-bit integer formats that raise an
+| invalid exception.
+*----------------------------------------------------------------------------*/
+#define ui128_fromPosOverflow packToUI128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) )
+#define ui128_fromNegOverflow packToUI128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) )
+#define ui128_fromNaN         packToUI128( ~UINT64_C( 0 ), ~UINT64_C( 0 ) )
+#define i128_fromPosOverflow  packToI128( UINT64_C( 0x8000000000000000 ), 0 )
+#define i128_fromNegOverflow  packToI128( UINT64_C( 0x8000000000000000 ), 0 )
+#define i128_fromNaN          packToI128( UINT64_C( 0x8000000000000000 ), 0 )
+
 /*----------------------------------------------------------------------------
 | "Common NaN" structure, used to transfer NaN representations from one format
 | to another.
@@ -121,6 +136,51 @@ uint_fast8_t softfloat_commonNaNToF8UI( const struct commonNaN *aPtr );
 *----------------------------------------------------------------------------*/
 uint_fast8_t softfloat_propagateNaNF8UI( uint_fast8_t uiA, uint_fast8_t uiB );
 
+/*----------------------------------------------------------------------------
+| The bit pattern for a default generated E4M3 NaN.  E4M3 has a single quiet
+| NaN per sign and no signaling NaN.
+*----------------------------------------------------------------------------*/
+#define defaultNaNE4M3UI 0xFF
+
+/*----------------------------------------------------------------------------
+| Assuming `uiA' has the bit pattern of an E4M3 NaN, converts this NaN to the
+| common NaN form, and stores the resulting common NaN at the location pointed
+| to by `zPtr'.
+*----------------------------------------------------------------------------*/
+void softfloat_e4m3UIToCommonNaN( uint_fast8_t uiA, struct commonNaN *zPtr );
+
+/*----------------------------------------------------------------------------
+| Converts the common NaN pointed to by `aPtr' into an E4M3 NaN, and returns
+| the bit pattern of this value as an unsigned integer.
+*----------------------------------------------------------------------------*/
+uint_fast8_t softfloat_commonNaNToE4M3UI( const struct commonNaN *aPtr );
+
+/*----------------------------------------------------------------------------
+| The bit pattern for a default generated bfloat16 NaN.
+*----------------------------------------------------------------------------*/
+#define defaultNaNBF16UI 0xFFC0
+
+/*----------------------------------------------------------------------------
+| Returns true when 16-bit unsigned integer `uiA' has the bit pattern of a
+| bfloat16 signaling NaN.
+| Note:  This macro evaluates its argument more than once.
+*----------------------------------------------------------------------------*/
+#define softfloat_isSigNaNBF16UI( uiA ) ((((uiA) & 0x7FC0) == 0x7F80) && ((uiA) & 0x003F))
+
+/*----------------------------------------------------------------------------
+| Assuming `uiA' has the bit pattern of a bfloat16 NaN, converts this NaN to
+| the common NaN form, and stores the resulting common NaN at the location
+| pointed to by `zPtr'.  If the NaN is a signaling NaN, the invalid exception
+| is raised.
+*----------------------------------------------------------------------------*/
+void softfloat_bf16UIToCommonNaN( uint_fast16_t uiA, struct commonNaN *zPtr );
+
+/*----------------------------------------------------------------------------
+| Converts the common NaN pointed to by `aPtr' into a bfloat16 NaN, and
+| returns the bit pattern of this value as an unsigned integer.
+*----------------------------------------------------------------------------*/
+uint_fast16_t softfloat_commonNaNToBF16UI( const struct commonNaN *aPtr );
+
 /*----------------------------------------------------------------------------
 | The bit pattern for a default generated 16-bit floating-point NaN.
 *----------------------------------------------------------------------------*/
@@ -411,5 +471,8 @@ void
 
 #endif
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility pop
 #endif
 
+#endif
@@ -0,0 +1,71 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void bf16_to_e4m3_array( const bfloat16_t *aPtr, e4m3_t *zPtr, size_t n )
+{
+    const uint16_t *table;
+    uint_fast16_t nanMask, flags, entry;
+    size_t i;
+
+    /*------------------------------------------------------------------------
+    | Table entries are decoded inline; the flags are raised once.
+    *------------------------------------------------------------------------*/
+    table = 0;
+    if ( softfloat_roundingMode == softfloat_round_near_even ) {
+        table = softfloat_tableE4M3( softfloat_opE4M3_fromBF16 );
+    }
+    if ( ! table ) {
+        for ( i = 0; i < n; ++i ) zPtr[i] = bf16_to_e4m3( aPtr[i] );
+        return;
+    }
+    nanMask = (e4m3_overflowMode == e4m3_overflow_saturate) ? 0 : 0x8000;
+    flags = 0;
+    for ( i = 0; i < n; ++i ) {
+        entry = table[aPtr[i].v];
+        flags |= entry;
+        zPtr[i].v = entry | ((entry & nanMask) ? 0x7F : 0);
+    }
+    softfloat_exceptionFlags |= (flags>>8) & 0x1F;
+
+}
+
@@ -0,0 +1,114 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void
+ bigF_div( const bigFloat_t *aPtr, const bigFloat_t *bPtr, bigFloat_t *zPtr )
+{
+    bool signZ;
+    uint_fast8_t sizeA_words, sizeB_words, sizeZ_words, sizeRem_words, i;
+    int_fast16_t extra_words;
+    uint32_t rem[2 * BIGF_MAX_WORDS + 2], sigZ[BIGF_MAX_WORDS + 2];
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signZ = aPtr->sign ^ bPtr->sign;
+    if ( (aPtr->cls == bigF_nan) || (bPtr->cls == bigF_nan) ) {
+        zPtr->cls = bigF_nan;
+        return;
+    }
+    if ( aPtr->cls == bigF_inf ) {
+        if ( bPtr->cls == bigF_inf ) goto invalid;
+        goto infinity;
+    }
+    if ( bPtr->cls == bigF_zero ) {
+        if ( aPtr->cls == bigF_zero ) goto invalid;
+        softfloat_raiseFlags( softfloat_flag_infinite );
+        goto infinity;
+    }
+    if ( (aPtr->cls == bigF_zero) || (bPtr->cls == bigF_inf) ) {
+        zPtr->sign = signZ;
+        zPtr->cls = bigF_zero;
+        return;
+    }
+    /*------------------------------------------------------------------------
+    | The dividend is extended with low zero words, and a zero top word, so
+    | that the quotient has at least one word more than the result needs.
+    *------------------------------------------------------------------------*/
+    sizeA_words = BIGF_WORDS( aPtr->prec );
+    sizeB_words = BIGF_WORDS( bPtr->prec );
+    sizeZ_words = BIGF_WORDS( zPtr->prec );
+    extra_words = sizeZ_words + 1 + sizeB_words - sizeA_words;
+    if ( extra_words < 0 ) extra_words = 0;
+    sizeRem_words = sizeA_words + extra_words + 1;
+    for ( i = 0; i < sizeRem_words; ++i ) {
+        rem[indexWord( sizeRem_words, i )] =
+            (extra_words <= i) && (i < sizeRem_words - 1)
+                ? aPtr->sig[indexWord( sizeA_words, i - extra_words )] : 0;
+    }
+    softfloat_divRemM( sizeRem_words, rem, sizeB_words, bPtr->sig, sigZ );
+    for ( i = 0; i < sizeB_words; ++i ) {
+        if ( rem[indexWord( sizeRem_words, i )] ) {
+            sigZ[indexWordLo( sizeRem_words - sizeB_words )] |= 1;
+            break;
+        }
+    }
+    softfloat_normRoundPackMToBigF(
+        signZ,
+        aPtr->exp - bPtr->exp + 31,
+        sizeRem_words - sizeB_words,
+        sigZ,
+        zPtr
+    );
+    return;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ invalid:
+    softfloat_raiseFlags( softfloat_flag_invalid );
+    zPtr->cls = bigF_nan;
+    return;
+ infinity:
+    zPtr->sign = signZ;
+    zPtr->cls = bigF_inf;
+
+}
+
@@ -0,0 +1,93 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void
+ bigF_mul( const bigFloat_t *aPtr, const bigFloat_t *bPtr, bigFloat_t *zPtr )
+{
+    bool signZ;
+    uint_fast8_t sizeA_words, sizeB_words, size_words, i;
+    uint32_t sigA[BIGF_MAX_WORDS], sigB[BIGF_MAX_WORDS];
+    uint32_t sigZ[2 * BIGF_MAX_WORDS];
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signZ = aPtr->sign ^ bPtr->sign;
+    if ( (aPtr->cls == bigF_nan) || (bPtr->cls == bigF_nan) ) {
+        zPtr->cls = bigF_nan;
+        return;
+    }
+    if ( (aPtr->cls == bigF_inf) || (bPtr->cls == bigF_inf) ) {
+        if ( (aPtr->cls == bigF_zero) || (bPtr->cls == bigF_zero) ) {
+            softfloat_raiseFlags( softfloat_flag_invalid );
+            zPtr->cls = bigF_nan;
+            return;
+        }
+        zPtr->sign = signZ;
+        zPtr->cls = bigF_inf;
+        return;
+    }
+    if ( (aPtr->cls == bigF_zero) || (bPtr->cls == bigF_zero) ) {
+        zPtr->sign = signZ;
+        zPtr->cls = bigF_zero;
+        return;
+    }
+    /*------------------------------------------------------------------------
+    | Both significands are widened to the longer one (low words zero).
+    *------------------------------------------------------------------------*/
+    sizeA_words = BIGF_WORDS( aPtr->prec );
+    sizeB_words = BIGF_WORDS( bPtr->prec );
+    size_words = (sizeA_words < sizeB_words) ? sizeB_words : sizeA_words;
+    for ( i = 1; i <= size_words; ++i ) {
+        sigA[indexWord( size_words, size_words - i )] =
+            (i <= sizeA_words)
+                ? aPtr->sig[indexWord( sizeA_words, sizeA_words - i )] : 0;
+        sigB[indexWord( size_words, size_words - i )] =
+            (i <= sizeB_words)
+                ? bPtr->sig[indexWord( sizeB_words, sizeB_words - i )] : 0;
+    }
+    softfloat_mulM( size_words, sigA, sigB, sigZ );
+    softfloat_normRoundPackMToBigF(
+        signZ, aPtr->exp + bPtr->exp + 1, 2 * size_words, sigZ, zPtr );
+
+}
+
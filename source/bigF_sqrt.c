@@ -0,0 +1,96 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void bigF_sqrt( const bigFloat_t *aPtr, bigFloat_t *zPtr )
+{
+    uint_fast8_t sizeA_words, size_words, i;
+    int32_t expA;
+    uint32_t sigA[2 * BIGF_MAX_WORDS + 2], sigZ[BIGF_MAX_WORDS + 1];
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    if ( aPtr->cls == bigF_nan ) {
+        zPtr->cls = bigF_nan;
+        return;
+    }
+    if ( aPtr->cls == bigF_zero ) {
+        zPtr->sign = aPtr->sign;
+        zPtr->cls = bigF_zero;
+        return;
+    }
+    if ( aPtr->sign ) {
+        softfloat_raiseFlags( softfloat_flag_invalid );
+        zPtr->cls = bigF_nan;
+        return;
+    }
+    if ( aPtr->cls == bigF_inf ) {
+        zPtr->sign = 0;
+        zPtr->cls = bigF_inf;
+        return;
+    }
+    /*------------------------------------------------------------------------
+    | The root has at least one word more than the result needs, and its
+    | square at least one word more than the operand.  The operand goes to
+    | the top of the square, one bit lower when its exponent is even, so that
+    | the exponent left is even.
+    *------------------------------------------------------------------------*/
+    sizeA_words = BIGF_WORDS( aPtr->prec );
+    size_words = BIGF_WORDS( zPtr->prec ) + 1;
+    if ( size_words < (sizeA_words>>1) + 1 ) size_words = (sizeA_words>>1) + 1;
+    for ( i = 1; i <= 2 * size_words; ++i ) {
+        sigA[indexWord( 2 * size_words, 2 * size_words - i )] =
+            (i <= sizeA_words)
+                ? aPtr->sig[indexWord( sizeA_words, sizeA_words - i )] : 0;
+    }
+    expA = aPtr->exp;
+    if ( ! (expA & 1) ) {
+        softfloat_shortShiftRightM( 2 * size_words, sigA, 1, sigA );
+    }
+    if ( softfloat_sqrtM( size_words, sigA, sigZ ) ) {
+        sigZ[indexWordLo( size_words )] |= 1;
+    }
+    softfloat_normRoundPackMToBigF(
+        0, (expA - (expA & 1)) / 2, size_words, sigZ, zPtr );
+
+}
+
@@ -0,0 +1,89 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+void bigF_to_extF80M( const bigFloat_t *aPtr, extFloat80_t *zPtr )
+{
+    struct extFloat80M *zSPtr;
+    uint_fast8_t size_words, i;
+    uint32_t extSig[3];
+    int32_t exp;
+
+    zSPtr = (struct extFloat80M *) zPtr;
+    switch ( aPtr->cls ) {
+     case bigF_nan:
+        zSPtr->signExp = defaultNaNExtF80UI64;
+        zSPtr->signif = defaultNaNExtF80UI0;
+        return;
+     case bigF_inf:
+        zSPtr->signExp = packToExtF80UI64( aPtr->sign, 0x7FFF );
+        zSPtr->signif = UINT64_C( 0x8000000000000000 );
+        return;
+     case bigF_zero:
+        zSPtr->signExp = packToExtF80UI64( aPtr->sign, 0 );
+        zSPtr->signif = 0;
+        return;
+    }
+    /*------------------------------------------------------------------------
+    | The top three words, the last one jammed with the others.  Exponents far
+    | out of range are clamped without changing the outcome.
+    *------------------------------------------------------------------------*/
+    size_words = BIGF_WORDS( aPtr->prec );
+    for ( i = 0; i < 3; ++i ) {
+        extSig[indexWord( 3, i )] =
+            aPtr->sig[indexWord( size_words, size_words - 3 + i )];
+    }
+    for ( i = 0; i < size_words - 3; ++i ) {
+        if ( aPtr->sig[indexWord( size_words, i )] ) {
+            extSig[indexWordLo( 3 )] |= 1;
+            break;
+        }
+    }
+    exp = aPtr->exp;
+    if ( exp < -0x10000 ) exp = -0x10000;
+    if ( 0x10000 < exp ) exp = 0x10000;
+    softfloat_roundPackMToExtF80M(
+        aPtr->sign, exp + 0x3FFF, extSig, 80, zSPtr );
+
+}
+
@@ -0,0 +1,87 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+float32_t bigF_to_f32( const bigFloat_t *aPtr )
+{
+    uint_fast8_t size_words, i;
+    uint32_t sig;
+    int32_t exp;
+    uint_fast32_t uiZ;
+    union ui32_f32 uZ;
+
+    switch ( aPtr->cls ) {
+     case bigF_nan:
+        uiZ = defaultNaNF32UI;
+        goto uiZ;
+     case bigF_inf:
+        uiZ = packToF32UI( aPtr->sign, 0xFF, 0 );
+        goto uiZ;
+     case bigF_zero:
+        uiZ = packToF32UI( aPtr->sign, 0, 0 );
+        goto uiZ;
+    }
+    /*------------------------------------------------------------------------
+    | The top word, jammed with the others, is shifted right by one bit for
+    | 'softfloat_roundPackToF32'.  Exponents far out of range are clamped
+    | without changing the outcome.
+    *------------------------------------------------------------------------*/
+    size_words = BIGF_WORDS( aPtr->prec );
+    sig = aPtr->sig[indexWordHi( size_words )];
+    sig = sig>>1 | (sig & 1);
+    for ( i = 0; i < size_words - 1; ++i ) {
+        if ( aPtr->sig[indexWord( size_words, i )] ) {
+            sig |= 1;
+            break;
+        }
+    }
+    exp = aPtr->exp;
+    if ( exp < -0x400 ) exp = -0x400;
+    if ( 0x400 < exp ) exp = 0x400;
+    return softfloat_roundPackToF32( aPtr->sign, exp + 0x7E, sig );
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
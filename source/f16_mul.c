@@ -106,8 +106,7 @@ float16_t f16_mul( float16_t a, float16_t b )
     sigA = (sigA | 0x0400)<<4;
     sigB = (sigB | 0x0400)<<5;
     sig32Z = (uint_fast32_t) sigA * sigB;
-    sigZ = sig32Z>>16;
-    if ( sig32Z & 0xFFFF ) sigZ |= 1;
+    sigZ = softfloat_shiftRightStochJam64( sig32Z, 16 );
     if ( sigZ < 0x4000 ) {
         --expZ;
         sigZ <<= 1;
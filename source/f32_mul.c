@@ -104,7 +104,7 @@ float32_t f32_mul( float32_t a, float32_t b )
     expZ = expA + expB - 0x7F;
     sigA = (sigA | 0x00800000)<<7;
     sigB = (sigB | 0x00800000)<<8;
-    sigZ = softfloat_shortShiftRightJam64( (uint_fast64_t) sigA * sigB, 32 );
+    sigZ = softfloat_shiftRightStochJam64( (uint_fast64_t) sigA * sigB, 32 );
     if ( sigZ < 0x40000000 ) {
         --expZ;
         sigZ <<= 1;
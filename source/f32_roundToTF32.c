@@ -0,0 +1,117 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+float32_t f32_roundToTF32( float32_t a )
+{
+    union ui32_f32 uA;
+    uint_fast32_t uiA, mag;
+    bool sign;
+    uint_fast8_t roundingMode;
+    uint_fast32_t roundIncrement, roundBits, uiZ;
+    struct commonNaN commonNaN;
+    union ui32_f32 uZ;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    sign = signF32UI( uiA );
+    mag = uiA & 0x7FFFFFFF;
+    if ( 0x7F800000 < mag ) {
+        softfloat_f32UIToCommonNaN( uiA, &commonNaN );
+        uiZ = softfloat_commonNaNToF32UI( &commonNaN ) & ~(uint_fast32_t) 0x1FFF;
+        goto uiZ;
+    }
+    roundBits = mag & 0x1FFF;
+    if ( ! roundBits ) return a;
+    /*------------------------------------------------------------------------
+    | TF32 keeps binary32's exponent range, subnormals included, so rounding is
+    | a fixed-point rounding of the magnitude at bit 13 for every finite value.
+    | A carry out of the fraction steps into the next binade, and one out of
+    | the largest finite value gives the infinity.
+    *------------------------------------------------------------------------*/
+    roundingMode = softfloat_roundingMode;
+    roundIncrement = 0x1000;
+    if (
+        (roundingMode != softfloat_round_near_even)
+            && (roundingMode != softfloat_round_near_maxMag)
+    ) {
+        roundIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max))
+                ? 0x1FFF
+                : 0;
+    }
+    if ( mag < 0x00800000 ) {
+        /*--------------------------------------------------------------------
+        | Tininess after rounding uses an unbounded exponent, which rounds a
+        | value just below 2^-126 at bit 12 instead of bit 13.
+        *--------------------------------------------------------------------*/
+        if (
+            (softfloat_detectTininess == softfloat_tininess_beforeRounding)
+                || (mag + (roundIncrement>>1) < 0x00800000)
+        ) {
+            softfloat_raiseFlags( softfloat_flag_underflow );
+        }
+    }
+    uiZ = (mag + roundIncrement)>>13;
+    uiZ &=
+        ~(uint_fast32_t)
+             (! (roundBits ^ 0x1000)
+                  & (roundingMode == softfloat_round_near_even));
+#ifdef SOFTFLOAT_ROUND_ODD
+    if ( roundingMode == softfloat_round_odd ) uiZ |= 1;
+#endif
+    uiZ <<= 13;
+    if ( uiZ == 0x7F800000 ) {
+        softfloat_raiseFlags( softfloat_flag_overflow );
+    }
+    softfloat_exceptionFlags |= softfloat_flag_inexact;
+    uiZ |= (uint_fast32_t) sign<<31;
+ uiZ:
+    uZ.ui = uiZ;
+    return uZ.f;
+
+}
+
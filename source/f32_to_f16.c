@@ -72,14 +72,14 @@ float16_t f32_to_f16( float32_t a )
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    frac16 = frac>>9 | ((frac & 0x1FF) != 0);
-    if ( ! (exp | frac16) ) {
+    frac16 = softfloat_shiftRightStochJam64( frac, 9 );
+    if ( ! (exp | frac) ) {
         uiZ = packToF16UI( sign, 0, 0 );
         goto uiZ;
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF16( sign, exp - 0x71, frac16 | 0x4000 );
+    return softfloat_roundPackToF16( sign, exp - 0x71, frac16 + 0x4000 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
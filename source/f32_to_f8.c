@@ -76,16 +76,17 @@ float8_t f32_to_f8( float32_t a )
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    frac8 = frac>>17 | ((frac & 0x1FFFF) != 0); /* shift that 4 rnd bits stay
-                                                   and set the sticky bit */
-    if ( ! (exp | frac8) ) { /* zero */
+    /* shift so that 4 rnd bits stay and set sticky (or round stochastic) */
+    frac8 = softfloat_shiftRightStochJam64( frac, 17 );
+    if ( ! (exp | frac) ) { /* zero */
         uiZ = packToF8UI( sign, 0, 0 );
         goto uiZ;
     }
     /*------------------------------------------------------------------------
     | Rebias: f32 bias = 0x7F, f8 bias = 0xF, add hidden bit (bias+1)
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF8( sign, exp - 0x71, frac8 | 0x40 );
+    if ( 0x90 < exp ) exp = 0x90; /* overflows f8; keeps exp in int_fast8_t */
+    return softfloat_roundPackToF8( sign, exp - 0x71, frac8 + 0x40 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
@@ -111,12 +111,16 @@ float64_t f64_mul( float64_t a, float64_t b )
     sigB = (sigB | UINT64_C( 0x0010000000000000 ))<<11;
 #ifdef SOFTFLOAT_FAST_INT64
     sig128Z = softfloat_mul64To128( sigA, sigB );
-    sigZ = sig128Z.v64 | (sig128Z.v0 != 0);
+    sigZ = softfloat_stochJam64( sig128Z.v64, sig128Z.v0 );
 #else
     softfloat_mul64To128M( sigA, sigB, sig128Z );
     sigZ =
-        (uint64_t) sig128Z[indexWord( 4, 3 )]<<32 | sig128Z[indexWord( 4, 2 )];
-    if ( sig128Z[indexWord( 4, 1 )] || sig128Z[indexWord( 4, 0 )] ) sigZ |= 1;
+        softfloat_stochJam64(
+            (uint64_t) sig128Z[indexWord( 4, 3 )]<<32
+                | sig128Z[indexWord( 4, 2 )],
+            (uint64_t) sig128Z[indexWord( 4, 1 )]<<32
+                | sig128Z[indexWord( 4, 0 )]
+        );
 #endif
     if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
         --expZ;
@@ -72,14 +72,14 @@ float16_t f64_to_f16( float64_t a )
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    frac16 = softfloat_shortShiftRightJam64( frac, 38 );
-    if ( ! (exp | frac16) ) {
+    frac16 = softfloat_shiftRightStochJam64( frac, 38 );
+    if ( ! (exp | frac) ) {
         uiZ = packToF16UI( sign, 0, 0 );
         goto uiZ;
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF16( sign, exp - 0x3F1, frac16 | 0x4000 );
+    return softfloat_roundPackToF16( sign, exp - 0x3F1, frac16 + 0x4000 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
@@ -72,14 +72,14 @@ float32_t f64_to_f32( float64_t a )
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    frac32 = softfloat_shortShiftRightJam64( frac, 22 );
-    if ( ! (exp | frac32) ) {
+    frac32 = softfloat_shiftRightStochJam64( frac, 22 );
+    if ( ! (exp | frac) ) {
         uiZ = packToF32UI( sign, 0, 0 );
         goto uiZ;
     }
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF32( sign, exp - 0x381, frac32 | 0x40000000 );
+    return softfloat_roundPackToF32( sign, exp - 0x381, frac32 + 0x40000000 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
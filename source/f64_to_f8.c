@@ -77,15 +77,15 @@ float8_t f64_to_f8( float64_t a )
     /*------------------------------------------------------------------------
     | f64 has 52 sig bits. shift to keep sig + 4 rnd bits.
     *------------------------------------------------------------------------*/
-    frac8 = softfloat_shortShiftRightJam64( frac, 46 );
-    if ( ! (exp | frac8) ) { /* zero */
+    frac8 = softfloat_shiftRightStochJam64( frac, 46 );
+    if ( ! (exp | frac) ) { /* zero */
         uiZ = packToF8UI( sign, 0, 0 );
         goto uiZ;
     }
     /*------------------------------------------------------------------------
     | Bias of f64 is 0x3FF, rebias to bias of 0xF - 1, add implicit bit.
     *------------------------------------------------------------------------*/
-    return softfloat_roundPackToF8( sign, exp - 0x3F1, frac8 | 0x40 );
+    return softfloat_roundPackToF8( sign, exp - 0x3F1, frac8 + 0x40 );
  uiZ:
     uZ.ui = uiZ;
     return uZ.f;
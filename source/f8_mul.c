@@ -110,9 +110,8 @@ float8_t f8_mul( float8_t a, float8_t b )
     sigA = (sigA | 0x04)<<4; /* put hidden bit, add 4 round bits */
     sigB = (sigB | 0x04)<<5; /* put hidden bit, add 4 round bits +1 renorm */
     sig16Z = (uint_fast16_t) sigA * sigB;
-    sigZ = sig16Z>>8;
-    if ( sig16Z & 0xFF ) sigZ |= 1; /* set sticky bit if needed */
-    if ( sigZ < 0x4000 ) { /* if there was no overflow, renormalize */
+    sigZ = softfloat_shiftRightStochJam64( sig16Z, 8 ); /* set sticky bit */
+    if ( sigZ < 0x40 ) { /* if there was no overflow, renormalize */
         --expZ;
         sigZ <<= 1; /* renormalize */
     }
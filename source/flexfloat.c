@@ -1,78 +1,38 @@
 #include "platform.h"
 #include "flexfloat.h"
+#include "flexfloat_stats.h"
+#include "flexfloat_trace.h"
 #include "math.h"
 
 //#define NDEBUG
 #include "assert.h"
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FLEXFLOAT_HAVE_AVX2
+#include <immintrin.h>
+#endif
 
 int_fast16_t flexfloat_exp(const flexfloat_t *a)
 {
-    int_fast16_t a_exp   = expF64UI(CAST_TO_INT64(a->value));
-    int_fast16_t bias    = flexfloat_bias(a->desc);
-    int_fast16_t inf_exp = flexfloat_inf_exp(a->desc);
-
-    if(a_exp == 0)
-        return 0;
-    else if(a_exp == 0x7FF)
-        return 0x7FF;
-    else
-        return (a_exp - 1023) + bias;
+    return flexfloat_expUI(CAST_TO_INT64(a->value), a->desc);
 }
 
 uint64_t flexfloat_frac(const flexfloat_t *a)
 {
-    return (CAST_TO_INT64(a->value) & UINT64_C(0x000FFFFFFFFFFFFF)) >> (52 - a->desc.frac_bits);
+    return flexfloat_fracUI(CAST_TO_INT64(a->value), a->desc);
 }
 
-
-
 uint64_t flexfloat_pack(flexfloat_desc_t desc, bool sign, int_fast16_t exp, uint64_t frac)
 {
-    int_fast16_t bias    = flexfloat_bias(desc);
-    int_fast16_t inf_exp = flexfloat_inf_exp(desc);
-
-    if(exp == 0)
-        exp = 0;
-    else if(exp == inf_exp)
-        exp = 0x7FF;
-    else 
-        exp = (exp - bias) + 1023;
-
-    return packToF64UI(sign, exp, frac << (52 - desc.frac_bits));
+    return flexfloat_packUI(desc, sign, exp, frac);
 }
 
 void flexfloat_sanitize(flexfloat_t *a)
 {
-    // frac
-    uint64_t frac = flexfloat_frac(a);
-
-    // exp
-    int_fast16_t exp = flexfloat_exp(a);
-    int_fast16_t inf_exp = flexfloat_inf_exp(a->desc);
-
-    // sign
-    bool sign = flexfloat_sign(a);
-
-    // Checks
-    if(exp < 0) // Zero
-    {
-        exp = 0;
-        frac = 0UL;
-    }
-    else if(exp == 0x7FF)
-    {
-        exp = inf_exp;
-        if(frac != 0) // NaN
-            sign = 0;
-    }
-    else if(exp >= inf_exp) // Infinity
-    {
-        exp = inf_exp;
-        frac = 0UL;
-    }
-
-    CAST_TO_INT64(a->value) = flexfloat_pack(a->desc, sign, exp, frac);
-
+    uint64_t ui = flexfloat_sanitizeUI(CAST_TO_INT64(a->value), a->desc);
+    FLEXFLOAT_STATS_VALUE_UI(a->desc, CAST_TO_INT64(a->value), ui);
+    CAST_TO_INT64(a->value) = ui;
 }
 
 // Constructors
@@ -95,7 +55,10 @@ INLINE void ff_init_float(flexfloat_t *obj, float value, flexfloat_desc_t desc)
     obj->value.v = *valptr;
     #endif
     obj->desc = desc;
+    FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_const, obj, NULL, NULL);
     flexfloat_sanitize(obj);
+    FLEXFLOAT_TRACE_COMMIT(obj);
 }
 
 INLINE void ff_init_double(flexfloat_t *obj, double value, flexfloat_desc_t desc) {
@@ -106,7 +69,10 @@ INLINE void ff_init_double(flexfloat_t *obj, double value, flexfloat_desc_t desc
     obj->value.v = *valptr;
     #endif
     obj->desc = desc;
+    FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_const, obj, NULL, NULL);
     flexfloat_sanitize(obj);
+    FLEXFLOAT_TRACE_COMMIT(obj);
 }
 
 
@@ -119,7 +85,10 @@ INLINE void ff_init_longdouble(flexfloat_t *obj, long double value, flexfloat_de
     obj->value.v = *valptr;
     #endif
     obj->desc = desc;
+    FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_const, obj, NULL, NULL);
     flexfloat_sanitize(obj);
+    FLEXFLOAT_TRACE_COMMIT(obj);
 }
 
 INLINE void ff_init_int(flexfloat_t *obj, int value, flexfloat_desc_t desc) {
@@ -131,20 +100,35 @@ INLINE void ff_init_int(flexfloat_t *obj, int value, flexfloat_desc_t desc) {
     obj->value.v = *valptr;
     #endif
     obj->desc = desc;
+    FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_const, obj, NULL, NULL);
     flexfloat_sanitize(obj);
+    FLEXFLOAT_TRACE_COMMIT(obj);
 }
 
 
 INLINE void ff_init_long(flexfloat_t *obj, long value, flexfloat_desc_t desc) {
-    #ifdef FLEXFLOAT_ON_DOUBLE  
-    obj->value = (double)value;
-    #else
-    double temp = (double)value;
-    const uint64_t *valptr = (const uint64_t *)(&temp);
-    obj->value.v = *valptr;
-    #endif
+    ff_init_i64(obj, value, desc);
+}
+
+// Through a binary64 value rounded to odd, so that integers beyond 2^53 are
+// rounded only once
+INLINE void ff_init_i64(flexfloat_t *obj, int64_t value, flexfloat_desc_t desc) {
+    CAST_TO_INT64(obj->value) = flexfloat_fromUI64((value < 0) ? -(uint64_t) value : (uint64_t) value, value < 0);
+    obj->desc = desc;
+    FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_const, obj, NULL, NULL);
+    flexfloat_sanitize(obj);
+    FLEXFLOAT_TRACE_COMMIT(obj);
+}
+
+INLINE void ff_init_ui64(flexfloat_t *obj, uint64_t value, flexfloat_desc_t desc) {
+    CAST_TO_INT64(obj->value) = flexfloat_fromUI64(value, false);
     obj->desc = desc;
+    FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_const, obj, NULL, NULL);
     flexfloat_sanitize(obj);
+    FLEXFLOAT_TRACE_COMMIT(obj);
 }
 
 
@@ -152,80 +136,162 @@ INLINE void ff_init_long(flexfloat_t *obj, long value, flexfloat_desc_t desc) {
 INLINE void ff_init_ff(flexfloat_t *obj, const flexfloat_t *source, flexfloat_desc_t desc ) {
     obj->value = source->value;
     obj->desc  = desc;
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_cast, obj, source, NULL);
     if(desc.exp_bits != source->desc.exp_bits || desc.frac_bits != source->desc.frac_bits)
+    {
+      FLEXFLOAT_STATS_OP(desc, flexfloat_op_cast);
       flexfloat_sanitize(obj);
+    }
+    FLEXFLOAT_TRACE_COMMIT(obj);
 }
 
 
 // Casts
 
 INLINE float ff_get_float(const flexfloat_t *obj) {
+    FLEXFLOAT_STATS_OP(obj->desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OUT(obj);
     return (float)(*((const double *)(&(obj->value))));
 }
 
 INLINE double ff_get_double(const flexfloat_t *obj) {
+    FLEXFLOAT_STATS_OP(obj->desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OUT(obj);
     return *((const double *)(&(obj->value)));
 }
 
 INLINE long double ff_get_longdouble(const flexfloat_t *obj) {
+    FLEXFLOAT_STATS_OP(obj->desc, flexfloat_op_cast);
+    FLEXFLOAT_TRACE_OUT(obj);
     return (long double)(*((const double *)(&(obj->value))));
 }
 
 
+INLINE int_fast32_t ff_to_i32(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact) {
+    float64_t a;
+    a.v = CAST_TO_INT64(obj->value);
+    return f64_to_i32(a, roundingMode, exact);
+}
+
+INLINE uint_fast32_t ff_to_ui32(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact) {
+    float64_t a;
+    a.v = CAST_TO_INT64(obj->value);
+    return f64_to_ui32(a, roundingMode, exact);
+}
+
+INLINE int_fast64_t ff_to_i64(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact) {
+    float64_t a;
+    a.v = CAST_TO_INT64(obj->value);
+    return f64_to_i64(a, roundingMode, exact);
+}
+
+INLINE uint_fast64_t ff_to_ui64(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact) {
+    float64_t a;
+    a.v = CAST_TO_INT64(obj->value);
+    return f64_to_ui64(a, roundingMode, exact);
+}
+
+
 // Arithmetics
 
 INLINE void ff_inverse(flexfloat_t *dest, const flexfloat_t *a) {
     assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits));
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_neg, dest, a, NULL);
     #ifdef FLEXFLOAT_ON_DOUBLE
     dest->value = - a->value;
     #else
     dest->value = f64_sub(ui64_to_f64(0L), a->value);
     #endif
+    FLEXFLOAT_TRACE_COMMIT(dest);
 }
 
 
 INLINE void ff_add(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b) {
     assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
            (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits));
-    #ifdef FLEXFLOAT_ON_DOUBLE
-    dest->value = a->value + b->value;
-    #else
-    dest->value = f64_add(a->value, b->value);
-    #endif
+    FLEXFLOAT_STATS_OP(dest->desc, flexfloat_op_add);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_add, dest, a, b);
+    CAST_TO_INT64(dest->value) = flexfloat_addF64UI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value),
+        dest->desc, softfloat_roundingMode);
     flexfloat_sanitize(dest);
+    FLEXFLOAT_TRACE_COMMIT(dest);
 }
 
 INLINE void ff_sub(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b) {   
     assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
            (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits));
-    #ifdef FLEXFLOAT_ON_DOUBLE
-    dest->value = a->value - b->value;
-    #else
-    dest->value = f64_sub(a->value, b->value);
-    #endif
+    FLEXFLOAT_STATS_OP(dest->desc, flexfloat_op_sub);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_sub, dest, a, b);
+    CAST_TO_INT64(dest->value) = flexfloat_subF64UI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value),
+        dest->desc, softfloat_roundingMode);
     flexfloat_sanitize(dest);
+    FLEXFLOAT_TRACE_COMMIT(dest);
 }
 
 INLINE void ff_mul(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b) {
     assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
            (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits));
-    #ifdef FLEXFLOAT_ON_DOUBLE
-    dest->value = a->value * b->value;
-    #else
-    dest->value = f64_mul(a->value, b->value);
-    #endif
+    FLEXFLOAT_STATS_OP(dest->desc, flexfloat_op_mul);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_mul, dest, a, b);
+    CAST_TO_INT64(dest->value) = flexfloat_mulF64UI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value),
+        dest->desc, softfloat_roundingMode);
     flexfloat_sanitize(dest);
+    FLEXFLOAT_TRACE_COMMIT(dest);
 }
 
 INLINE void ff_div(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b) {
     assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
            (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits));
-    #ifdef FLEXFLOAT_ON_DOUBLE
-    dest->value = a->value / b->value;
-    #else
-    dest->value = f64_div(a->value, b->value);
-    #endif
+    FLEXFLOAT_STATS_OP(dest->desc, flexfloat_op_div);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_div, dest, a, b);
+    CAST_TO_INT64(dest->value) = flexfloat_divF64UI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value),
+        dest->desc, softfloat_roundingMode);
     flexfloat_sanitize(dest);
+    FLEXFLOAT_TRACE_COMMIT(dest);
+}
+
+INLINE void ff_fma(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b, const flexfloat_t *c) {
+    assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
+           (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits) &&
+           (a->desc.exp_bits == c->desc.exp_bits) && (a->desc.frac_bits == c->desc.frac_bits));
+    FLEXFLOAT_STATS_OP(dest->desc, flexfloat_op_fma);
+    FLEXFLOAT_TRACE_FMA(dest, a, b, c);
+    CAST_TO_INT64(dest->value) = flexfloat_mulAddF64UI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value),
+        CAST_TO_INT64(c->value), dest->desc, softfloat_roundingMode);
+    flexfloat_sanitize(dest);
+    FLEXFLOAT_TRACE_COMMIT(dest);
+}
+
+INLINE void ff_sqrt(flexfloat_t *dest, const flexfloat_t *a) {
+    assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits));
+    FLEXFLOAT_STATS_OP(dest->desc, flexfloat_op_sqrt);
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_sqrt, dest, a, NULL);
+    CAST_TO_INT64(dest->value) = flexfloat_sqrtF64UI(CAST_TO_INT64(a->value), dest->desc, softfloat_roundingMode);
+    flexfloat_sanitize(dest);
+    FLEXFLOAT_TRACE_COMMIT(dest);
+}
+
+INLINE void ff_min(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b) {
+    assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
+           (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits));
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_min, dest, a, b);
+    CAST_TO_INT64(dest->value) = flexfloat_minMaxUI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value), false);
+    FLEXFLOAT_TRACE_COMMIT(dest);
+}
+
+INLINE void ff_max(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b) {
+    assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits) &&
+           (a->desc.exp_bits == b->desc.exp_bits) && (a->desc.frac_bits == b->desc.frac_bits));
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_max, dest, a, b);
+    CAST_TO_INT64(dest->value) = flexfloat_minMaxUI(CAST_TO_INT64(a->value), CAST_TO_INT64(b->value), true);
+    FLEXFLOAT_TRACE_COMMIT(dest);
+}
+
+INLINE void ff_abs(flexfloat_t *dest, const flexfloat_t *a) {
+    assert((dest->desc.exp_bits == a->desc.exp_bits) && (dest->desc.frac_bits == a->desc.frac_bits));
+    FLEXFLOAT_TRACE_OP(flexfloat_trace_abs, dest, a, NULL);
+    CAST_TO_INT64(dest->value) = CAST_TO_INT64(a->value) & INT64_C(0x7FFFFFFFFFFFFFFF);
+    FLEXFLOAT_TRACE_COMMIT(dest);
 }
 
 // Relational operators
@@ -283,3 +349,272 @@ INLINE bool ff_gt(const flexfloat_t *a, const flexfloat_t *b) {
     return f64_gt(a->value, b->value);
     #endif
 }
+
+
+// Array operations
+
+// Elements processed per pass by the array functions
+#define FF_ARRAY_CHUNK 256
+
+static void ff_round_array_scalar(double *data, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    size_t i;
+    uint64_t ui;
+
+    for(i = 0; i < n; ++i)
+    {
+        memcpy(&ui, &data[i], sizeof(ui));
+        ui = flexfloat_roundUI(ui, desc, roundingMode);
+        memcpy(&data[i], &ui, sizeof(ui));
+    }
+}
+
+#ifdef FLEXFLOAT_HAVE_AVX2
+
+// Four lanes of flexfloat_roundUI; see there for the algorithm.
+__attribute__((target("avx2")))
+static void ff_round_array_avx2(double *data, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    const int_fast16_t shift = 52 - desc.frac_bits;
+    const int_fast16_t emin = 1024 - flexfloat_bias(desc);
+    const int_fast16_t emax = 1023 + flexfloat_bias(desc);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i signBit = _mm256_set1_epi64x((long long) UINT64_C(0x8000000000000000));
+    const __m256i expMax = _mm256_set1_epi64x(0x7FF);
+    const __m256i fracMask = _mm256_set1_epi64x((long long) UINT64_C(0x000FFFFFFFFFFFFF));
+    const __m256i implicit = _mm256_set1_epi64x((long long) UINT64_C(0x0010000000000000));
+    const __m256i keepNaN = _mm256_set1_epi64x((long long) ~((UINT64_C(1) << shift) - 1));
+    const __m256i quietNaN = _mm256_set1_epi64x((long long) UINT64_C(0x7FF8000000000000));
+    const __m256i infinity = _mm256_set1_epi64x((long long) UINT64_C(0x7FF0000000000000));
+    const __m256i maxFinite = _mm256_set1_epi64x((long long) (((uint64_t) emax << 52)
+        | (UINT64_C(0x000FFFFFFFFFFFFF) & ~((UINT64_C(1) << shift) - 1))));
+    const __m256i minSub = _mm256_set1_epi64x((long long) ((uint64_t) (emin - desc.frac_bits) << 52));
+    const __m256i vShift = _mm256_set1_epi64x(shift);
+    const __m256i vEmin = _mm256_set1_epi64x(emin);
+    const __m256i v52 = _mm256_set1_epi64x(52);
+    const __m256i v63 = _mm256_set1_epi64x(63);
+    const __m256i normMask = _mm256_set1_epi64x((long long) ((UINT64_C(1) << shift) - 1));
+    const __m256i normHalf = _mm256_set1_epi64x((long long) (((UINT64_C(1) << shift) - 1) >> 1));
+    const __m256i vEminM1 = _mm256_set1_epi64x(emin - 1);
+    const bool odd = (roundingMode == softfloat_round_odd);
+    const bool nearEven = (roundingMode == softfloat_round_near_even) && shift;
+    size_t i;
+
+    for(i = 0; i + 4 <= n; i += 4)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *) &data[i]);
+        __m256i sign = _mm256_and_si256(a, signBit);
+        __m256i neg = _mm256_cmpgt_epi64(zero, a);
+        __m256i mag = _mm256_xor_si256(a, sign);
+        __m256i exp = _mm256_srli_epi64(mag, 52);
+        __m256i expZero = _mm256_cmpeq_epi64(exp, zero);
+        __m256i dist, mask, inc, lsb, sig, up, tiny, big, toInf, res, special, nan;
+
+        // Common case: four finite normals, round to nearest even
+        if(nearEven)
+        {
+            __m256i normal = _mm256_andnot_si256(_mm256_cmpeq_epi64(exp, expMax), _mm256_cmpgt_epi64(exp, vEminM1));
+            if(_mm256_movemask_pd(_mm256_castsi256_pd(normal)) == 0xF)
+            {
+                lsb = _mm256_and_si256(_mm256_srli_epi64(mag, shift), one);
+                res = _mm256_andnot_si256(normMask, _mm256_add_epi64(mag, _mm256_add_epi64(normHalf, lsb)));
+                res = _mm256_blendv_epi8(res, infinity, _mm256_cmpgt_epi64(res, maxFinite));
+                _mm256_storeu_si256((__m256i *) &data[i], _mm256_or_si256(res, sign));
+                continue;
+            }
+        }
+
+        // dist = shift + max(0, emin - max(exp, 1)), at most 63
+        dist = _mm256_sub_epi64(vEmin, _mm256_sub_epi64(exp, expZero));
+        dist = _mm256_and_si256(dist, _mm256_cmpgt_epi64(dist, zero));
+        dist = _mm256_add_epi64(dist, vShift);
+        dist = _mm256_blendv_epi8(dist, v63, _mm256_cmpgt_epi64(dist, v63));
+        mask = _mm256_sub_epi64(_mm256_sllv_epi64(one, dist), one);
+        // Significand with the implicit bit, whose bit 'dist' is the last kept one
+        sig = _mm256_blendv_epi8(_mm256_or_si256(_mm256_and_si256(mag, fracMask), implicit), mag, expZero);
+
+        switch(roundingMode)
+        {
+            case softfloat_round_near_even:
+                lsb = _mm256_and_si256(_mm256_srlv_epi64(sig, dist), one);
+                lsb = _mm256_andnot_si256(_mm256_cmpeq_epi64(mask, zero), lsb);
+                inc = _mm256_add_epi64(_mm256_srli_epi64(mask, 1), lsb);
+                break;
+            case softfloat_round_near_maxMag:
+                inc = _mm256_srli_epi64(_mm256_add_epi64(mask, one), 1);
+                break;
+            case softfloat_round_min:
+                inc = _mm256_and_si256(mask, neg);
+                break;
+            case softfloat_round_max:
+                inc = _mm256_andnot_si256(neg, mask);
+                break;
+            default:
+                inc = zero;
+                break;
+        }
+
+        // Below the smallest subnormal: zero or that subnormal
+        up = _mm256_srlv_epi64(_mm256_add_epi64(sig, inc), dist);
+        if(odd)
+            up = _mm256_or_si256(up, sig);
+        up = _mm256_cmpeq_epi64(up, zero);
+        tiny = _mm256_andnot_si256(up, minSub);
+
+        // Normal and subnormal range
+        if(odd)
+        {
+            __m256i jam = _mm256_andnot_si256(_mm256_cmpeq_epi64(_mm256_and_si256(mag, mask), zero),
+                _mm256_or_si256(_mm256_cmpgt_epi64(v52, dist), expZero));
+            mag = _mm256_or_si256(mag, _mm256_and_si256(jam, _mm256_add_epi64(mask, one)));
+        }
+        res = _mm256_andnot_si256(mask, _mm256_add_epi64(mag, inc));
+        big = _mm256_cmpgt_epi64(res, maxFinite);
+        switch(roundingMode)
+        {
+            case softfloat_round_near_even:
+            case softfloat_round_near_maxMag:
+                toInf = big;
+                break;
+            case softfloat_round_min:
+                toInf = _mm256_and_si256(big, neg);
+                break;
+            case softfloat_round_max:
+                toInf = _mm256_andnot_si256(neg, big);
+                break;
+            default:
+                toInf = zero;
+                break;
+        }
+        res = _mm256_blendv_epi8(res, maxFinite, big);
+        res = _mm256_blendv_epi8(res, infinity, toInf);
+        res = _mm256_blendv_epi8(res, tiny, _mm256_cmpgt_epi64(dist, v52));
+        res = _mm256_or_si256(res, sign);
+
+        // Infinities pass through, NaNs become the positive quiet NaN
+        special = _mm256_cmpeq_epi64(exp, expMax);
+        nan = _mm256_andnot_si256(_mm256_cmpeq_epi64(_mm256_and_si256(a, fracMask), zero), special);
+        res = _mm256_blendv_epi8(res, a, special);
+        res = _mm256_blendv_epi8(res, _mm256_or_si256(quietNaN, _mm256_andnot_si256(signBit, _mm256_and_si256(a, keepNaN))), nan);
+
+        _mm256_storeu_si256((__m256i *) &data[i], res);
+    }
+
+    ff_round_array_scalar(data + i, n - i, desc, roundingMode);
+}
+
+#endif
+
+typedef void (*ff_round_array_fn)(double *data, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+
+static ff_round_array_fn ff_round_array_select(void)
+{
+#ifdef FLEXFLOAT_HAVE_AVX2
+    if(__builtin_cpu_supports("avx2"))
+        return ff_round_array_avx2;
+#endif
+    return ff_round_array_scalar;
+}
+
+void ff_round_array(double *data, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    ff_round_array_select()(data, n, desc, roundingMode);
+}
+
+void ff_convert_array(double *dest, const double *src, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    const ff_round_array_fn round = ff_round_array_select();
+    size_t i, m;
+
+    assert((desc.exp_bits <= 11) && (desc.frac_bits <= 52));
+    for(i = 0; i < n; i += m)
+    {
+        m = (n - i < FF_ARRAY_CHUNK) ? n - i : FF_ARRAY_CHUNK;
+        if(dest != src)
+            memmove(dest + i, src + i, m * sizeof(double));
+        round(dest + i, m, desc, roundingMode);
+    }
+}
+
+// Binary64 result of the element-wise functions, rounded to odd as in ff_add
+// and friends so that one rounding to 'desc' completes it
+#define FF_ARRAY_OP(name, kernel) \
+static inline double name(double x, double y, flexfloat_desc_t desc, uint_fast8_t roundingMode) \
+{ \
+    return flexfloat_toDoubleUI(kernel(flexfloat_fromDoubleUI(x), flexfloat_fromDoubleUI(y), desc, roundingMode)); \
+}
+
+FF_ARRAY_OP(ff_array_add, flexfloat_addF64UI)
+FF_ARRAY_OP(ff_array_sub, flexfloat_subF64UI)
+FF_ARRAY_OP(ff_array_mul, flexfloat_mulF64UI)
+FF_ARRAY_OP(ff_array_div, flexfloat_divF64UI)
+
+// dest[i] = a[i] op b[i]: the binary64 results of a chunk are computed in one
+// loop and rounded while the chunk is still in cache
+#define FF_ARRAY_BINARY(name, op) \
+void name(double *dest, const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode) \
+{ \
+    const ff_round_array_fn round = ff_round_array_select(); \
+    size_t i, j, m; \
+ \
+    assert((desc.exp_bits <= 11) && (desc.frac_bits <= 52)); \
+    for(i = 0; i < n; i += m) \
+    { \
+        m = (n - i < FF_ARRAY_CHUNK) ? n - i : FF_ARRAY_CHUNK; \
+        for(j = i; j < i + m; ++j) \
+            dest[j] = op(a[j], b[j], desc, roundingMode); \
+        round(dest + i, m, desc, roundingMode); \
+    } \
+}
+
+FF_ARRAY_BINARY(ff_add_array, ff_array_add)
+FF_ARRAY_BINARY(ff_sub_array, ff_array_sub)
+FF_ARRAY_BINARY(ff_mul_array, ff_array_mul)
+FF_ARRAY_BINARY(ff_div_array, ff_array_div)
+
+void ff_fma_array(double *dest, const double *a, const double *b, const double *c, size_t n,
+    flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    size_t i;
+    uint64_t ui;
+
+    assert((desc.exp_bits <= 11) && (desc.frac_bits <= 52));
+    for(i = 0; i < n; ++i)
+    {
+        ui = flexfloat_mulAddF64UI(flexfloat_fromDoubleUI(a[i]), flexfloat_fromDoubleUI(b[i]),
+            flexfloat_fromDoubleUI(c[i]), desc, roundingMode);
+        dest[i] = flexfloat_toDoubleUI(flexfloat_roundUI(ui, desc, roundingMode));
+    }
+}
+
+// Rounded running sum of 'data', starting from 'acc'
+static double ff_array_accumulate(double acc, const double *data, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    size_t i;
+
+    for(i = 0; i < n; ++i)
+        acc = flexfloat_toDoubleUI(flexfloat_roundUI(flexfloat_fromDoubleUI(ff_array_add(acc, data[i], desc, roundingMode)), desc, roundingMode));
+    return acc;
+}
+
+double ff_sum(const double *a, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    assert((desc.exp_bits <= 11) && (desc.frac_bits <= 52));
+    return ff_array_accumulate(0.0, a, n, desc, roundingMode);
+}
+
+double ff_dot(const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    double products[FF_ARRAY_CHUNK];
+    double acc = 0.0;
+    size_t i, m;
+
+    for(i = 0; i < n; i += m)
+    {
+        m = (n - i < FF_ARRAY_CHUNK) ? n - i : FF_ARRAY_CHUNK;
+        ff_mul_array(products, a + i, b + i, m, desc, roundingMode);
+        acc = ff_array_accumulate(acc, products, m, desc, roundingMode);
+    }
+    return acc;
+}
@@ -0,0 +1,250 @@
+#include "platform.h"
+#include "flexfloat_stats.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FLEXFLOAT_STATS_TLS __thread
+#elif defined(_MSC_VER)
+#define FLEXFLOAT_STATS_TLS __declspec(thread)
+#else
+#define FLEXFLOAT_STATS_TLS _Thread_local
+#endif
+
+// Formats covered: exp_bits up to 15, frac_bits up to 112 (flexfloat.hpp)
+#define STATS_MAX_EXP 16
+#define STATS_MAX_FRAC 113
+
+typedef struct {
+    flexfloat_stats_t c;
+    uint64_t *hist; // 1 << exp_bits bins
+} stats_entry_t;
+
+// One table per thread, linked into a global list so a report can merge them.
+// Tables are never freed: counts of finished threads stay in the report.
+typedef struct stats_table {
+    struct stats_table *next;
+    stats_entry_t *entry[STATS_MAX_EXP][STATS_MAX_FRAC];
+} stats_table_t;
+
+static stats_table_t *stats_tables;
+static FLEXFLOAT_STATS_TLS stats_table_t *stats_local;
+
+static stats_table_t *stats_table(void)
+{
+    stats_table_t *t = stats_local;
+
+    if(!t)
+    {
+        t = (stats_table_t *) calloc(1, sizeof(stats_table_t));
+        if(!t)
+            return NULL;
+        t->next = __atomic_load_n(&stats_tables, __ATOMIC_ACQUIRE);
+        while(!__atomic_compare_exchange_n(&stats_tables, &t->next, t, true, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE))
+            ;
+        stats_local = t;
+    }
+    return t;
+}
+
+static stats_entry_t *stats_entry(flexfloat_desc_t desc)
+{
+    stats_table_t *t;
+    stats_entry_t *e;
+
+    if((desc.exp_bits < 2) || (desc.exp_bits >= STATS_MAX_EXP)
+        || (desc.frac_bits < 1) || (desc.frac_bits >= STATS_MAX_FRAC))
+        return NULL;
+    t = stats_table();
+    if(!t)
+        return NULL;
+    e = t->entry[desc.exp_bits][desc.frac_bits];
+    if(!e)
+    {
+        e = (stats_entry_t *) calloc(1, sizeof(stats_entry_t));
+        if(!e)
+            return NULL;
+        e->hist = (uint64_t *) calloc((size_t) 1 << desc.exp_bits, sizeof(uint64_t));
+        if(!e->hist)
+        {
+            free(e);
+            return NULL;
+        }
+        // Published last: a concurrent report only sees complete entries
+        __atomic_store_n(&t->entry[desc.exp_bits][desc.frac_bits], e, __ATOMIC_RELEASE);
+    }
+    return e;
+}
+
+void flexfloat_stats_op(flexfloat_desc_t desc, int op)
+{
+    stats_entry_t *e = stats_entry(desc);
+
+    if(e && (op >= 0) && (op < flexfloat_op_count))
+        e->c.ops[op]++;
+}
+
+void flexfloat_stats_value(flexfloat_desc_t desc, int_fast32_t exp, uint_fast8_t flags)
+{
+    stats_entry_t *e = stats_entry(desc);
+
+    if(!e)
+        return;
+    e->c.values++;
+    if((exp >= 0) && (exp < flexfloat_inf_exp(desc) + 1))
+        e->hist[exp]++;
+    if(flags & flexfloat_stats_overflow)
+        e->c.overflow++;
+    if(flags & flexfloat_stats_underflow)
+        e->c.underflow++;
+    if(flags & flexfloat_stats_inexact)
+        e->c.inexact++;
+}
+
+// Sum of the counters of all threads; false if the format was never seen
+static bool stats_merge(int exp_bits, int frac_bits, flexfloat_stats_t *stats, uint64_t *bins, size_t n)
+{
+    stats_table_t *t;
+    bool seen = false;
+    size_t i;
+    int k;
+
+    memset(stats, 0, sizeof(*stats));
+    if(bins)
+        memset(bins, 0, n * sizeof(uint64_t));
+    for(t = __atomic_load_n(&stats_tables, __ATOMIC_ACQUIRE); t; t = t->next)
+    {
+        stats_entry_t *e = __atomic_load_n(&t->entry[exp_bits][frac_bits], __ATOMIC_ACQUIRE);
+        if(!e)
+            continue;
+        seen = true;
+        for(k = 0; k < flexfloat_op_count; ++k)
+            stats->ops[k] += e->c.ops[k];
+        stats->values += e->c.values;
+        stats->overflow += e->c.overflow;
+        stats->underflow += e->c.underflow;
+        stats->inexact += e->c.inexact;
+        if(bins)
+            for(i = 0; i < n; ++i)
+                bins[i] += e->hist[i];
+    }
+    return seen;
+}
+
+bool flexfloat_stats_get(flexfloat_desc_t desc, flexfloat_stats_t *stats)
+{
+    if((desc.exp_bits < 2) || (desc.exp_bits >= STATS_MAX_EXP)
+        || (desc.frac_bits < 1) || (desc.frac_bits >= STATS_MAX_FRAC))
+    {
+        memset(stats, 0, sizeof(*stats));
+        return false;
+    }
+    return stats_merge(desc.exp_bits, desc.frac_bits, stats, NULL, 0);
+}
+
+size_t flexfloat_stats_histogram(flexfloat_desc_t desc, uint64_t *bins, size_t n)
+{
+    flexfloat_stats_t stats;
+    size_t size;
+
+    if((desc.exp_bits < 2) || (desc.exp_bits >= STATS_MAX_EXP)
+        || (desc.frac_bits < 1) || (desc.frac_bits >= STATS_MAX_FRAC))
+        return 0;
+    size = (size_t) 1 << desc.exp_bits;
+    stats_merge(desc.exp_bits, desc.frac_bits, &stats, bins, (n < size) ? n : size);
+    return size;
+}
+
+void flexfloat_stats_reset(void)
+{
+    stats_table_t *t;
+    int i, j;
+
+    for(t = __atomic_load_n(&stats_tables, __ATOMIC_ACQUIRE); t; t = t->next)
+        for(i = 0; i < STATS_MAX_EXP; ++i)
+            for(j = 0; j < STATS_MAX_FRAC; ++j)
+            {
+                stats_entry_t *e = t->entry[i][j];
+                if(!e)
+                    continue;
+                memset(&e->c, 0, sizeof(e->c));
+                memset(e->hist, 0, ((size_t) 1 << i) * sizeof(uint64_t));
+            }
+}
+
+static const char *const stats_op_names[flexfloat_op_count] = { "add", "sub", "mul", "div", "fma", "sqrt", "cast" };
+
+// Calls 'dump' for every format seen, in (exp_bits, frac_bits) order
+static void stats_foreach(FILE *fp, void (*dump)(FILE *, int, int, const flexfloat_stats_t *, const uint64_t *, bool))
+{
+    uint64_t *bins = (uint64_t *) malloc(((size_t) 1 << (STATS_MAX_EXP - 1)) * sizeof(uint64_t));
+    flexfloat_stats_t stats;
+    bool first = true;
+    int i, j;
+
+    if(!bins)
+        return;
+    for(i = 2; i < STATS_MAX_EXP; ++i)
+        for(j = 1; j < STATS_MAX_FRAC; ++j)
+            if(stats_merge(i, j, &stats, bins, (size_t) 1 << i))
+            {
+                dump(fp, i, j, &stats, bins, first);
+                first = false;
+            }
+    free(bins);
+}
+
+static void stats_dump_text(FILE *fp, int exp_bits, int frac_bits, const flexfloat_stats_t *s, const uint64_t *bins, bool first)
+{
+    int bias = (1 << (exp_bits - 1)) - 1;
+    int k, col = 0;
+
+    (void) first;
+    fprintf(fp, "flexfloat<%d, %d>:", exp_bits, frac_bits);
+    for(k = 0; k < flexfloat_op_count; ++k)
+        fprintf(fp, " %s %llu", stats_op_names[k], (unsigned long long) s->ops[k]);
+    fprintf(fp, "\n  values %llu  overflow %llu  underflow %llu  inexact %llu\n",
+        (unsigned long long) s->values, (unsigned long long) s->overflow,
+        (unsigned long long) s->underflow, (unsigned long long) s->inexact);
+    fprintf(fp, "  exponents (biased, bias %d):", bias);
+    for(k = 0; k < (1 << exp_bits); ++k)
+        if(bins[k])
+        {
+            fprintf(fp, "%s %d: %llu", (col++ % 8) ? "" : "\n   ", k, (unsigned long long) bins[k]);
+        }
+    fprintf(fp, "\n");
+}
+
+static void stats_dump_json(FILE *fp, int exp_bits, int frac_bits, const flexfloat_stats_t *s, const uint64_t *bins, bool first)
+{
+    bool firstBin = true;
+    int k;
+
+    fprintf(fp, "%s\n    {\"exp_bits\": %d, \"frac_bits\": %d", first ? "" : ",", exp_bits, frac_bits);
+    for(k = 0; k < flexfloat_op_count; ++k)
+        fprintf(fp, ", \"%s\": %llu", stats_op_names[k], (unsigned long long) s->ops[k]);
+    fprintf(fp, ", \"values\": %llu, \"overflow\": %llu, \"underflow\": %llu, \"inexact\": %llu",
+        (unsigned long long) s->values, (unsigned long long) s->overflow,
+        (unsigned long long) s->underflow, (unsigned long long) s->inexact);
+    fprintf(fp, ", \"bias\": %d, \"exp_histogram\": {", (1 << (exp_bits - 1)) - 1);
+    for(k = 0; k < (1 << exp_bits); ++k)
+        if(bins[k])
+        {
+            fprintf(fp, "%s\"%d\": %llu", firstBin ? "" : ", ", k, (unsigned long long) bins[k]);
+            firstBin = false;
+        }
+    fprintf(fp, "}}");
+}
+
+void flexfloat_stats_report(FILE *fp)
+{
+    stats_foreach(fp, stats_dump_text);
+}
+
+void flexfloat_stats_report_json(FILE *fp)
+{
+    fprintf(fp, "{\"flexfloat_stats\": [");
+    stats_foreach(fp, stats_dump_json);
+    fprintf(fp, "\n]}\n");
+}
@@ -0,0 +1,595 @@
+#include "platform.h"
+#include "flexfloat_trace.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FLEXFLOAT_TRACE_TLS __thread
+#elif defined(_MSC_VER)
+#define FLEXFLOAT_TRACE_TLS __declspec(thread)
+#else
+#define FLEXFLOAT_TRACE_TLS _Thread_local
+#endif
+
+#define TRACE_NONE UINT32_MAX
+
+// Configurations evaluated together by the replay; bounds its working set
+#define TRACE_LANES 64
+
+// Recording: what each flexfloat_t object last received
+typedef struct {
+    const flexfloat_t *key;
+    uint64_t bits;  // value stored by node; the object was overwritten if it differs
+    uint32_t node;
+    uint32_t var;
+} trace_entry_t;
+
+struct flexfloat_trace {
+    // Nodes, one array per field. Once the trace is finished, the operands
+    // a, b and c address the working set of the replay (except for constants
+    // and outputs) and dst is where the node stores its result.
+    size_t n, cap;
+    uint8_t *op;
+    uint32_t *var, *a, *b, *c, *dst;
+
+    double *consts;
+    size_t nconsts, constsCap;
+
+    flexfloat_desc_t *desc;
+    char **name;
+    size_t nvars, varsCap;
+
+    size_t outputs;
+    size_t slots;
+    bool failed, finished;
+
+    // Recording state
+    trace_entry_t *map;
+    size_t mapCap, mapUsed;
+    uint32_t pending;
+};
+
+static FLEXFLOAT_TRACE_TLS flexfloat_trace_t *trace_rec;
+
+static bool trace_resize(void **p, size_t cap, size_t size)
+{
+    void *q = realloc(*p, cap * size);
+    if(!q)
+        return false;
+    *p = q;
+    return true;
+}
+
+static uint64_t trace_bits(const flexfloat_t *obj)
+{
+    uint64_t ui;
+    memcpy(&ui, &obj->value, sizeof(ui));
+    return ui;
+}
+
+static size_t trace_hash(const flexfloat_t *key, size_t cap)
+{
+    uint64_t h = (uint64_t) (uintptr_t) key * UINT64_C(0x9E3779B97F4A7C15);
+    return (size_t) (h >> 32) & (cap - 1);
+}
+
+// Entry of 'key', created empty if needed; NULL if out of memory
+static trace_entry_t *trace_entry(flexfloat_trace_t *t, const flexfloat_t *key)
+{
+    size_t i;
+
+    if(2 * (t->mapUsed + 1) > t->mapCap)
+    {
+        size_t cap = t->mapCap ? 2 * t->mapCap : 1024;
+        trace_entry_t *map = (trace_entry_t *) calloc(cap, sizeof(trace_entry_t));
+        if(!map)
+            return NULL;
+        for(i = 0; i < t->mapCap; ++i)
+            if(t->map[i].key)
+            {
+                size_t j = trace_hash(t->map[i].key, cap);
+                while(map[j].key)
+                    j = (j + 1) & (cap - 1);
+                map[j] = t->map[i];
+            }
+        free(t->map);
+        t->map = map;
+        t->mapCap = cap;
+    }
+    for(i = trace_hash(key, t->mapCap); t->map[i].key; i = (i + 1) & (t->mapCap - 1))
+        if(t->map[i].key == key)
+            return &t->map[i];
+    t->map[i].key = key;
+    t->map[i].node = TRACE_NONE;
+    t->map[i].var = TRACE_NONE;
+    t->mapUsed++;
+    return &t->map[i];
+}
+
+static uint32_t trace_new_var(flexfloat_trace_t *t, flexfloat_desc_t desc, const char *name)
+{
+    char *copy = NULL;
+
+    if(t->nvars == t->varsCap)
+    {
+        size_t cap = t->varsCap ? 2 * t->varsCap : 16;
+        if(!trace_resize((void **) &t->desc, cap, sizeof(flexfloat_desc_t))
+            || !trace_resize((void **) &t->name, cap, sizeof(char *)))
+            return TRACE_NONE;
+        t->varsCap = cap;
+    }
+    if(name)
+    {
+        copy = (char *) malloc(strlen(name) + 1);
+        if(!copy)
+            return TRACE_NONE;
+        strcpy(copy, name);
+    }
+    t->desc[t->nvars] = desc;
+    t->name[t->nvars] = copy;
+    return (uint32_t) t->nvars++;
+}
+
+static uint32_t trace_push(flexfloat_trace_t *t, int op, uint32_t var, uint32_t a, uint32_t b, uint32_t c)
+{
+    if(t->n >= TRACE_NONE)
+        return TRACE_NONE;
+    if(t->n == t->cap)
+    {
+        size_t cap = t->cap ? 2 * t->cap : 1024;
+        if(!trace_resize((void **) &t->op, cap, sizeof(uint8_t))
+            || !trace_resize((void **) &t->var, cap, sizeof(uint32_t))
+            || !trace_resize((void **) &t->a, cap, sizeof(uint32_t))
+            || !trace_resize((void **) &t->b, cap, sizeof(uint32_t))
+            || !trace_resize((void **) &t->c, cap, sizeof(uint32_t)))
+            return TRACE_NONE;
+        t->cap = cap;
+    }
+    t->op[t->n] = (uint8_t) op;
+    t->var[t->n] = var;
+    t->a[t->n] = a;
+    t->b[t->n] = b;
+    t->c[t->n] = c;
+    return (uint32_t) t->n++;
+}
+
+static uint32_t trace_const(flexfloat_trace_t *t, uint32_t var, const flexfloat_t *obj)
+{
+    if(t->nconsts == t->constsCap)
+    {
+        size_t cap = t->constsCap ? 2 * t->constsCap : 256;
+        if(!trace_resize((void **) &t->consts, cap, sizeof(double)))
+            return TRACE_NONE;
+        t->constsCap = cap;
+    }
+    memcpy(&t->consts[t->nconsts], &obj->value, sizeof(double));
+    return trace_push(t, flexfloat_trace_const, var, (uint32_t) t->nconsts++, 0, 0);
+}
+
+// Variable of the object behind 'e', created if it has none. A variable
+// takes the format of the first value stored in it.
+static uint32_t trace_var(flexfloat_trace_t *t, trace_entry_t *e, flexfloat_desc_t desc)
+{
+    if(e->var == TRACE_NONE)
+        e->var = trace_new_var(t, desc, NULL);
+    else if(!t->desc[e->var].exp_bits)
+        t->desc[e->var] = desc;
+    return e->var;
+}
+
+// Node holding the current value of 'obj'. Values that were not produced
+// by a recorded call (written before the recording or by hand) enter the
+// trace as constants.
+static uint32_t trace_operand(flexfloat_trace_t *t, const flexfloat_t *obj)
+{
+    trace_entry_t *e = trace_entry(t, obj);
+    uint64_t bits = trace_bits(obj);
+    uint32_t var, node;
+
+    if(!e)
+        return TRACE_NONE;
+    if((e->node != TRACE_NONE) && (e->bits == bits))
+        return e->node;
+    var = trace_var(t, e, obj->desc);
+    if(var == TRACE_NONE)
+        return TRACE_NONE;
+    node = trace_const(t, var, obj);
+    e->node = node;
+    e->bits = bits;
+    return node;
+}
+
+void flexfloat_trace_op(int op, const flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b, const flexfloat_t *c)
+{
+    flexfloat_trace_t *t = trace_rec;
+    uint32_t ia = 0, ib = 0, ic = 0, var;
+    trace_entry_t *e;
+
+    if(!t || t->failed)
+        return;
+    t->pending = TRACE_NONE;
+    if(a && ((ia = trace_operand(t, a)) == TRACE_NONE))
+        goto fail;
+    if(b && ((ib = trace_operand(t, b)) == TRACE_NONE))
+        goto fail;
+    if(c && ((ic = trace_operand(t, c)) == TRACE_NONE))
+        goto fail;
+    e = trace_entry(t, dest);
+    if(!e || ((var = trace_var(t, e, dest->desc)) == TRACE_NONE))
+        goto fail;
+    if(op == flexfloat_trace_const)
+        t->pending = trace_const(t, var, dest);
+    else
+        t->pending = trace_push(t, op, var, ia, ib, ic);
+    if(t->pending != TRACE_NONE)
+        return;
+fail:
+    t->failed = true;
+}
+
+void flexfloat_trace_commit(const flexfloat_t *dest)
+{
+    flexfloat_trace_t *t = trace_rec;
+    trace_entry_t *e;
+
+    if(!t || t->failed || (t->pending == TRACE_NONE))
+        return;
+    e = trace_entry(t, dest);
+    if(!e)
+    {
+        t->failed = true;
+        return;
+    }
+    e->node = t->pending;
+    e->bits = trace_bits(dest);
+    t->pending = TRACE_NONE;
+}
+
+void flexfloat_trace_out(const flexfloat_t *a)
+{
+    flexfloat_trace_t *t = trace_rec;
+    uint32_t ia;
+
+    if(!t || t->failed)
+        return;
+    ia = trace_operand(t, a);
+    if((ia == TRACE_NONE) || (trace_push(t, flexfloat_trace_output, 0, ia, (uint32_t) t->outputs, 0) == TRACE_NONE))
+        t->failed = true;
+    else
+        t->outputs++;
+}
+
+void flexfloat_trace_bind(const flexfloat_t *obj, const char *name)
+{
+    flexfloat_trace_t *t = trace_rec;
+    trace_entry_t *e;
+    long var;
+
+    if(!t || t->failed)
+        return;
+    e = trace_entry(t, obj);
+    if(!e)
+    {
+        t->failed = true;
+        return;
+    }
+    var = flexfloat_trace_find(t, name);
+    if(var < 0)
+    {
+        flexfloat_desc_t unset = { 0, 0 };
+        var = (long) trace_new_var(t, unset, name);
+    }
+    e->var = (uint32_t) var;
+    if(e->var == TRACE_NONE)
+        t->failed = true;
+}
+
+flexfloat_trace_t *flexfloat_trace_create(void)
+{
+    flexfloat_trace_t *t = (flexfloat_trace_t *) calloc(1, sizeof(flexfloat_trace_t));
+    if(t)
+        t->pending = TRACE_NONE;
+    return t;
+}
+
+void flexfloat_trace_destroy(flexfloat_trace_t *t)
+{
+    size_t i;
+
+    if(!t)
+        return;
+    if(trace_rec == t)
+        trace_rec = NULL;
+    for(i = 0; i < t->nvars; ++i)
+        free(t->name[i]);
+    free(t->name);
+    free(t->desc);
+    free(t->consts);
+    free(t->op);
+    free(t->var);
+    free(t->a);
+    free(t->b);
+    free(t->c);
+    free(t->dst);
+    free(t->map);
+    free(t);
+}
+
+bool flexfloat_trace_begin(flexfloat_trace_t *t)
+{
+    if(!t || t->finished || trace_rec)
+        return false;
+    trace_rec = t;
+    return true;
+}
+
+// Number of operand nodes of 'op' (a, then b, then c)
+static int trace_arity(int op)
+{
+    switch(op)
+    {
+        case flexfloat_trace_const:
+            return 0;
+        case flexfloat_trace_add:
+        case flexfloat_trace_sub:
+        case flexfloat_trace_mul:
+        case flexfloat_trace_div:
+        case flexfloat_trace_min:
+        case flexfloat_trace_max:
+            return 2;
+        case flexfloat_trace_fma:
+            return 3;
+        default:
+            return 1;
+    }
+}
+
+// Give every value a place in the working set of the replay, reusing the
+// places of values that are no longer needed
+static bool trace_allocate(flexfloat_trace_t *t)
+{
+    uint32_t *last = (uint32_t *) malloc((t->n ? t->n : 1) * sizeof(uint32_t));
+    uint32_t *freed = (uint32_t *) malloc((t->n ? t->n : 1) * sizeof(uint32_t));
+    size_t nfree = 0, i;
+
+    t->dst = (uint32_t *) malloc((t->n ? t->n : 1) * sizeof(uint32_t));
+    if(!last || !freed || !t->dst)
+    {
+        free(last);
+        free(freed);
+        return false;
+    }
+    for(i = 0; i < t->n; ++i)
+    {
+        int arity = trace_arity(t->op[i]);
+        last[i] = (uint32_t) i;
+        if(arity > 0)
+            last[t->a[i]] = (uint32_t) i;
+        if(arity > 1)
+            last[t->b[i]] = (uint32_t) i;
+        if(arity > 2)
+            last[t->c[i]] = (uint32_t) i;
+    }
+    t->slots = 0;
+    for(i = 0; i < t->n; ++i)
+    {
+        int op = t->op[i], arity = trace_arity(op);
+        uint32_t a = t->a[i], b = t->b[i], c = t->c[i];
+
+        // Operands are read before the result is written: a slot freed here
+        // can hold the result
+        if(arity > 0)
+        {
+            t->a[i] = t->dst[a];
+            if(last[a] == i)
+                freed[nfree++] = t->dst[a];
+        }
+        if(arity > 1)
+        {
+            t->b[i] = t->dst[b];
+            if((last[b] == i) && (b != a))
+                freed[nfree++] = t->dst[b];
+        }
+        if(arity > 2)
+        {
+            t->c[i] = t->dst[c];
+            if((last[c] == i) && (c != a) && (c != b))
+                freed[nfree++] = t->dst[c];
+        }
+        if(op == flexfloat_trace_output)
+        {
+            t->dst[i] = 0;
+            continue;
+        }
+        t->dst[i] = nfree ? freed[--nfree] : (uint32_t) t->slots++;
+        if(last[i] == i)
+            freed[nfree++] = t->dst[i];
+    }
+    free(last);
+    free(freed);
+    return true;
+}
+
+bool flexfloat_trace_end(void)
+{
+    flexfloat_trace_t *t = trace_rec;
+
+    if(!t)
+        return false;
+    trace_rec = NULL;
+    free(t->map);
+    t->map = NULL;
+    t->mapCap = t->mapUsed = 0;
+    t->finished = true;
+    if(!t->failed && !trace_allocate(t))
+        t->failed = true;
+    return !t->failed;
+}
+
+size_t flexfloat_trace_nodes(const flexfloat_trace_t *t)
+{
+    return t->n;
+}
+
+size_t flexfloat_trace_vars(const flexfloat_trace_t *t)
+{
+    return t->nvars;
+}
+
+size_t flexfloat_trace_outputs(const flexfloat_trace_t *t)
+{
+    return t->outputs;
+}
+
+flexfloat_desc_t flexfloat_trace_var_desc(const flexfloat_trace_t *t, size_t var)
+{
+    return t->desc[var];
+}
+
+const char *flexfloat_trace_var_name(const flexfloat_trace_t *t, size_t var)
+{
+    return t->name[var];
+}
+
+long flexfloat_trace_find(const flexfloat_trace_t *t, const char *name)
+{
+    size_t i;
+
+    for(i = 0; i < t->nvars; ++i)
+        if(t->name[i] && !strcmp(t->name[i], name))
+            return (long) i;
+    return -1;
+}
+
+static inline double trace_round(double x, flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    uint64_t ui;
+    memcpy(&ui, &x, sizeof(ui));
+    ui = flexfloat_roundUI(ui, desc, roundingMode);
+    memcpy(&x, &ui, sizeof(x));
+    return x;
+}
+
+// One pass over the trace for 'lanes' configurations; v holds slots * lanes
+// values and d the format of every variable in every lane
+static void trace_run(const flexfloat_trace_t *t, const flexfloat_desc_t *d, size_t lanes,
+    uint_fast8_t roundingMode, double *v, double *out, size_t outStride)
+{
+    size_t i, k;
+
+    for(i = 0; i < t->n; ++i)
+    {
+        const flexfloat_desc_t *dv = d + (size_t) t->var[i] * lanes;
+        const double *x = v + (size_t) t->a[i] * lanes;
+        const double *y = v + (size_t) t->b[i] * lanes;
+        const double *w = v + (size_t) t->c[i] * lanes;
+        double *z = v + (size_t) t->dst[i] * lanes;
+
+        switch(t->op[i])
+        {
+            case flexfloat_trace_const:
+            {
+                double c = t->consts[t->a[i]];
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(c, dv[k], roundingMode);
+                break;
+            }
+            case flexfloat_trace_cast:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(x[k], dv[k], roundingMode);
+                break;
+            case flexfloat_trace_neg:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(-x[k], dv[k], roundingMode);
+                break;
+            case flexfloat_trace_add:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_addF64UI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), dv[k], roundingMode)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_sub:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_subF64UI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), dv[k], roundingMode)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_mul:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_mulF64UI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), dv[k], roundingMode)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_div:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_divF64UI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), dv[k], roundingMode)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_fma:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_mulAddF64UI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), flexfloat_fromDoubleUI(w[k]), dv[k], roundingMode)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_sqrt:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_sqrtF64UI(flexfloat_fromDoubleUI(x[k]),
+                        dv[k], roundingMode)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_min:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_minMaxUI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), false)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_max:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(flexfloat_toDoubleUI(flexfloat_minMaxUI(flexfloat_fromDoubleUI(x[k]),
+                        flexfloat_fromDoubleUI(y[k]), true)), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_abs:
+                for(k = 0; k < lanes; ++k)
+                    z[k] = trace_round(fabs(x[k]), dv[k], roundingMode);
+                break;
+            case flexfloat_trace_output:
+                for(k = 0; k < lanes; ++k)
+                    out[k * outStride + t->b[i]] = x[k];
+                break;
+        }
+    }
+}
+
+bool flexfloat_trace_replay_batch(const flexfloat_trace_t *t, const flexfloat_desc_t *descs,
+    size_t count, uint_fast8_t roundingMode, double *out)
+{
+    size_t lanes = (count < TRACE_LANES) ? count : TRACE_LANES;
+    flexfloat_desc_t *d;
+    double *v;
+    size_t first, k, var;
+
+    if(!t || !t->finished || t->failed)
+        return false;
+    if(!count)
+        return true;
+    v = (double *) malloc((t->slots ? t->slots : 1) * lanes * sizeof(double));
+    d = (flexfloat_desc_t *) malloc((t->nvars ? t->nvars : 1) * lanes * sizeof(flexfloat_desc_t));
+    if(!v || !d)
+    {
+        free(v);
+        free(d);
+        return false;
+    }
+    for(first = 0; first < count; first += lanes)
+    {
+        size_t n = (count - first < lanes) ? count - first : lanes;
+        for(var = 0; var < t->nvars; ++var)
+            for(k = 0; k < n; ++k)
+                d[var * n + k] = descs[(first + k) * t->nvars + var];
+        trace_run(t, d, n, roundingMode, v, out + first * t->outputs, t->outputs);
+    }
+    free(v);
+    free(d);
+    return true;
+}
+
+bool flexfloat_trace_replay(const flexfloat_trace_t *t, const flexfloat_desc_t *descs,
+    uint_fast8_t roundingMode, double *out)
+{
+    return flexfloat_trace_replay_batch(t, descs, 1, roundingMode, out);
+}
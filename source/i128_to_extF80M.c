@@ -0,0 +1,84 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void i128_to_extF80M( int128_t a, extFloat80_t *zPtr )
+{
+    bool sign;
+    uint64_t a64, a0;
+    uint_fast8_t shiftDist;
+    int32_t exp;
+    uint32_t extSig[3];
+
+    a64 = int128V64( a );
+    a0  = int128V0( a );
+    sign = a64>>63;
+    if ( sign ) {
+        a64 = -a64 - (a0 != 0);
+        a0 = -a0;
+    }
+    /*------------------------------------------------------------------------
+    | Integers wider than 96 bits are normalized first and lose their low 32
+    | bits, jammed, which still leaves more than the 64-bit significand and
+    | its rounding bits.
+    *------------------------------------------------------------------------*/
+    if ( a64>>32 ) {
+        shiftDist = softfloat_countLeadingZeros32( a64>>32 );
+        exp = 0x407E - shiftDist;
+        if ( shiftDist ) {
+            a64 = a64<<shiftDist | a0>>(64 - shiftDist);
+            a0 <<= shiftDist;
+        }
+        extSig[indexWord( 3, 2 )] = a64>>32;
+        extSig[indexWord( 3, 1 )] = a64;
+        extSig[indexWord( 3, 0 )] = a0>>32 | ((uint32_t) a0 != 0);
+    } else {
+        exp = 0x405E;
+        extSig[indexWord( 3, 2 )] = a64;
+        extSig[indexWord( 3, 1 )] = a0>>32;
+        extSig[indexWord( 3, 0 )] = a0;
+    }
+    softfloat_normRoundPackMToExtF80M(
+        sign, exp, extSig, extF80_roundingPrecision,
+        (struct extFloat80M *) zPtr );
+
+}
+
@@ -15,6 +15,8 @@ extern "C" {
 #include "softfloat_types.h"
 #include "softfloat.h"
 #include <stdio.h>
+#include <math.h>
+#include <float.h>
 
 #ifdef FLEXFLOAT_ON_DOUBLE
 #define CAST_TO_INT64(d) (*((int64_t *)(&(d))))
@@ -27,6 +29,14 @@ extern "C" {
 #define INLINE inline
 #endif 	
 
+// The rounding kernels are forced inline, so that callers with a constant
+// descriptor get the format constants folded in
+#if defined(__GNUC__) || defined(__clang__)
+#define FLEXFLOAT_KERNEL static inline __attribute__((always_inline))
+#else
+#define FLEXFLOAT_KERNEL static inline
+#endif
+
 // Types
 typedef struct { 
 	uint8_t exp_bits;
@@ -59,6 +69,541 @@ static inline bool flexfloat_sign(const flexfloat_t *a)
 	return signF64UI(CAST_TO_INT64(a->value));
 }
 
+// Bit-level helpers on the raw binary64 encoding. The descriptor is passed by
+// value, so callers with a constant descriptor (e.g. the C++ template) get the
+// format constants folded in.
+
+// Native (1 + exp_bits + frac_bits)-bit encoding of a value that is already
+// representable in 'desc', right-aligned in a uint64_t
+static inline uint64_t flexfloat_encodeUI(uint64_t a, const flexfloat_desc_t desc)
+{
+	int_fast16_t a_exp = expF64UI(a);
+	uint64_t a_frac = fracF64UI(a);
+	int_fast16_t exp;
+	uint64_t frac;
+
+	if(a_exp == 0x7FF)
+	{
+		exp = flexfloat_inf_exp(desc);
+		frac = a_frac >> (52 - desc.frac_bits);
+		if(a_frac && !frac) // keep NaNs NaN
+			frac = UINT64_C(1) << (desc.frac_bits - 1);
+	}
+	else if(a_exp == 0)
+	{
+		exp = 0;
+		frac = a_frac >> (52 - desc.frac_bits);
+	}
+	else
+	{
+		exp = (a_exp - 1023) + flexfloat_bias(desc);
+		frac = a_frac >> (52 - desc.frac_bits);
+		if(exp <= 0) // subnormal in 'desc'
+		{
+			int_fast16_t dist = 52 - desc.frac_bits + 1 - exp;
+			frac = (dist < 64) ? ((a_frac | UINT64_C(0x0010000000000000)) >> dist) : 0;
+			exp = 0;
+		}
+	}
+
+	return ((uint64_t) signF64UI(a) << (desc.exp_bits + desc.frac_bits))
+		| ((uint64_t) exp << desc.frac_bits) | frac;
+}
+
+// Inverse of flexfloat_encodeUI: binary64 encoding of a native encoding
+static inline uint64_t flexfloat_decodeUI(uint64_t ui, const flexfloat_desc_t desc)
+{
+	bool sign = (ui >> (desc.exp_bits + desc.frac_bits)) & 1;
+	int_fast16_t exp = (int_fast16_t) ((ui >> desc.frac_bits) & ((UINT64_C(1) << desc.exp_bits) - 1));
+	uint64_t frac = ui & ((UINT64_C(1) << desc.frac_bits) - 1);
+
+	if(exp == flexfloat_inf_exp(desc))
+		return packToF64UI(sign, 0x7FF, frac << (52 - desc.frac_bits));
+	if(exp == 0)
+	{
+		if(!frac)
+			return packToF64UI(sign, 0, 0);
+		// Normalize the subnormal; binary64 has the range to keep it normal
+		// unless 'desc' is binary64 itself.
+		exp = 1;
+		while(!(frac >> desc.frac_bits))
+		{
+			frac <<= 1;
+			--exp;
+		}
+		exp = (exp - flexfloat_bias(desc)) + 1023;
+		if(exp <= 0)
+			return packToF64UI(sign, 0, (ui << (52 - desc.frac_bits)) & UINT64_C(0x000FFFFFFFFFFFFF));
+		frac &= (UINT64_C(1) << desc.frac_bits) - 1;
+		return packToF64UI(sign, exp, frac << (52 - desc.frac_bits));
+	}
+	return packToF64UI(sign, (exp - flexfloat_bias(desc)) + 1023, frac << (52 - desc.frac_bits));
+}
+
+static inline int_fast16_t flexfloat_expUI(uint64_t a, const flexfloat_desc_t desc)
+{
+	return (int_fast16_t) ((flexfloat_encodeUI(a, desc) >> desc.frac_bits) & flexfloat_inf_exp(desc));
+}
+
+static inline uint64_t flexfloat_fracUI(uint64_t a, const flexfloat_desc_t desc)
+{
+	return flexfloat_encodeUI(a, desc) & ((UINT64_C(1) << desc.frac_bits) - 1);
+}
+
+static inline uint64_t flexfloat_packUI(const flexfloat_desc_t desc, bool sign, int_fast16_t exp, uint64_t frac)
+{
+	return flexfloat_decodeUI(((uint64_t) sign << (desc.exp_bits + desc.frac_bits))
+		| ((uint64_t) exp << desc.frac_bits) | frac, desc);
+}
+
+// Round a binary64 encoding to the precision described by 'desc', with
+// gradual underflow, in the given softfloat rounding mode. NaNs become the
+// positive quiet NaN keeping the high payload bits. No flags are raised.
+FLEXFLOAT_KERNEL uint64_t flexfloat_roundUI(uint64_t a, const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	const int_fast16_t shift = 52 - desc.frac_bits;
+	// Biased binary64 exponents of the smallest and largest normal in 'desc'
+	const int_fast16_t emin = 1024 - flexfloat_bias(desc);
+	const int_fast16_t emax = 1023 + flexfloat_bias(desc);
+	const uint64_t maxFinite = ((uint64_t) emax << 52) | (UINT64_C(0x000FFFFFFFFFFFFF) & ~((UINT64_C(1) << shift) - 1));
+	const uint64_t sign = a & UINT64_C(0x8000000000000000);
+	uint64_t mag = a ^ sign;
+	int_fast16_t exp = (int_fast16_t) (mag >> 52);
+	int_fast16_t dist;
+	uint64_t mask, inc, sig;
+
+	if(exp == 0x7FF)
+	{
+		if(!fracF64UI(mag))
+			return a;
+		return UINT64_C(0x7FF8000000000000) | (mag & ~((UINT64_C(1) << shift) - 1));
+	}
+
+	// Common case: normal range, round to nearest even
+	if((roundingMode == softfloat_round_near_even) && (exp >= emin))
+	{
+		mask = (UINT64_C(1) << shift) - 1;
+		mag = (mag + (mask ? (mask >> 1) + ((mag >> shift) & 1) : 0)) & ~mask;
+		return sign | ((mag > maxFinite) ? UINT64_C(0x7FF0000000000000) : mag);
+	}
+
+	// Rounding position: 'shift' for normals, further left below the normal range
+	dist = shift + ((exp < emin) ? emin - (exp ? exp : 1) : 0);
+	if(dist > 63)
+		dist = 63;
+	mask = (UINT64_C(1) << dist) - 1;
+	// Significand with the implicit bit, whose bit 'dist' is the last kept one
+	sig = exp ? (fracF64UI(mag) | UINT64_C(0x0010000000000000)) : mag;
+
+	switch(roundingMode)
+	{
+		case softfloat_round_near_even:
+			inc = mask ? (mask >> 1) + ((sig >> dist) & 1) : 0;
+			break;
+		case softfloat_round_near_maxMag:
+			inc = (mask + 1) >> 1;
+			break;
+		case softfloat_round_min:
+			inc = sign ? mask : 0;
+			break;
+		case softfloat_round_max:
+			inc = sign ? 0 : mask;
+			break;
+		default: // minMag, odd
+			inc = 0;
+			break;
+	}
+
+	if(dist > 52)
+	{
+		// Below the smallest subnormal: the result is zero or that subnormal
+		bool up = ((sig + inc) >> dist) || ((roundingMode == softfloat_round_odd) && sig);
+		return up ? sign | ((uint64_t) (emin - desc.frac_bits) << 52) : sign;
+	}
+
+	// Round to odd: jam into the last kept bit (at dist 52 that bit is the
+	// implicit one, already set for normals)
+	if((roundingMode == softfloat_round_odd) && (mag & mask) && ((dist < 52) || !exp))
+		mag |= mask + 1;
+	mag = (mag + inc) & ~mask;
+
+	if(mag > maxFinite)
+	{
+		// Overflow: infinity, or the largest finite value when rounding toward zero
+		bool toInf = (roundingMode == softfloat_round_near_even)
+			|| (roundingMode == softfloat_round_near_maxMag)
+			|| (roundingMode == (sign ? softfloat_round_min : softfloat_round_max));
+		if(toInf)
+			return sign | UINT64_C(0x7FF0000000000000);
+		return sign | maxFinite;
+	}
+	return sign | mag;
+}
+
+// Binary32 counterpart of flexfloat_roundUI, for formats with exp_bits <= 8
+// and frac_bits <= 23
+FLEXFLOAT_KERNEL uint32_t flexfloat_roundF32UI(uint32_t a, const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	const int_fast16_t shift = 23 - desc.frac_bits;
+	const int_fast16_t emin = 128 - flexfloat_bias(desc);
+	const int_fast16_t emax = 127 + flexfloat_bias(desc);
+	const uint32_t maxFinite = ((uint32_t) emax << 23) | (UINT32_C(0x007FFFFF) & ~((UINT32_C(1) << shift) - 1));
+	const uint32_t sign = a & UINT32_C(0x80000000);
+	uint32_t mag = a ^ sign;
+	int_fast16_t exp = (int_fast16_t) (mag >> 23);
+	int_fast16_t dist;
+	uint32_t mask, inc, sig;
+
+	if(exp == 0xFF)
+	{
+		if(!fracF32UI(mag))
+			return a;
+		return UINT32_C(0x7FC00000) | (mag & ~((UINT32_C(1) << shift) - 1));
+	}
+
+	// Common case: normal range, round to nearest even
+	if((roundingMode == softfloat_round_near_even) && (exp >= emin))
+	{
+		mask = (UINT32_C(1) << shift) - 1;
+		mag = (mag + (mask ? (mask >> 1) + ((mag >> shift) & 1) : 0)) & ~mask;
+		return sign | ((mag > maxFinite) ? UINT32_C(0x7F800000) : mag);
+	}
+
+	dist = shift + ((exp < emin) ? emin - (exp ? exp : 1) : 0);
+	if(dist > 31)
+		dist = 31;
+	mask = (UINT32_C(1) << dist) - 1;
+	sig = exp ? (fracF32UI(mag) | UINT32_C(0x00800000)) : mag;
+
+	switch(roundingMode)
+	{
+		case softfloat_round_near_even:
+			inc = mask ? (mask >> 1) + ((sig >> dist) & 1) : 0;
+			break;
+		case softfloat_round_near_maxMag:
+			inc = (mask + 1) >> 1;
+			break;
+		case softfloat_round_min:
+			inc = sign ? mask : 0;
+			break;
+		case softfloat_round_max:
+			inc = sign ? 0 : mask;
+			break;
+		default: // minMag, odd
+			inc = 0;
+			break;
+	}
+
+	if(dist > 23)
+	{
+		bool up = ((sig + inc) >> dist) || ((roundingMode == softfloat_round_odd) && sig);
+		return up ? sign | ((uint32_t) (emin - desc.frac_bits) << 23) : sign;
+	}
+
+	if((roundingMode == softfloat_round_odd) && (mag & mask) && ((dist < 23) || !exp))
+		mag |= mask + 1;
+	mag = (mag + inc) & ~mask;
+
+	if(mag > maxFinite)
+	{
+		bool toInf = (roundingMode == softfloat_round_near_even)
+			|| (roundingMode == softfloat_round_near_maxMag)
+			|| (roundingMode == (sign ? softfloat_round_min : softfloat_round_max));
+		if(toInf)
+			return sign | UINT32_C(0x7F800000);
+		return sign | maxFinite;
+	}
+	return sign | mag;
+}
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_sanitizeUI(uint64_t a, const flexfloat_desc_t desc)
+{
+	return flexfloat_roundUI(a, desc, softfloat_roundingMode);
+}
+
+// Bit casts between binary64 encodings and host doubles
+static inline double flexfloat_toDoubleUI(uint64_t ui)
+{
+	union { uint64_t ui; double d; } u;
+	u.ui = ui;
+	return u.d;
+}
+
+static inline uint64_t flexfloat_fromDoubleUI(double d)
+{
+	union { uint64_t ui; double d; } u;
+	u.d = d;
+	return u.ui;
+}
+
+// Correctly rounded operations. These return a binary64 encoding that one
+// flexfloat_roundUI to 'desc' in 'roundingMode' turns into the correctly
+// rounded result. Up to frac_bits = 50 the binary64 result is rounded to odd
+// (truncated, with the last bit set if inexact): it then keeps two bits more
+// than the format, and the second rounding is correct in every mode. Wider
+// formats keep at most one bit more, which is enough for the directed modes:
+// the binary64 result rounded in 'roundingMode' is rounded again in the same
+// direction, or to odd again in round-to-odd mode. To nearest, the binary64
+// truncation and whether it is exact tell on which side of a midpoint of the
+// format the exact value lies, so it is rounded to nearest-away from the
+// truncation (flexfloat_nearF64). Binary64 itself and the normal range of
+// <exp_bits, 52> take the binary64 result in 'roundingMode'. SoftFloat's
+// rounding mode and flags are left as they were.
+
+// Whether the binary64 result is rounded to odd
+static inline bool flexfloat_oddF64(const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	return (desc.frac_bits <= 50) || (roundingMode == softfloat_round_odd);
+}
+
+// Whether a wider format rounds to nearest from the binary64 truncation
+static inline bool flexfloat_nearF64(const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	return !flexfloat_oddF64(desc, roundingMode) && ((desc.exp_bits < 11) || (desc.frac_bits < 52))
+		&& ((roundingMode == softfloat_round_near_even) || (roundingMode == softfloat_round_near_maxMag));
+}
+
+// Operations of flexfloat_softF64UI
+enum {
+	flexfloat_soft_mulAdd = 0,  // a * b + c
+	flexfloat_soft_sqrt,        // sqrt(a)
+	flexfloat_soft_add,         // a + b
+	flexfloat_soft_mul,         // a * b
+	flexfloat_soft_div          // a / b
+};
+
+static inline uint64_t flexfloat_softOpF64UI(int op, float64_t a, float64_t b, float64_t c)
+{
+	switch(op)
+	{
+		case flexfloat_soft_mulAdd:
+			return f64_mulAdd(a, b, c).v;
+		case flexfloat_soft_sqrt:
+			return f64_sqrt(a).v;
+		case flexfloat_soft_add:
+			return f64_add(a, b).v;
+		case flexfloat_soft_mul:
+			return f64_mul(a, b).v;
+		default:
+			return f64_div(a, b).v;
+	}
+}
+
+// SoftFloat fallback of the operations
+static inline uint64_t flexfloat_softF64UI(int op, uint64_t a, uint64_t b, uint64_t c,
+	const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	const uint_fast8_t mode = softfloat_roundingMode, flags = softfloat_exceptionFlags;
+	const bool odd = flexfloat_oddF64(desc, roundingMode);
+	const bool near = flexfloat_nearF64(desc, roundingMode);
+	float64_t x, y, z;
+	uint64_t r;
+
+	x.v = a;
+	y.v = b;
+	z.v = c;
+	softfloat_roundingMode =
+		(odd || near) ? (uint_fast8_t) softfloat_round_minMag : roundingMode;
+	softfloat_exceptionFlags = 0;
+	r = flexfloat_softOpF64UI(op, x, y, z);
+	if(odd && (softfloat_exceptionFlags & softfloat_flag_inexact))
+		r |= 1;
+	else if(near && (softfloat_exceptionFlags & softfloat_flag_inexact))
+	{
+		// The exact value lies strictly between the truncation and the next
+		// binary64 value: past a midpoint of the format if and only if the
+		// truncation is at or past it. A truncation in the normal range of
+		// <exp_bits, 52> has no bit to spare, so that range rounds in binary64.
+		if((desc.frac_bits < 52) || ((r & UINT64_C(0x7FFFFFFFFFFFFFFF)) < ((uint64_t) (1024 - flexfloat_bias(desc)) << 52)))
+			r = flexfloat_roundUI(r, desc, softfloat_round_near_maxMag);
+		else
+		{
+			softfloat_roundingMode = roundingMode;
+			r = flexfloat_softOpF64UI(op, x, y, z);
+		}
+	}
+	else if((odd || near) && ((op == flexfloat_soft_mulAdd) || (op == flexfloat_soft_add)) && !(r & UINT64_C(0x7FFFFFFFFFFFFFFF)))
+	{
+		// Exact zero sum: its sign depends on the rounding mode
+		softfloat_roundingMode = roundingMode;
+		r = flexfloat_softOpF64UI(op, x, y, z);
+	}
+	softfloat_roundingMode = mode;
+	softfloat_exceptionFlags = flags;
+	return r;
+}
+
+#ifdef FLEXFLOAT_ON_DOUBLE
+// Round to odd from the binary64 result 'r' rounded to nearest, given the
+// side of the exact value when it differs from r
+static inline uint64_t flexfloat_jamF64UI(uint64_t r, bool below)
+{
+	if(r & 1)
+		return r;
+	return (signF64UI(r) == below) ? r + 1 : r - 1;
+}
+
+// Host result rounded to nearest even that needs no correction: rounding
+// twice to nearest even is innocuous up to p = 25 (2p + 2 <= 53) when the
+// format has no subnormal in the binary64 subnormal range, and binary64
+// itself uses the result as it is
+static inline bool flexfloat_hostF64Exact(const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	return (roundingMode == softfloat_round_near_even)
+		&& (((desc.exp_bits <= 10) && (desc.frac_bits <= 24)) || ((desc.exp_bits == 11) && (desc.frac_bits == 52)));
+}
+#endif
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_addF64UI(uint64_t a, uint64_t b,
+	const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+#ifdef FLEXFLOAT_ON_DOUBLE
+	const double x = flexfloat_toDoubleUI(a), y = flexfloat_toDoubleUI(b), s = x + y;
+
+	if(flexfloat_hostF64Exact(desc, roundingMode))
+		return flexfloat_fromDoubleUI(s);
+	// TwoSum gives the exact error of a finite sum, subnormals included
+	if(flexfloat_oddF64(desc, roundingMode) && (fabs(s) <= DBL_MAX) && ((s < 0.0) || (s > 0.0)))
+	{
+		double t = s - x;
+		double err = (x - (s - t)) + (y - t);
+
+		if((err < 0.0) || (err > 0.0))
+			return flexfloat_jamF64UI(flexfloat_fromDoubleUI(s), err < 0.0);
+		return flexfloat_fromDoubleUI(s);
+	}
+#endif
+	return flexfloat_softF64UI(flexfloat_soft_add, a, b, 0, desc, roundingMode);
+}
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_subF64UI(uint64_t a, uint64_t b,
+	const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+	return flexfloat_addF64UI(a, b ^ UINT64_C(0x8000000000000000), desc, roundingMode);
+}
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_mulF64UI(uint64_t a, uint64_t b,
+	const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+#ifdef FLEXFLOAT_ON_DOUBLE
+	const double x = flexfloat_toDoubleUI(a), y = flexfloat_toDoubleUI(b), p = x * y;
+
+	if(flexfloat_hostF64Exact(desc, roundingMode))
+		return flexfloat_fromDoubleUI(p);
+	// The fma residual x * y - p is exact 2^53 above the underflow threshold
+	if(flexfloat_oddF64(desc, roundingMode) && (fabs(p) <= DBL_MAX) && (fabs(p) >= DBL_MIN * 9007199254740992.0))
+	{
+		double err = fma(x, y, -p);
+
+		if((err < 0.0) || (err > 0.0))
+			return flexfloat_jamF64UI(flexfloat_fromDoubleUI(p), err < 0.0);
+		return flexfloat_fromDoubleUI(p);
+	}
+#endif
+	return flexfloat_softF64UI(flexfloat_soft_mul, a, b, 0, desc, roundingMode);
+}
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_divF64UI(uint64_t a, uint64_t b,
+	const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+#ifdef FLEXFLOAT_ON_DOUBLE
+	const double x = flexfloat_toDoubleUI(a), y = flexfloat_toDoubleUI(b), q = x / y;
+
+	if(flexfloat_hostF64Exact(desc, roundingMode))
+		return flexfloat_fromDoubleUI(q);
+	// The residual x - q * y is exact for a normal quotient of a dividend
+	// 2^54 above the underflow threshold; x / y - q has the sign of rem / y
+	if(flexfloat_oddF64(desc, roundingMode) && (fabs(q) <= DBL_MAX) && (fabs(q) >= DBL_MIN)
+		&& (fabs(x) >= DBL_MIN * 18014398509481984.0))
+	{
+		double rem = fma(-q, y, x);
+
+		if((rem < 0.0) || (rem > 0.0))
+			return flexfloat_jamF64UI(flexfloat_fromDoubleUI(q), (rem < 0.0) != (y < 0.0));
+		return flexfloat_fromDoubleUI(q);
+	}
+#endif
+	return flexfloat_softF64UI(flexfloat_soft_div, a, b, 0, desc, roundingMode);
+}
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_mulAddF64UI(uint64_t a, uint64_t b, uint64_t c,
+	const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+#ifdef FLEXFLOAT_ON_DOUBLE
+	// The product of two such values is exact in binary64 (no underflow
+	// either), and TwoSum gives the exact error of the sum
+	if((desc.exp_bits <= 10) && (desc.frac_bits <= 24))
+	{
+		double p = flexfloat_toDoubleUI(a) * flexfloat_toDoubleUI(b), q = flexfloat_toDoubleUI(c);
+		double s = p + q, t = s - p;
+		double err = (p - (s - t)) + (q - t);
+		uint64_t r = flexfloat_fromDoubleUI(s);
+
+		if((s != 0.0) || (roundingMode != softfloat_round_min))
+		{
+			if((err < 0.0) || (err > 0.0))
+				return flexfloat_jamF64UI(r, err < 0.0);
+			return r;
+		}
+	}
+#endif
+	return flexfloat_softF64UI(flexfloat_soft_mulAdd, a, b, c, desc, roundingMode);
+}
+
+FLEXFLOAT_KERNEL uint64_t flexfloat_sqrtF64UI(uint64_t a, const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+#ifdef FLEXFLOAT_ON_DOUBLE
+	// Host square root, rounded to odd with the exact residual s * s - x
+	if((desc.exp_bits <= 10) && (desc.frac_bits <= 50))
+	{
+		double x = flexfloat_toDoubleUI(a), s = sqrt(x);
+		uint64_t r = flexfloat_fromDoubleUI(s);
+
+		if(x > 0.0)
+		{
+			// s * s - x > 0 means that the exact root is below s
+			double err = fma(s, s, -x);
+			if((err < 0.0) || (err > 0.0))
+				return flexfloat_jamF64UI(r, err > 0.0);
+		}
+		return r;
+	}
+#endif
+	return flexfloat_softF64UI(flexfloat_soft_sqrt, a, 0, 0, desc, roundingMode);
+}
+
+// IEEE 754 minNum/maxNum of two binary64 encodings: a NaN operand is ignored,
+// -0 orders below +0
+FLEXFLOAT_KERNEL uint64_t flexfloat_minMaxUI(uint64_t a, uint64_t b, bool max)
+{
+	// Keys that order as the values do
+	uint64_t ka = signF64UI(a) ? ~a : a | UINT64_C(0x8000000000000000);
+	uint64_t kb = signF64UI(b) ? ~b : b | UINT64_C(0x8000000000000000);
+
+	if(isNaNF64UI(a))
+		return b;
+	if(isNaNF64UI(b))
+		return a;
+	return ((ka < kb) != max) ? a : b;
+}
+
+// Binary64 encoding of the integer 'mag' (negated if 'sign'), rounded to odd
+FLEXFLOAT_KERNEL uint64_t flexfloat_fromUI64(uint64_t mag, bool sign)
+{
+	int_fast16_t n = 63;
+	uint64_t sig;
+
+	if(!mag)
+		return packToF64UI(sign, 0, 0);
+	while(!(mag >> n))
+		--n;
+	if(n <= 52)
+		sig = mag << (52 - n);
+	else
+		sig = (mag >> (n - 52)) | ((mag & ((UINT64_C(1) << (n - 52)) - 1)) ? 1 : 0);
+	return packToF64UI(sign, 0x3FF + n, sig & UINT64_C(0x000FFFFFFFFFFFFF));
+}
+
 int_fast16_t flexfloat_exp(const flexfloat_t *a);
 uint64_t flexfloat_frac(const flexfloat_t *a);
 uint64_t flexfloat_pack(flexfloat_desc_t desc, bool sign, int_fast16_t exp, uint64_t frac);
@@ -71,12 +616,20 @@ void ff_init_double(flexfloat_t *obj, double value, flexfloat_desc_t desc);
 void ff_init_longdouble(flexfloat_t *obj, long double value, flexfloat_desc_t desc);
 void ff_init_int(flexfloat_t *obj, int value, flexfloat_desc_t desc);
 void ff_init_long(flexfloat_t *obj, long value, flexfloat_desc_t desc);
+void ff_init_i64(flexfloat_t *obj, int64_t value, flexfloat_desc_t desc);
+void ff_init_ui64(flexfloat_t *obj, uint64_t value, flexfloat_desc_t desc);
 void ff_init_ff(flexfloat_t *obj, const flexfloat_t *source, flexfloat_desc_t desc);
 
 // Casts
 float ff_get_float(const flexfloat_t *obj);
 double ff_get_double(const flexfloat_t *obj);
 long double ff_get_longdouble(const flexfloat_t *obj);
+// To integers, as f64_to_i32 and friends: rounded in 'roundingMode', raising
+// the inexact flag if 'exact'; out-of-range values give the SoftFloat limits
+int_fast32_t ff_to_i32(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact);
+uint_fast32_t ff_to_ui32(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact);
+int_fast64_t ff_to_i64(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact);
+uint_fast64_t ff_to_ui64(const flexfloat_t *obj, uint_fast8_t roundingMode, bool exact);
 
 // Artihmetics
 void ff_inverse(flexfloat_t *dest, const flexfloat_t *a);
@@ -84,6 +637,13 @@ void ff_add(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b);
 void ff_sub(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b);
 void ff_mul(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b);
 void ff_div(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b);
+// dest = a * b + c with a single rounding
+void ff_fma(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b, const flexfloat_t *c);
+void ff_sqrt(flexfloat_t *dest, const flexfloat_t *a);
+// IEEE 754 minNum/maxNum: a NaN operand is ignored, -0 is below +0
+void ff_min(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b);
+void ff_max(flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b);
+void ff_abs(flexfloat_t *dest, const flexfloat_t *a);
 
 // Relational operators
 bool ff_eq(const flexfloat_t *a, const flexfloat_t *b);
@@ -93,6 +653,26 @@ bool ff_lt(const flexfloat_t *a, const flexfloat_t *b);
 bool ff_ge(const flexfloat_t *a, const flexfloat_t *b);
 bool ff_gt(const flexfloat_t *a, const flexfloat_t *b);
 
+// Array operations
+// Round every element of 'data' to the precision described by 'desc' in place
+// (flexfloat_roundUI over the whole array; AVX2 when the CPU has it)
+void ff_round_array(double *data, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+// Copy 'n' values to 'dest' rounded to 'desc'. Values of any other format are
+// exact in binary64, so this converts from any source format; dest may be src
+void ff_convert_array(double *dest, const double *src, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+// Element-wise operations on arrays of values of format 'desc', with the same
+// results as ff_add and friends element by element (dest may alias an operand)
+void ff_add_array(double *dest, const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+void ff_sub_array(double *dest, const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+void ff_mul_array(double *dest, const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+void ff_div_array(double *dest, const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+void ff_fma_array(double *dest, const double *a, const double *b, const double *c, size_t n,
+    flexfloat_desc_t desc, uint_fast8_t roundingMode);
+// Reductions in index order, rounding every product and partial sum to 'desc'
+// (the result of the equivalent loop of ff_mul and ff_add)
+double ff_sum(const double *a, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+double ff_dot(const double *a, const double *b, size_t n, flexfloat_desc_t desc, uint_fast8_t roundingMode);
+
 #endif
 
 /* C++ */
@@ -2,9 +2,12 @@
 
 #include "softfloat.hpp"
 #include "flexfloat.h"
+#include "flexfloat_stats.h"
 
 #include <iostream>
 #include <bitset>
+#include <cmath>
+#include <cstring>
 
 #ifndef INLINE
 #define INLINE 
@@ -31,353 +34,819 @@ static INLINE std::ostream& flexfloat_as_bits(std::ostream& os) {
     return os;
 } 
 
-/* CLASS DEFINITION */
+/* STORAGE MODE */
 
-template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> class flexfloat {
-protected:
-    flexfloat_t v;
+// By default every flexfloat<e, f> holds its value plus a flexfloat_desc_t, so
+// that the double backend has the layout of a flexfloat_t. Define
+// FLEXFLOAT_COMPACT before including this header to store only the value: the
+// precision is a template parameter, so the descriptor is passed to the
+// rounding step as a constant and the class becomes trivially copyable. Arrays
+// of flexfloat<e, f> then take half the memory and loops over them can be
+// vectorized.
 
-public:
-    #ifdef FLEXFLOAT_ON_DOUBLE
-    INLINE double getValue() const {
-    #else
-    INLINE float64_t getValue() const {
-    #endif
-        return v.value;
+/* ARRAY OPERATIONS */
+
+// Round a whole array of doubles to <exp_bits, frac_bits> in place (see ff_round_array)
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits>
+static INLINE void flexfloat_round_array(double *data, size_t n, uint_fast8_t roundingMode = softfloat_roundingMode) {
+    flexfloat_desc_t desc = { exp_bits, frac_bits };
+    ff_round_array(data, n, desc, roundingMode);
+}
+
+/* BINARY128 ROUNDING */
+
+// Round a binary128 value to <exp_bits, frac_bits> (exp_bits <= 15,
+// frac_bits <= 112): the binary128 counterpart of flexfloat_roundUI.
+static INLINE float128_t flexfloat_roundF128(const float128_t &a, const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    const int shift = 112 - desc.frac_bits;
+    const int_fast32_t bias = (INT32_C(1) << (desc.exp_bits - 1)) - 1;
+    const int_fast32_t emin = 16384 - bias;
+    const int_fast32_t emax = 16383 + bias;
+    const uint64_t fracHi = UINT64_C(0x0000FFFFFFFFFFFF);
+    const uint64_t keepHi = (shift >= 64) ? ~((UINT64_C(1) << (shift - 64)) - 1) : ~UINT64_C(0);
+    const uint64_t keepLo = (shift >= 64) ? 0 : ~((UINT64_C(1) << shift) - 1);
+    const uint64_t sign = a.v[softfloat_f128Hi] & UINT64_C(0x8000000000000000);
+    uint64_t hi = a.v[softfloat_f128Hi] ^ sign, lo = a.v[!softfloat_f128Hi];
+    int_fast32_t exp = (int_fast32_t) (hi >> 48);
+    uint64_t maskHi, maskLo, sigHi, incHi = 0, incLo = 0, maxHi, maxLo, t;
+    float128_t z;
+    int dist;
+
+    if(exp == 0x7FFF)
+    {
+        if(!((hi & fracHi) | lo))
+            return a;
+        z.v[softfloat_f128Hi] = UINT64_C(0x7FFF800000000000) | (hi & keepHi);
+        z.v[!softfloat_f128Hi] = lo & keepLo;
+        return z;
+    }
+
+    // Rounding position: 'shift' for normals, further left below the normal range
+    dist = shift + ((exp < emin) ? emin - (exp ? exp : 1) : 0);
+    if(dist > 127)
+        dist = 127;
+    maskHi = (dist >= 64) ? (UINT64_C(1) << (dist - 64)) - 1 : 0;
+    maskLo = (dist >= 64) ? ~UINT64_C(0) : (UINT64_C(1) << dist) - 1;
+    // High word of the significand with the implicit bit
+    sigHi = exp ? ((hi & fracHi) | UINT64_C(0x0001000000000000)) : hi;
+
+    switch(roundingMode)
+    {
+        case softfloat_round_near_even:
+            if(dist)
+            {
+                incHi = maskHi >> 1;
+                incLo = (maskLo >> 1) | (maskHi << 63);
+                t = (dist >= 64) ? (sigHi >> (dist - 64)) & 1 : (lo >> dist) & 1;
+                incLo += t;
+                incHi += (incLo < t);
+            }
+            break;
+        case softfloat_round_near_maxMag:
+            if(dist)
+            {
+                incHi = (dist > 64) ? UINT64_C(1) << (dist - 65) : 0;
+                incLo = (dist > 64) ? 0 : UINT64_C(1) << (dist - 1);
+            }
+            break;
+        case softfloat_round_min:
+            if(sign)
+            {
+                incHi = maskHi;
+                incLo = maskLo;
+            }
+            break;
+        case softfloat_round_max:
+            if(!sign)
+            {
+                incHi = maskHi;
+                incLo = maskLo;
+            }
+            break;
+        default: // minMag, odd
+            break;
+    }
+
+    if(dist > 112)
+    {
+        // Below the smallest subnormal: the result is zero or that subnormal
+        t = lo + incLo;
+        bool up = ((sigHi + incHi + (t < lo)) >> (dist - 64))
+            || ((roundingMode == softfloat_round_odd) && (sigHi | lo));
+        z.v[softfloat_f128Hi] = sign | (up ? (uint64_t) (emin - desc.frac_bits) << 48 : 0);
+        z.v[!softfloat_f128Hi] = 0;
+        return z;
+    }
+
+    // Round to odd: jam into the last kept bit (at dist 112 that bit is the
+    // implicit one, already set for normals)
+    if((roundingMode == softfloat_round_odd) && ((hi & maskHi) | (lo & maskLo)) && ((dist < 112) || !exp))
+    {
+        if(dist >= 64)
+            hi |= UINT64_C(1) << (dist - 64);
+        else
+            lo |= UINT64_C(1) << dist;
     }
+    t = lo + incLo;
+    hi += incHi + (t < lo);
+    lo = t;
+    hi &= ~maskHi;
+    lo &= ~maskLo;
 
-    // Empty constructor --> initialize to positive zero.
-    INLINE flexfloat ()
+    maxHi = ((uint64_t) emax << 48) | (fracHi & keepHi);
+    maxLo = keepLo;
+    if((hi > maxHi) || ((hi == maxHi) && (lo > maxLo)))
+    {
+        // Overflow: infinity, or the largest finite value when rounding toward zero
+        bool toInf = (roundingMode == softfloat_round_near_even)
+            || (roundingMode == softfloat_round_near_maxMag)
+            || (roundingMode == (sign ? softfloat_round_min : softfloat_round_max));
+        hi = toInf ? UINT64_C(0x7FFF000000000000) : maxHi;
+        lo = toInf ? 0 : maxLo;
+    }
+    z.v[softfloat_f128Hi] = sign | hi;
+    z.v[!softfloat_f128Hi] = lo;
+    return z;
+}
+
+/* STATISTICS */
+
+// flexfloat_stats_valueUI for a binary128 rounding from 'a' to 'z'
+static INLINE void flexfloat_stats_valueF128(const flexfloat_desc_t desc, const float128_t &a, const float128_t &z)
+{
+    const int_fast32_t bias = flexfloat_bias(desc);
+    const uint64_t hi = a.v[softfloat_f128Hi] & UINT64_C(0x7FFFFFFFFFFFFFFF), lo = a.v[!softfloat_f128Hi];
+    const uint64_t zHi = z.v[softfloat_f128Hi] & UINT64_C(0x7FFFFFFFFFFFFFFF), zLo = z.v[!softfloat_f128Hi];
+    const int shift = 112 - desc.frac_bits;
+    const uint64_t maxHi = ((uint64_t) (16383 + bias) << 48)
+        | (UINT64_C(0x0000FFFFFFFFFFFF) & ((shift >= 64) ? ~((UINT64_C(1) << (shift - 64)) - 1) : ~UINT64_C(0)));
+    const uint64_t maxLo = (shift >= 64) ? 0 : ~((UINT64_C(1) << shift) - 1);
+    int_fast32_t exp = (int_fast32_t) (zHi >> 48);
+    uint_fast8_t flags = 0;
+
+    if((hi >> 48) != 0x7FFF)
     {
+        if((hi > maxHi) || ((hi == maxHi) && (lo > maxLo)))
+            flags |= flexfloat_stats_overflow;
+        else if((hi | lo) && !(zHi | zLo))
+            flags |= flexfloat_stats_underflow;
+        if(memcmp(&a, &z, sizeof(a)))
+            flags |= flexfloat_stats_inexact;
+    }
+    if(exp == 0x7FFF)
+        exp = flexfloat_inf_exp(desc);
+    else if(exp)
+        exp = (exp - 16383 + bias > 0) ? exp - 16383 + bias : 0;
+    flexfloat_stats_value(desc, exp, flags);
+}
+
+#ifdef FLEXFLOAT_STATS
+#define FLEXFLOAT_STATS_VALUE_F128(desc, a, z) flexfloat_stats_valueF128((desc), (a), (z))
+#else
+#define FLEXFLOAT_STATS_VALUE_F128(desc, a, z) ((void) 0)
+#endif
+
+/* BACKENDS */
+
+// Each flexfloat<e, f> computes in the cheapest working type that gives the
+// same results as an exact computation rounded once to <e, f>:
+// - float, when 2 * (f + 1) + 2 <= 24 and e <= 8, so that rounding first to
+//   binary32 and then to <e, f> is innocuous for +, -, *, / (the format has
+//   the exponent range of binary32 at most, and its subnormals lie on the
+//   binary32 grid). This holds for round-to-nearest-even only; in the other
+//   modes these formats take the binary64 path below;
+// - double, up to the binary64 exponent range and precision. The binary64
+//   intermediate of +, -, *, / is rounded to odd (flexfloat_addF64UI and
+//   friends), so that rounding it to <e, f> is correct in every mode;
+// - binary128 (float128_t) for wider formats, up to e = 15 and f = 112, with
+//   the binary128 intermediate rounded to odd in the same way.
+// With FLEXFLOAT_ON_SOFTFLOAT the binary32/binary64 working types are
+// float32_t/float64_t and the arithmetic is done by SoftFloat.
+
+// Arithmetic on a working type: host operators for float/double, softfloat_*
+// for the SoftFloat types
+template <typename W> struct flexfloat_arith {
+    static INLINE W add(const W &a, const W &b) { return softfloat_add(a, b); }
+    static INLINE W sub(const W &a, const W &b) { return softfloat_sub(a, b); }
+    static INLINE W mul(const W &a, const W &b) { return softfloat_mul(a, b); }
+    static INLINE W div(const W &a, const W &b) { return softfloat_div(a, b); }
+    static INLINE W neg(const W &a) { return softfloat_neg(a); }
+    static INLINE bool eq(const W &a, const W &b) { return softfloat_eq(a, b); }
+    static INLINE bool ne(const W &a, const W &b) { return !softfloat_eq(a, b); }
+    static INLINE bool gt(const W &a, const W &b) { return !softfloat_le(a, b); }
+    static INLINE bool lt(const W &a, const W &b) { return softfloat_lt(a, b); }
+    static INLINE bool ge(const W &a, const W &b) { return !softfloat_lt(a, b); }
+    static INLINE bool le(const W &a, const W &b) { return softfloat_le(a, b); }
+};
+
+template <typename W> struct flexfloat_host_arith {
+    static INLINE W add(const W &a, const W &b) { return a + b; }
+    static INLINE W sub(const W &a, const W &b) { return a - b; }
+    static INLINE W mul(const W &a, const W &b) { return a * b; }
+    static INLINE W div(const W &a, const W &b) { return a / b; }
+    static INLINE W neg(const W &a) { return -a; }
+    static INLINE bool eq(const W &a, const W &b) { return a == b; }
+    static INLINE bool ne(const W &a, const W &b) { return a != b; }
+    static INLINE bool gt(const W &a, const W &b) { return a > b; }
+    static INLINE bool lt(const W &a, const W &b) { return a < b; }
+    static INLINE bool ge(const W &a, const W &b) { return a >= b; }
+    static INLINE bool le(const W &a, const W &b) { return a <= b; }
+};
+
+template <> struct flexfloat_arith<float> : flexfloat_host_arith<float> { };
+template <> struct flexfloat_arith<double> : flexfloat_host_arith<double> { };
+
+// Binary64 encoding of any value a flexfloat can be built from
+template <typename U> static INLINE uint64_t flexfloat_toF64UI(const U &w) {
     #ifdef FLEXFLOAT_ON_DOUBLE
-        v.value = 0.0;
+    double d = double(w);
     #else
-        v.value = i64_to_f64(0UL);
+    float64_t d = softfloat_cast<U, float64_t>(w);
     #endif
-        v.desc.exp_bits = exp_bits;
-        v.desc.frac_bits = frac_bits;
+    uint64_t ui;
+    memcpy(&ui, &d, sizeof(ui));
+    return ui;
+}
+
+// 64-bit integers through a binary64 value rounded to odd, so that they are
+// rounded only once
+static INLINE uint64_t flexfloat_toF64UI(const long &w) { return flexfloat_fromUI64((w < 0) ? -(uint64_t) w : (uint64_t) w, w < 0); }
+static INLINE uint64_t flexfloat_toF64UI(const long long &w) { return flexfloat_fromUI64((w < 0) ? -(uint64_t) w : (uint64_t) w, w < 0); }
+static INLINE uint64_t flexfloat_toF64UI(const unsigned long &w) { return flexfloat_fromUI64(w, false); }
+static INLINE uint64_t flexfloat_toF64UI(const unsigned long long &w) { return flexfloat_fromUI64(w, false); }
+
+static INLINE uint64_t flexfloat_toF64UI(const float32_t &w) { return f32_to_f64(w).v; }
+static INLINE uint64_t flexfloat_toF64UI(const float64_t &w) { return w.v; }
+static INLINE uint64_t flexfloat_toF64UI(const float128_t &w) { return f128M_to_f64(&w).v; }
+
+// Working type from a binary64 encoding it represents exactly
+template <typename W> static INLINE W flexfloat_fromF64UI(uint64_t ui);
+
+template <> INLINE double flexfloat_fromF64UI<double>(uint64_t ui) {
+    double d;
+    memcpy(&d, &ui, sizeof(d));
+    return d;
+}
+
+template <> INLINE float flexfloat_fromF64UI<float>(uint64_t ui) {
+    return float(flexfloat_fromF64UI<double>(ui));
+}
+
+template <> INLINE float64_t flexfloat_fromF64UI<float64_t>(uint64_t ui) {
+    float64_t d;
+    d.v = ui;
+    return d;
+}
+
+template <> INLINE float32_t flexfloat_fromF64UI<float32_t>(uint64_t ui) {
+    return f64_to_f32(flexfloat_fromF64UI<float64_t>(ui));
+}
+
+// Binary32 encodings of the binary32 working types
+static INLINE uint32_t flexfloat_toF32UI(const float &w) {
+    uint32_t ui;
+    memcpy(&ui, &w, sizeof(ui));
+    return ui;
+}
+
+static INLINE uint32_t flexfloat_toF32UI(const float32_t &w) { return w.v; }
+
+template <typename W> static INLINE W flexfloat_fromF32UI(uint32_t ui);
+
+template <> INLINE float flexfloat_fromF32UI<float>(uint32_t ui) {
+    float f;
+    memcpy(&f, &ui, sizeof(f));
+    return f;
+}
+
+template <> INLINE float32_t flexfloat_fromF32UI<float32_t>(uint32_t ui) {
+    float32_t f;
+    f.v = ui;
+    return f;
+}
+
+// Conversions and printing shared by the binary32 and binary64 backends
+template <typename W, uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend_common {
+    typedef W value_type;
+    typedef flexfloat_arith<W> arith;
+
+    static INLINE flexfloat_desc_t desc() {
+        flexfloat_desc_t d = { exp_bits, frac_bits };
+        return d;
     }
 
-    INLINE flexfloat (const flexfloat &o) {
-        v.value = o.getValue();
-        v.desc.exp_bits = exp_bits;
-        v.desc.frac_bits = frac_bits;
+    template <typename U> static INLINE W from(const U &w) {
+        uint64_t a = flexfloat_toF64UI(w), z = flexfloat_sanitizeUI(a, desc());
+        FLEXFLOAT_STATS_VALUE_UI(desc(), a, z);
+        return flexfloat_fromF64UI<W>(z);
     }
 
-   INLINE flexfloat (flexfloat &&o) noexcept : v(o.v) {  } ;
+    // Round binary128 directly, not through binary64
+    static INLINE W from(const float128_t &w) {
+        float128_t z = flexfloat_roundF128(w, desc(), softfloat_roundingMode);
+        FLEXFLOAT_STATS_VALUE_F128(desc(), w, z);
+        return flexfloat_fromF64UI<W>(flexfloat_toF64UI(z));
+    }
 
+    // Fused operations: one rounding of the exact result (see flexfloat_mulAddF64UI)
+    static INLINE W fma(const W &a, const W &b, const W &c) {
+        float64_t z;
+        z.v = flexfloat_mulAddF64UI(flexfloat_toF64UI(a), flexfloat_toF64UI(b), flexfloat_toF64UI(c),
+            desc(), softfloat_roundingMode);
+        return from(z);
+    }
 
-   INLINE flexfloat& operator = (const flexfloat &o) {
-        v.value = o.getValue();
-        v.desc.exp_bits = exp_bits;
-        v.desc.frac_bits = frac_bits;
-        return *this;
+    static INLINE W sqrt(const W &a) {
+        float64_t z;
+        z.v = flexfloat_sqrtF64UI(flexfloat_toF64UI(a), desc(), softfloat_roundingMode);
+        return from(z);
     }
 
-    INLINE flexfloat& operator = (const flexfloat &&o) noexcept {
-        v = o.v;
-        return *this;
+    // Basic operations, through the binary64 result rounded to odd (see
+    // flexfloat_addF64UI)
+    static INLINE W add(const W &a, const W &b) {
+        float64_t z;
+        z.v = flexfloat_addF64UI(flexfloat_toF64UI(a), flexfloat_toF64UI(b), desc(), softfloat_roundingMode);
+        return from(z);
     }
 
-    // Constructor from flexfloat types
-    template <uint_fast8_t e, uint_fast8_t f> INLINE flexfloat (const flexfloat<e, f> &w) {
-        v.value = w.getValue();
-        v.desc.exp_bits = exp_bits;
-        v.desc.frac_bits = frac_bits;
-        flexfloat_sanitize(&v);
+    static INLINE W sub(const W &a, const W &b) {
+        float64_t z;
+        z.v = flexfloat_subF64UI(flexfloat_toF64UI(a), flexfloat_toF64UI(b), desc(), softfloat_roundingMode);
+        return from(z);
     }
 
-    // Constructor from softfloat types
-    template <typename U> INLINE flexfloat (const softfloat<U> &w) {
-        #ifdef FLEXFLOAT_ON_DOUBLE
-        v.value = double(U(w));
-        #else
-        v.value = softfloat_cast<U,float64_t>(U(w));
-        #endif
-        v.desc.exp_bits = exp_bits;
-        v.desc.frac_bits = frac_bits;
-        flexfloat_sanitize(&v);
+    static INLINE W mul(const W &a, const W &b) {
+        float64_t z;
+        z.v = flexfloat_mulF64UI(flexfloat_toF64UI(a), flexfloat_toF64UI(b), desc(), softfloat_roundingMode);
+        return from(z);
     }
 
+    static INLINE W div(const W &a, const W &b) {
+        float64_t z;
+        z.v = flexfloat_divF64UI(flexfloat_toF64UI(a), flexfloat_toF64UI(b), desc(), softfloat_roundingMode);
+        return from(z);
+    }
 
-    // Constructor from castable type
-    template <typename U> INLINE flexfloat (const U &w)
-    {
-        #ifdef FLEXFLOAT_ON_DOUBLE
-        v.value = double(w);
-        #else
-        float64_t result = softfloat_cast<U,float64_t>(w);
-        CAST_TO_INT64(v.value) = result.v;
-        #endif
-        v.desc.exp_bits = exp_bits;
-        v.desc.frac_bits = frac_bits;
+    // Exact operations
+    static INLINE W minMax(const W &a, const W &b, bool max) {
+        return flexfloat_fromF64UI<W>(flexfloat_minMaxUI(flexfloat_toF64UI(a), flexfloat_toF64UI(b), max));
+    }
 
-        flexfloat_sanitize(&v);
+    static INLINE W abs(const W &a) {
+        return flexfloat_fromF64UI<W>(flexfloat_toF64UI(a) & UINT64_C(0x7FFFFFFFFFFFFFFF));
     }
 
+    static INLINE float64_t toF64(const W &x) {
+        float64_t d;
+        d.v = flexfloat_toF64UI(x);
+        return d;
+    }
 
-    /*------------------------------------------------------------------------
-    | OPERATOR OVERLOADS: CASTS
-    *------------------------------------------------------------------------*/
+    static INLINE int_fast32_t toI32(const W &x, uint_fast8_t roundingMode, bool exact) { return f64_to_i32(toF64(x), roundingMode, exact); }
+    static INLINE uint_fast32_t toUI32(const W &x, uint_fast8_t roundingMode, bool exact) { return f64_to_ui32(toF64(x), roundingMode, exact); }
+    static INLINE int_fast64_t toI64(const W &x, uint_fast8_t roundingMode, bool exact) { return f64_to_i64(toF64(x), roundingMode, exact); }
+    static INLINE uint_fast64_t toUI64(const W &x, uint_fast8_t roundingMode, bool exact) { return f64_to_ui64(toF64(x), roundingMode, exact); }
 
-    INLINE explicit operator flexfloat_t() const {
-        return v;
+    static INLINE double toDouble(const W &x) {
+        return flexfloat_fromF64UI<double>(flexfloat_toF64UI(x));
     }
 
-    INLINE explicit operator float() const {
-        return float(*(reinterpret_cast<const double *>(&(v.value))));
+    static INLINE long double toLongDouble(const W &x) {
+        return (long double)(toDouble(x));
     }
 
-    INLINE explicit operator double() const {
-        return *(reinterpret_cast<const double *>(&(v.value)));
+    // Native encoding, for printing
+    static INLINE bool sign(const W &x) { return signF64UI(flexfloat_toF64UI(x)); }
+    static INLINE uint_fast16_t exp(const W &x) { return flexfloat_expUI(flexfloat_toF64UI(x), desc()); }
+    static INLINE bool fracBit(const W &x, int i) { return (flexfloat_fracUI(flexfloat_toF64UI(x), desc()) >> i) & 1; }
+};
+
+// Working type double (float64_t)
+template <typename W, uint_fast8_t exp_bits, uint_fast8_t frac_bits>
+struct flexfloat_backend_f64 : flexfloat_backend_common<W, exp_bits, frac_bits> {
+    typedef flexfloat_backend_common<W, exp_bits, frac_bits> base;
+    typedef typename base::arith arith;
+    using base::from;
+
+    static INLINE W neg(const W &a) { return from(arith::neg(a)); }
+};
+
+// Working type float (float32_t), rounded by the binary32 kernel. Other
+// rounding modes than round-to-nearest-even take the binary64 path of the
+// wider formats, whose intermediate is rounded to odd.
+template <typename W, uint_fast8_t exp_bits, uint_fast8_t frac_bits>
+struct flexfloat_backend_f32 : flexfloat_backend_common<W, exp_bits, frac_bits> {
+    typedef flexfloat_backend_common<W, exp_bits, frac_bits> base;
+    typedef typename base::arith arith;
+    using base::desc;
+    using base::from;
+
+    static INLINE W from(const W &w) {
+        W z = flexfloat_fromF32UI<W>(flexfloat_roundF32UI(flexfloat_toF32UI(w), desc(), softfloat_roundingMode));
+        FLEXFLOAT_STATS_VALUE_UI(desc(), flexfloat_toF64UI(w), flexfloat_toF64UI(z));
+        return z;
     }
 
-    INLINE explicit operator long double() const {
-        return (long double)(*(reinterpret_cast<const double *>(&(v.value))));
+    static INLINE W add(const W &a, const W &b) {
+        if(softfloat_roundingMode == softfloat_round_near_even)
+            return from(arith::add(a, b));
+        return base::add(a, b);
     }
 
-    /*------------------------------------------------------------------------
-    | OPERATOR OVERLOADS: Arithmetics
-    *------------------------------------------------------------------------*/
+    static INLINE W sub(const W &a, const W &b) {
+        if(softfloat_roundingMode == softfloat_round_near_even)
+            return from(arith::sub(a, b));
+        return base::sub(a, b);
+    }
 
-    /* UNARY MINUS (-) */
-    INLINE flexfloat operator-() const
-    {
+    static INLINE W mul(const W &a, const W &b) {
+        if(softfloat_roundingMode == softfloat_round_near_even)
+            return from(arith::mul(a, b));
+        return base::mul(a, b);
+    }
 
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return flexfloat(- v.value);
-    #else
-        return flexfloat(softfloat_sub(ui64_to_f64(0L), v.value));
-    #endif
+    static INLINE W div(const W &a, const W &b) {
+        if(softfloat_roundingMode == softfloat_round_near_even)
+            return from(arith::div(a, b));
+        return base::div(a, b);
     }
 
-    /* UNARY PLUS (+) */
-    INLINE flexfloat operator+() const
+    static INLINE W neg(const W &a) { return from(arith::neg(a)); }
+};
+
+static INLINE void flexfloat_softOpF128(int op, const float128_t &a, const float128_t &b, const float128_t &c,
+    float128_t &z)
+{
+    switch(op)
     {
-        return flexfloat(v.value);
+        case flexfloat_soft_mulAdd:
+            f128M_mulAdd(&a, &b, &c, &z);
+            break;
+        case flexfloat_soft_sqrt:
+            f128M_sqrt(&a, &z);
+            break;
+        case flexfloat_soft_add:
+            f128M_add(&a, &b, &z);
+            break;
+        case flexfloat_soft_mul:
+            f128M_mul(&a, &b, &z);
+            break;
+        default:
+            f128M_div(&a, &b, &z);
+            break;
     }
+}
 
-    /* ADD (+) */
-    friend INLINE flexfloat operator+(const flexfloat &a, const flexfloat &b)
+// Binary128 counterpart of flexfloat_softF64UI. The result is rounded to odd
+// up to frac_bits = 110 and in round-to-odd mode, in 'roundingMode' otherwise;
+// either way one flexfloat_roundF128 completes it.
+static INLINE float128_t flexfloat_softF128(int op, const float128_t &a, const float128_t &b, const float128_t &c,
+    const flexfloat_desc_t desc, uint_fast8_t roundingMode)
+{
+    const uint_fast8_t mode = softfloat_roundingMode, flags = softfloat_exceptionFlags;
+    const bool odd = (desc.frac_bits <= 110) || (roundingMode == softfloat_round_odd);
+    float128_t z;
+
+    softfloat_roundingMode =
+        odd ? (uint_fast8_t) softfloat_round_minMag : roundingMode;
+    softfloat_exceptionFlags = 0;
+    flexfloat_softOpF128(op, a, b, c, z);
+    if(odd && (softfloat_exceptionFlags & softfloat_flag_inexact))
+        z.v[!softfloat_f128Hi] |= 1;
+    else if(odd && ((op == flexfloat_soft_mulAdd) || (op == flexfloat_soft_add))
+        && !(z.v[softfloat_f128Hi] & UINT64_C(0x7FFFFFFFFFFFFFFF)) && !z.v[!softfloat_f128Hi])
     {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return flexfloat(a.v.value + b.v.value);
-    #else
-        return flexfloat(softfloat_add(a.v.value, b.v.value));
-    #endif
+        // Exact zero sum: its sign depends on the rounding mode
+        softfloat_roundingMode = roundingMode;
+        flexfloat_softOpF128(op, a, b, c, z);
     }
+    softfloat_roundingMode = mode;
+    softfloat_exceptionFlags = flags;
+    return z;
+}
 
-     /* SUB (-) */
-    friend INLINE flexfloat operator-(const flexfloat &a, const flexfloat &b)
-    {
+// Working type float128_t, for formats wider than binary64
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend_f128 {
+    typedef float128_t value_type;
+    typedef flexfloat_arith<float128_t> arith;
 
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return flexfloat(a.v.value - b.v.value);
-    #else
-        return flexfloat(softfloat_sub(a.v.value, b.v.value));
-    #endif
+    static INLINE flexfloat_desc_t desc() {
+        flexfloat_desc_t d = { exp_bits, frac_bits };
+        return d;
     }
 
-     /* MUL (-) */
-    friend INLINE flexfloat operator*(const flexfloat &a, const flexfloat &b)
-    {
-
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return flexfloat(a.v.value * b.v.value);
-    #else
-        return flexfloat(softfloat_mul(a.v.value, b.v.value));
-    #endif
+    template <typename U> static INLINE float128_t from(const U &w) {
+        return from(softfloat_cast<U, float128_t>(w));
     }
 
-     /* DIV (/) */
-    friend INLINE flexfloat operator/(const flexfloat &a, const flexfloat &b)
-    {
+    static INLINE float128_t from(const float128_t &w) {
+        float128_t z = flexfloat_roundF128(w, desc(), softfloat_roundingMode);
+        FLEXFLOAT_STATS_VALUE_F128(desc(), w, z);
+        return z;
+    }
 
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return flexfloat(a.v.value / b.v.value);
-    #else
-        return flexfloat(softfloat_div(a.v.value, b.v.value));
-    #endif
+    static INLINE float128_t add(const float128_t &a, const float128_t &b) {
+        return from(flexfloat_softF128(flexfloat_soft_add, a, b, b, desc(), softfloat_roundingMode));
     }
 
-    /*------------------------------------------------------------------------
-    | OPERATOR OVERLOADS: Relational operators
-    *------------------------------------------------------------------------*/
+    static INLINE float128_t sub(const float128_t &a, const float128_t &b) {
+        return add(a, arith::neg(b));
+    }
 
-    /* EQUALITY (==) */
-    INLINE bool operator==(const flexfloat &b) const {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return (v.value == b.v.value);
-    #else
-        return softfloat_eq(v.value,b.v.value);
-    #endif
+    static INLINE float128_t mul(const float128_t &a, const float128_t &b) {
+        return from(flexfloat_softF128(flexfloat_soft_mul, a, b, b, desc(), softfloat_roundingMode));
     }
 
-    /* INEQUALITY (!=) */
-    INLINE bool operator!=(const flexfloat &b) const {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return (v.value != b.v.value);
-    #else
-        return !(softfloat_eq(v.value,b.v.value));
-    #endif
+    static INLINE float128_t div(const float128_t &a, const float128_t &b) {
+        return from(flexfloat_softF128(flexfloat_soft_div, a, b, b, desc(), softfloat_roundingMode));
     }
 
-    /* GREATER-THAN (>) */
-    INLINE bool operator>(const flexfloat &b) const {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return (v.value > b.v.value);
-    #else
-        return !(softfloat_le(v.value,b.v.value));
-    #endif
+    static INLINE float128_t neg(const float128_t &a) { return from(arith::neg(a)); }
+
+    static INLINE float128_t fma(const float128_t &a, const float128_t &b, const float128_t &c) {
+        return from(flexfloat_softF128(flexfloat_soft_mulAdd, a, b, c, desc(), softfloat_roundingMode));
     }
 
-    /* LESS-THAN (<) */
-    INLINE bool operator<(const flexfloat &b) const {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return (v.value < b.v.value);
-    #else
-        return softfloat_lt(v.value,b.v.value);
-    #endif
+    static INLINE float128_t sqrt(const float128_t &a) {
+        return from(flexfloat_softF128(flexfloat_soft_sqrt, a, a, a, desc(), softfloat_roundingMode));
     }
 
-    /* GREATER-THAN-OR-EQUAL-TO (>=) */
-    INLINE bool operator>=(const flexfloat &b) const {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return (v.value >= b.v.value);
-    #else
-        return !(softfloat_lt(v.value,b.v.value));
-    #endif
+    static INLINE bool isNaN(const float128_t &a) {
+        return ((a.v[softfloat_f128Hi] & UINT64_C(0x7FFF000000000000)) == UINT64_C(0x7FFF000000000000))
+            && ((a.v[softfloat_f128Hi] & UINT64_C(0x0000FFFFFFFFFFFF)) || a.v[!softfloat_f128Hi]);
     }
 
-    /* LESS-THAN-OR-EQUAL-TO (<=) */
-    INLINE bool operator<=(const flexfloat &b) const {
-    #ifdef FLEXFLOAT_ON_DOUBLE
-        return (v.value <= b.v.value);
-    #else
-        return softfloat_le(v.value,b.v.value);
-    #endif
+    static INLINE float128_t minMax(const float128_t &a, const float128_t &b, bool max) {
+        if(isNaN(a))
+            return b;
+        if(isNaN(b))
+            return a;
+        // -0 below +0
+        bool lt = f128M_lt(&a, &b) || (f128M_eq(&a, &b) && sign(a) && !sign(b));
+        return (lt != max) ? a : b;
     }
 
-    /*------------------------------------------------------------------------
-    | OPERATOR OVERLOADS: Compound assignment operators (no bitwise ops)
-    *------------------------------------------------------------------------*/
-    INLINE flexfloat &operator+=(const flexfloat &b) {
-        return *this = *this + b;
+    static INLINE float128_t abs(const float128_t &a) {
+        float128_t z = a;
+        z.v[softfloat_f128Hi] &= UINT64_C(0x7FFFFFFFFFFFFFFF);
+        return z;
     }
 
-    INLINE flexfloat &operator-=(const flexfloat &b) {
-        return *this = *this - b;
+    static INLINE int_fast32_t toI32(const float128_t &x, uint_fast8_t roundingMode, bool exact) { return f128M_to_i32(&x, roundingMode, exact); }
+    static INLINE uint_fast32_t toUI32(const float128_t &x, uint_fast8_t roundingMode, bool exact) { return f128M_to_ui32(&x, roundingMode, exact); }
+    static INLINE int_fast64_t toI64(const float128_t &x, uint_fast8_t roundingMode, bool exact) { return f128M_to_i64(&x, roundingMode, exact); }
+    static INLINE uint_fast64_t toUI64(const float128_t &x, uint_fast8_t roundingMode, bool exact) { return f128M_to_ui64(&x, roundingMode, exact); }
+
+    static INLINE double toDouble(const float128_t &x) {
+        return flexfloat_fromF64UI<double>(f128M_to_f64(&x).v);
     }
 
-    INLINE flexfloat &operator*=(const flexfloat &b) {
-        return *this = *this * b;
+    static INLINE long double toLongDouble(const float128_t &x) {
+        extFloat80_t temp = softfloat_cast<float128_t, extFloat80_t>(x);
+        long double *result = reinterpret_cast<long double *>(&temp);
+        return *result;
     }
 
-    INLINE flexfloat &operator/=(const flexfloat &b) {
-        return *this = *this / b;
+    // Native encoding, for printing
+    static INLINE bool sign(const float128_t &x) { return x.v[softfloat_f128Hi] >> 63; }
+
+    static INLINE uint_fast16_t exp(const float128_t &x) {
+        int_fast32_t e = (int_fast32_t) ((x.v[softfloat_f128Hi] >> 48) & 0x7FFF);
+        if(e == 0x7FFF)
+            return flexfloat_inf_exp(desc());
+        e = e ? e - 16383 + flexfloat_bias(desc()) : 0;
+        return (e > 0) ? e : 0;
     }
 
-    /*------------------------------------------------------------------------
-    | OPERATOR OVERLOADS: IO streams operators
-    *------------------------------------------------------------------------*/
-    friend std::ostream& operator<<(std::ostream& os, const flexfloat& obj)
-    {
-        if(os.iword(get_manipulator_id()) == 0)
-        {
-            os << double(obj);
-        }
-        else
+    // Bit 'i' of the fraction field (subnormals are denormalized)
+    static INLINE bool fracBit(const float128_t &x, int i) {
+        int_fast32_t e = (int_fast32_t) ((x.v[softfloat_f128Hi] >> 48) & 0x7FFF);
+        int pos = 112 - frac_bits + i;
+        if((e != 0x7FFF) && e && (e - 16383 + flexfloat_bias(desc()) <= 0))
         {
-            os << flexfloat_sign(&(obj.v)) << "-";
-            os << std::bitset<exp_bits>(flexfloat_exp(&(obj.v))) << "-";
-            os << std::bitset<frac_bits>(flexfloat_frac(&(obj.v)));
+            pos += 1 - (e - 16383 + flexfloat_bias(desc()));
+            if(pos == 112)
+                return 1;
+            if(pos > 112)
+                return 0;
         }
-        return os;
+        return (pos >= 64) ? (x.v[softfloat_f128Hi] >> (pos - 64)) & 1 : (x.v[!softfloat_f128Hi] >> pos) & 1;
     }
+};
 
+// Backend selection. Binary32 rounded again to nearest even is correct up to
+// frac_bits = 10, and binary32 itself needs no second rounding.
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits,
+          int kind = ((exp_bits <= 8 && frac_bits <= 10) || (exp_bits == 8 && frac_bits == 23)) ? 0
+                   : (exp_bits <= 11 && frac_bits <= 52) ? 1 : 2>
+struct flexfloat_backend;
+
+#ifdef FLEXFLOAT_ON_DOUBLE
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend<exp_bits, frac_bits, 0> {
+    typedef flexfloat_backend_f32<float, exp_bits, frac_bits> type;
 };
 
-template <> class flexfloat<8, 23> {
-protected:
-    float v;
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend<exp_bits, frac_bits, 1> {
+    typedef flexfloat_backend_f64<double, exp_bits, frac_bits> type;
+};
+#else
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend<exp_bits, frac_bits, 0> {
+    typedef flexfloat_backend_f32<float32_t, exp_bits, frac_bits> type;
+};
+
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend<exp_bits, frac_bits, 1> {
+    typedef flexfloat_backend_f64<float64_t, exp_bits, frac_bits> type;
+};
+#endif
+
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_backend<exp_bits, frac_bits, 2> {
+    typedef flexfloat_backend_f128<exp_bits, frac_bits> type;
+};
+
+/* CLASS DEFINITION */
+
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> class flexfloat {
+    static_assert(exp_bits >= 2 && exp_bits <= 15, "flexfloat: exp_bits must be in [2, 15]");
+    static_assert(frac_bits >= 1 && frac_bits <= 112, "flexfloat: frac_bits must be in [1, 112]");
 
 public:
+    typedef typename flexfloat_backend<exp_bits, frac_bits>::type backend;
+    typedef typename backend::value_type value_type;
+
+protected:
+    value_type v;
+    #ifndef FLEXFLOAT_COMPACT
+    flexfloat_desc_t d;
 
-    INLINE float getValue() const {
+    INLINE void setDesc() { d = backend::desc(); }
+    #else
+    INLINE void setDesc() { }
+    #endif
+
+    // Wrap a value already rounded to <exp_bits, frac_bits>
+    static INLINE flexfloat wrap(const value_type &x) {
+        flexfloat r;
+        r.v = x;
+        return r;
+    }
+
+public:
+    INLINE value_type getValue() const {
         return v;
     }
 
     // Empty constructor --> initialize to positive zero.
-    INLINE flexfloat () { v = 0 ; }
+    INLINE flexfloat ()
+    {
+        memset(&v, 0, sizeof(v));
+        setDesc();
+    }
 
     INLINE flexfloat (const flexfloat &) = default;
     INLINE flexfloat (flexfloat &&) = default;
     INLINE flexfloat& operator = (const flexfloat &) = default;
+    INLINE flexfloat& operator = (flexfloat &&) = default;
 
     // Constructor from flexfloat types
     template <uint_fast8_t e, uint_fast8_t f> INLINE flexfloat (const flexfloat<e, f> &w) {
-        v = float(w.getValue());
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_cast);
+        v = backend::from(w.getValue());
+        setDesc();
     }
 
     // Constructor from softfloat types
     template <typename U> INLINE flexfloat (const softfloat<U> &w) {
-        v= float(U(w));
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_cast);
+        v = backend::from(softfloat_cast<U, float128_t>(U(w)));
+        setDesc();
     }
 
+
     // Constructor from castable type
     template <typename U> INLINE flexfloat (const U &w)
     {
-        v = float(w);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_cast);
+        v = backend::from(w);
+        setDesc();
     }
 
 
-
     /*------------------------------------------------------------------------
     | OPERATOR OVERLOADS: CASTS
     *------------------------------------------------------------------------*/
 
     INLINE explicit operator flexfloat_t() const {
-        return flexfloat_t();
+        flexfloat_t r;
+        #ifdef FLEXFLOAT_ON_DOUBLE
+        r.value = backend::toDouble(v);
+        #else
+        r.value.v = flexfloat_toF64UI(v);
+        #endif
+        r.desc = backend::desc();
+        return r;
     }
 
     INLINE explicit operator float() const {
-        return v;
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_cast);
+        return float(backend::toDouble(v));
     }
 
     INLINE explicit operator double() const {
-        return double(v);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_cast);
+        return backend::toDouble(v);
     }
 
     INLINE explicit operator long double() const {
-        return (long double)(v);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_cast);
+        return backend::toLongDouble(v);
     }
 
     /*------------------------------------------------------------------------
     | OPERATOR OVERLOADS: Arithmetics
     *------------------------------------------------------------------------*/
 
+    /* UNARY MINUS (-) */
+    INLINE flexfloat operator-() const
+    {
+        return wrap(backend::neg(v));
+    }
+
+    /* UNARY PLUS (+) */
+    INLINE flexfloat operator+() const
+    {
+        return *this;
+    }
+
     /* ADD (+) */
     friend INLINE flexfloat operator+(const flexfloat &a, const flexfloat &b)
     {
-        return flexfloat(a.v + b.v);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_add);
+        return wrap(backend::add(a.v, b.v));
     }
 
      /* SUB (-) */
     friend INLINE flexfloat operator-(const flexfloat &a, const flexfloat &b)
     {
-        return flexfloat(a.v - b.v);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_sub);
+        return wrap(backend::sub(a.v, b.v));
     }
 
      /* MUL (-) */
     friend INLINE flexfloat operator*(const flexfloat &a, const flexfloat &b)
     {
-        return flexfloat(a.v * b.v);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_mul);
+        return wrap(backend::mul(a.v, b.v));
     }
 
      /* DIV (/) */
     friend INLINE flexfloat operator/(const flexfloat &a, const flexfloat &b)
     {
-        return flexfloat(a.v / b.v);
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_div);
+        return wrap(backend::div(a.v, b.v));
+    }
+
+    /*------------------------------------------------------------------------
+    | Fused multiply-add, square root, min/max and absolute value, found by
+    | argument-dependent lookup like the <cmath> functions
+    *------------------------------------------------------------------------*/
+
+    friend INLINE flexfloat fma(const flexfloat &a, const flexfloat &b, const flexfloat &c)
+    {
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_fma);
+        return wrap(backend::fma(a.v, b.v, c.v));
+    }
+
+    friend INLINE flexfloat sqrt(const flexfloat &a)
+    {
+        FLEXFLOAT_STATS_OP(backend::desc(), flexfloat_op_sqrt);
+        return wrap(backend::sqrt(a.v));
+    }
+
+    friend INLINE flexfloat fmin(const flexfloat &a, const flexfloat &b) { return wrap(backend::minMax(a.v, b.v, false)); }
+    friend INLINE flexfloat fmax(const flexfloat &a, const flexfloat &b) { return wrap(backend::minMax(a.v, b.v, true)); }
+    friend INLINE flexfloat fabs(const flexfloat &a) { return wrap(backend::abs(a.v)); }
+    friend INLINE flexfloat abs(const flexfloat &a) { return wrap(backend::abs(a.v)); }
+
+    /*------------------------------------------------------------------------
+    | Conversions to integers, as f64_to_i32 and friends
+    *------------------------------------------------------------------------*/
+
+    friend INLINE int_fast32_t flexfloat_to_i32(const flexfloat &a, uint_fast8_t roundingMode = softfloat_roundingMode, bool exact = false) {
+        return backend::toI32(a.v, roundingMode, exact);
+    }
+
+    friend INLINE uint_fast32_t flexfloat_to_ui32(const flexfloat &a, uint_fast8_t roundingMode = softfloat_roundingMode, bool exact = false) {
+        return backend::toUI32(a.v, roundingMode, exact);
+    }
+
+    friend INLINE int_fast64_t flexfloat_to_i64(const flexfloat &a, uint_fast8_t roundingMode = softfloat_roundingMode, bool exact = false) {
+        return backend::toI64(a.v, roundingMode, exact);
+    }
+
+    friend INLINE uint_fast64_t flexfloat_to_ui64(const flexfloat &a, uint_fast8_t roundingMode = softfloat_roundingMode, bool exact = false) {
+        return backend::toUI64(a.v, roundingMode, exact);
     }
 
     /*------------------------------------------------------------------------
@@ -386,32 +855,32 @@ public:
 
     /* EQUALITY (==) */
     INLINE bool operator==(const flexfloat &b) const {
-        return v == b.v;
+        return backend::arith::eq(v, b.v);
     }
 
     /* INEQUALITY (!=) */
     INLINE bool operator!=(const flexfloat &b) const {
-        return v != b.v;
+        return backend::arith::ne(v, b.v);
     }
 
     /* GREATER-THAN (>) */
     INLINE bool operator>(const flexfloat &b) const {
-        return v > b.v;
+        return backend::arith::gt(v, b.v);
     }
 
     /* LESS-THAN (<) */
     INLINE bool operator<(const flexfloat &b) const {
-        return v < b.v;
+        return backend::arith::lt(v, b.v);
     }
 
     /* GREATER-THAN-OR-EQUAL-TO (>=) */
     INLINE bool operator>=(const flexfloat &b) const {
-        return v >= b.v;
+        return backend::arith::ge(v, b.v);
     }
 
     /* LESS-THAN-OR-EQUAL-TO (<=) */
     INLINE bool operator<=(const flexfloat &b) const {
-        return v <= b.v;
+        return backend::arith::le(v, b.v);
     }
 
     /*------------------------------------------------------------------------
@@ -438,7 +907,18 @@ public:
     *------------------------------------------------------------------------*/
     friend std::ostream& operator<<(std::ostream& os, const flexfloat& obj)
     {
-      os << float(obj);
+        if(os.iword(get_manipulator_id()) == 0)
+        {
+            os << double(obj);
+        }
+        else
+        {
+            os << backend::sign(obj.v) << "-";
+            os << std::bitset<exp_bits>(backend::exp(obj.v)) << "-";
+            for(int i = frac_bits - 1; i >= 0; --i)
+                os << backend::fracBit(obj.v, i);
+        }
+        return os;
     }
 
 };
@@ -0,0 +1,266 @@
+/*
+ * Bit-packed arrays of flexfloat values.
+ *
+ * flexfloat_packed_array<e, f> stores each value in its native encoding of
+ * 1 + e + f bits instead of a 16-byte flexfloat_t: a flexfloat<5, 10> takes
+ * 2 bytes and a flexfloat<4, 3> a single byte. With byte_aligned set, every
+ * element is padded to a whole number of bytes; otherwise elements are packed
+ * back to back at bit granularity.
+ *
+ * Elements are read as flexfloat<e, f> through operator[] and iterators and
+ * written with set(); pack() and unpack() convert whole ranges at once, and
+ * save()/load() move the array to and from a file.
+ *
+ *   flexfloat_packed_array<5, 10> w(n);
+ *   w.pack(weights, 0, n);          // double * -> 16 bits per value
+ *   w.save("weights.ffp");
+ */
+
+#pragma once
+#include "flexfloat.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits, bool byte_aligned = false>
+class flexfloat_packed_array {
+public:
+    typedef flexfloat<exp_bits, frac_bits> value_type;
+
+    // Bits of one encoding and distance between two consecutive elements
+    static const unsigned width = 1 + exp_bits + frac_bits;
+    static const unsigned stride = byte_aligned ? 8 * ((width + 7) / 8) : width;
+
+    static_assert(exp_bits >= 2 && exp_bits <= 11, "flexfloat_packed_array: exp_bits must be in [2, 11]");
+    static_assert(frac_bits >= 1 && frac_bits <= 52, "flexfloat_packed_array: frac_bits must be in [1, 52]");
+
+    class const_iterator {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef flexfloat<exp_bits, frac_bits> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type *pointer;
+        typedef value_type reference;
+
+        inline const_iterator() : a(0), i(0) {}
+        inline const_iterator(const flexfloat_packed_array *a, size_t i) : a(a), i(i) {}
+
+        inline reference operator*() const { return a->get(i); }
+        inline reference operator[](difference_type k) const { return a->get(i + k); }
+
+        inline const_iterator &operator++() { ++i; return *this; }
+        inline const_iterator operator++(int) { const_iterator t(*this); ++i; return t; }
+        inline const_iterator &operator--() { --i; return *this; }
+        inline const_iterator operator--(int) { const_iterator t(*this); --i; return t; }
+        inline const_iterator &operator+=(difference_type k) { i += k; return *this; }
+        inline const_iterator &operator-=(difference_type k) { i -= k; return *this; }
+        inline const_iterator operator+(difference_type k) const { return const_iterator(a, i + k); }
+        inline const_iterator operator-(difference_type k) const { return const_iterator(a, i - k); }
+        inline difference_type operator-(const const_iterator &o) const { return difference_type(i - o.i); }
+
+        inline bool operator==(const const_iterator &o) const { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const { return i != o.i; }
+        inline bool operator<(const const_iterator &o) const { return i < o.i; }
+        inline bool operator>(const const_iterator &o) const { return i > o.i; }
+        inline bool operator<=(const const_iterator &o) const { return i <= o.i; }
+        inline bool operator>=(const const_iterator &o) const { return i >= o.i; }
+
+    private:
+        const flexfloat_packed_array *a;
+        size_t i;
+    };
+
+    inline flexfloat_packed_array() : n(0) {}
+    inline explicit flexfloat_packed_array(size_t n) : w(words(n), 0), n(n) {}
+
+    inline size_t size() const { return n; }
+    inline bool empty() const { return n == 0; }
+
+    // Storage actually used by the encodings, in bytes
+    inline size_t bytes() const { return (n * stride + 7) / 8; }
+
+    // Resize; new elements are positive zero
+    inline void resize(size_t count) {
+        if (count < n)
+            for (size_t i = count; i < n; ++i)
+                write(i * stride, 0);
+        w.resize(words(count), 0);
+        n = count;
+    }
+
+    inline value_type get(size_t i) const { return decode(read(i * stride)); }
+    inline void set(size_t i, const value_type &x) { write(i * stride, encode(x)); }
+
+    inline value_type operator[](size_t i) const { return get(i); }
+
+    inline const_iterator begin() const { return const_iterator(this, 0); }
+    inline const_iterator end() const { return const_iterator(this, n); }
+
+    /*------------------------------------------------------------------------
+    | Bulk kernels: convert elements [first, first+count)
+    *------------------------------------------------------------------------*/
+
+    inline void pack(const value_type *in, size_t first, size_t count) {
+        size_t o = first * stride;
+        for (size_t i = 0; i < count; ++i, o += stride)
+            write(o, encode(in[i]));
+    }
+
+    // Values are rounded to <exp_bits, frac_bits> on the way in
+    inline void pack(const double *in, size_t first, size_t count) {
+        size_t o = first * stride;
+        for (size_t i = 0; i < count; ++i, o += stride)
+            write(o, encode(value_type(in[i])));
+    }
+
+    inline void unpack(value_type *out, size_t first, size_t count) const {
+        size_t o = first * stride;
+        for (size_t i = 0; i < count; ++i, o += stride)
+            out[i] = decode(read(o));
+    }
+
+    inline void unpack(double *out, size_t first, size_t count) const {
+        size_t o = first * stride;
+        for (size_t i = 0; i < count; ++i, o += stride)
+            out[i] = toDouble(flexfloat_decodeUI(read(o), desc()));
+    }
+
+    /*------------------------------------------------------------------------
+    | Serialization
+    |
+    | Layout: "FFPA", exp_bits, frac_bits, byte_aligned, 0, element count as a
+    | little-endian uint64, then bytes() bytes of packed encodings, least
+    | significant bit first.
+    *------------------------------------------------------------------------*/
+
+    inline bool save(FILE *fp) const {
+        unsigned char hdr[16] = { 'F', 'F', 'P', 'A', exp_bits, frac_bits, byte_aligned, 0 };
+        for (int k = 0; k < 8; ++k)
+            hdr[8 + k] = (unsigned char) (uint64_t(n) >> (8 * k));
+        if (fwrite(hdr, 1, sizeof(hdr), fp) != sizeof(hdr))
+            return false;
+
+        unsigned char buf[8 * 64];
+        size_t total = bytes(), done = 0;
+        while (done < total) {
+            size_t len = total - done < sizeof(buf) ? total - done : sizeof(buf);
+            for (size_t k = 0; k < len; ++k)
+                buf[k] = (unsigned char) (w[(done + k) / 8] >> (8 * ((done + k) % 8)));
+            if (fwrite(buf, 1, len, fp) != len)
+                return false;
+            done += len;
+        }
+        return true;
+    }
+
+    // Fails (leaving the array untouched) if the file holds another format,
+    // or an element count that does not fit in memory or in the file
+    inline bool load(FILE *fp) {
+        unsigned char hdr[16];
+        if (fread(hdr, 1, sizeof(hdr), fp) != sizeof(hdr))
+            return false;
+        if (memcmp(hdr, "FFPA", 4) || hdr[4] != exp_bits || hdr[5] != frac_bits
+            || hdr[6] != byte_aligned)
+            return false;
+        uint64_t count = 0;
+        for (int k = 0; k < 8; ++k)
+            count |= uint64_t(hdr[8 + k]) << (8 * k);
+        if (count > (SIZE_MAX - 63) / stride)
+            return false;
+        size_t total = (count * stride + 7) / 8, done = 0;
+
+        // A seekable file must hold the whole payload; for other streams the
+        // buffer only grows as bytes arrive, so a bad count cannot exhaust memory
+        long pos = ftell(fp);
+        if (pos >= 0 && fseek(fp, 0, SEEK_END) == 0) {
+            long end = ftell(fp);
+            if (end < pos || uint64_t(end - pos) < total || fseek(fp, pos, SEEK_SET))
+                return false;
+        }
+
+        std::vector<uint64_t> data;
+        unsigned char buf[8 * 64];
+        while (done < total) {
+            size_t len = total - done < sizeof(buf) ? total - done : sizeof(buf);
+            if (fread(buf, 1, len, fp) != len)
+                return false;
+            data.resize((done + len + 7) / 8, 0);
+            for (size_t k = 0; k < len; ++k)
+                data[(done + k) / 8] |= uint64_t(buf[k]) << (8 * ((done + k) % 8));
+            done += len;
+        }
+        data.resize(words(count), 0);
+        w.swap(data);
+        n = count;
+        return true;
+    }
+
+    inline bool save(const char *path) const {
+        FILE *fp = fopen(path, "wb");
+        if (!fp)
+            return false;
+        bool ok = save(fp);
+        return (fclose(fp) == 0) && ok;
+    }
+
+    inline bool load(const char *path) {
+        FILE *fp = fopen(path, "rb");
+        if (!fp)
+            return false;
+        bool ok = load(fp);
+        fclose(fp);
+        return ok;
+    }
+
+private:
+    std::vector<uint64_t> w;
+    size_t n;
+
+    static const uint64_t mask = (width == 64) ? ~UINT64_C(0) : ((UINT64_C(1) << (width % 64)) - 1);
+
+    static inline size_t words(size_t count) { return (count * stride + 63) / 64; }
+
+    static inline flexfloat_desc_t desc() {
+        flexfloat_desc_t d = { exp_bits, frac_bits };
+        return d;
+    }
+
+    static inline double toDouble(uint64_t ui) {
+        double d;
+        memcpy(&d, &ui, sizeof(d));
+        return d;
+    }
+
+    static inline uint64_t encode(const value_type &x) {
+        double d = double(x);
+        uint64_t ui;
+        memcpy(&ui, &d, sizeof(ui));
+        return flexfloat_encodeUI(ui, desc());
+    }
+
+    static inline value_type decode(uint64_t bits) {
+        return value_type(toDouble(flexfloat_decodeUI(bits, desc())));
+    }
+
+    // Encoding at bit offset 'o'; it may straddle two words.
+    inline uint64_t read(size_t o) const {
+        size_t k = o / 64;
+        unsigned s = o % 64;
+        uint64_t x = w[k] >> s;
+        if (s + width > 64)
+            x |= w[k + 1] << (64 - s);
+        return x & mask;
+    }
+
+    inline void write(size_t o, uint64_t x) {
+        size_t k = o / 64;
+        unsigned s = o % 64;
+        w[k] = (w[k] & ~(mask << s)) | (x << s);
+        if (s + width > 64)
+            w[k + 1] = (w[k + 1] & ~(mask >> (64 - s))) | (x >> (64 - s));
+    }
+};
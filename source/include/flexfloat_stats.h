@@ -0,0 +1,96 @@
+/* C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef flexfloat_stats_h
+#define flexfloat_stats_h 1
+
+#include "flexfloat.h"
+
+/*----------------------------------------------------------------------------
+| Per-format statistics for precision tuning: operation counts, a histogram
+| of the (biased) exponents of the values produced in each format, and counts
+| of the values that overflowed, were flushed to zero or were rounded.
+|
+| Collection is opt-in: compile with FLEXFLOAT_STATS defined (the library for
+| the C interface, each translation unit for flexfloat.hpp). Otherwise the
+| hooks below expand to nothing. Counters are kept per thread and merged when
+| they are read; read or reset them while no other thread is computing.
+*----------------------------------------------------------------------------*/
+
+enum {
+    flexfloat_op_add = 0,
+    flexfloat_op_sub,
+    flexfloat_op_mul,
+    flexfloat_op_div,
+    flexfloat_op_fma,
+    flexfloat_op_sqrt,
+    flexfloat_op_cast,
+    flexfloat_op_count
+};
+
+// Outcome of rounding a value to a format
+enum {
+    flexfloat_stats_overflow  = 1, // finite value beyond the largest finite one
+    flexfloat_stats_underflow = 2, // nonzero value flushed to zero
+    flexfloat_stats_inexact   = 4  // value changed by rounding
+};
+
+typedef struct {
+    uint64_t ops[flexfloat_op_count];
+    uint64_t values;
+    uint64_t overflow;
+    uint64_t underflow;
+    uint64_t inexact;
+} flexfloat_stats_t;
+
+// Recording (used through the hooks below)
+void flexfloat_stats_op(flexfloat_desc_t desc, int op);
+void flexfloat_stats_value(flexfloat_desc_t desc, int_fast32_t exp, uint_fast8_t flags);
+
+// Record a rounding from binary64 encoding 'a' to 'z' (the rounded value)
+static inline void flexfloat_stats_valueUI(flexfloat_desc_t desc, uint64_t a, uint64_t z)
+{
+    const uint64_t maxFinite = ((uint64_t) (1023 + flexfloat_bias(desc)) << 52)
+        | (UINT64_C(0x000FFFFFFFFFFFFF) & ~((UINT64_C(1) << (52 - desc.frac_bits)) - 1));
+    uint64_t mag = a & UINT64_C(0x7FFFFFFFFFFFFFFF);
+    uint_fast8_t flags = 0;
+
+    if(mag < UINT64_C(0x7FF0000000000000))
+    {
+        if(mag > maxFinite)
+            flags |= flexfloat_stats_overflow;
+        else if(mag && !(z & UINT64_C(0x7FFFFFFFFFFFFFFF)))
+            flags |= flexfloat_stats_underflow;
+        if(z != a)
+            flags |= flexfloat_stats_inexact;
+    }
+    flexfloat_stats_value(desc, flexfloat_expUI(z, desc), flags);
+}
+
+// Reading
+bool flexfloat_stats_get(flexfloat_desc_t desc, flexfloat_stats_t *stats);
+// Copy up to 'n' histogram bins (index = biased exponent); returns the number of bins of 'desc'
+size_t flexfloat_stats_histogram(flexfloat_desc_t desc, uint64_t *bins, size_t n);
+void flexfloat_stats_reset(void);
+
+// Dump every format seen so far
+void flexfloat_stats_report(FILE *fp);
+void flexfloat_stats_report_json(FILE *fp);
+
+// Hooks
+#ifdef FLEXFLOAT_STATS
+#define FLEXFLOAT_STATS_OP(desc, op) flexfloat_stats_op((desc), (op))
+#define FLEXFLOAT_STATS_VALUE_UI(desc, a, z) flexfloat_stats_valueUI((desc), (a), (z))
+#else
+#define FLEXFLOAT_STATS_OP(desc, op) ((void) 0)
+#define FLEXFLOAT_STATS_VALUE_UI(desc, a, z) ((void) 0)
+#endif
+
+#endif
+
+/* C++ */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,266 @@
+/*
+ * Precision sweeps: run one kernel for a grid of flexfloat formats in
+ * parallel and measure its error against a binary64 reference run.
+ *
+ * A kernel is a callable taking a type tag and the output vector; it runs its
+ * computation in tag's type and writes the results as doubles:
+ *
+ *   struct dot {
+ *       template <typename Tag> void operator()(Tag, std::vector<double> &out) const {
+ *           typedef typename Tag::type T;
+ *           T acc = 0;
+ *           for (size_t i = 0; i < n; ++i)
+ *               acc += T(x[i]) * T(y[i]);
+ *           out.assign(1, double(acc));
+ *       }
+ *   };
+ *
+ *   auto res = flexfloat_sweep(dot(), flexfloat_format_grid<5, 8, 2, 23>::type());
+ *   flexfloat_sweep_print(std::cout, res);
+ *
+ * The reference run uses double. Kernels written against the C interface
+ * take the descriptor instead (flexfloat_sweep_desc); their reference run
+ * uses the binary64 descriptor { 11, 52 }.
+ *
+ * Formats are spread over a pool of threads, one format per task. The kernel
+ * must therefore be safe to call concurrently and must not change the
+ * rounding mode. Every run uses the caller's rounding mode, tininess detection
+ * and stochastic seed, also when the library keeps them per thread
+ * (THREAD_LOCAL); the exception flags it raises are then discarded.
+ */
+
+#pragma once
+#include "flexfloat.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+template <typename T> struct flexfloat_sweep_type {
+    typedef T type;
+};
+
+/* FORMAT LISTS */
+
+template <uint_fast8_t exp_bits, uint_fast8_t frac_bits> struct flexfloat_format { };
+
+template <typename... F> struct flexfloat_formats { };
+
+template <typename A, typename B> struct flexfloat_formats_cat;
+
+template <typename... A, typename... B>
+struct flexfloat_formats_cat<flexfloat_formats<A...>, flexfloat_formats<B...> > {
+    typedef flexfloat_formats<A..., B...> type;
+};
+
+// frac_bits in [FMin, FMax] for one exp_bits
+template <uint_fast8_t e, uint_fast8_t FMin, uint_fast8_t FMax, bool done = (FMin > FMax)>
+struct flexfloat_format_row {
+    typedef typename flexfloat_formats_cat<flexfloat_formats<flexfloat_format<e, FMin> >,
+        typename flexfloat_format_row<e, FMin + 1, FMax>::type>::type type;
+};
+
+template <uint_fast8_t e, uint_fast8_t FMin, uint_fast8_t FMax>
+struct flexfloat_format_row<e, FMin, FMax, true> {
+    typedef flexfloat_formats<> type;
+};
+
+// Every format with exp_bits in [EMin, EMax] and frac_bits in [FMin, FMax]
+template <uint_fast8_t EMin, uint_fast8_t EMax, uint_fast8_t FMin, uint_fast8_t FMax, bool done = (EMin > EMax)>
+struct flexfloat_format_grid {
+    typedef typename flexfloat_formats_cat<typename flexfloat_format_row<EMin, FMin, FMax>::type,
+        typename flexfloat_format_grid<EMin + 1, EMax, FMin, FMax>::type>::type type;
+};
+
+template <uint_fast8_t EMin, uint_fast8_t EMax, uint_fast8_t FMin, uint_fast8_t FMax>
+struct flexfloat_format_grid<EMin, EMax, FMin, FMax, true> {
+    typedef flexfloat_formats<> type;
+};
+
+// Runtime grid of descriptors, for flexfloat_sweep_desc
+static inline std::vector<flexfloat_desc_t> flexfloat_desc_grid(int emin, int emax, int fmin, int fmax) {
+    std::vector<flexfloat_desc_t> grid;
+    for (int e = emin; e <= emax; ++e)
+        for (int f = fmin; f <= fmax; ++f) {
+            flexfloat_desc_t d = { (uint8_t) e, (uint8_t) f };
+            grid.push_back(d);
+        }
+    return grid;
+}
+
+/* RESULTS */
+
+struct flexfloat_sweep_result {
+    int exp_bits, frac_bits;
+    size_t n;           // outputs of the reference run
+    size_t bad;         // outputs missing, or NaN/infinite where the reference is finite
+    double max_abs;     // errors over the outputs that are finite in both runs
+    double mean_abs;
+    double rms;
+    double max_rel;     // relative to |reference|, over nonzero reference values
+    double seconds;     // wall time of the kernel run
+};
+
+static inline flexfloat_sweep_result flexfloat_sweep_compare(
+    int exp_bits, int frac_bits, const std::vector<double> &ref, const std::vector<double> &out, double seconds)
+{
+    flexfloat_sweep_result r = { exp_bits, frac_bits, ref.size(), 0, 0.0, 0.0, 0.0, 0.0, seconds };
+    double sum = 0.0, sum2 = 0.0;
+    size_t count = 0;
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        if (!std::isfinite(ref[i]))
+            continue;
+        if (i >= out.size() || !std::isfinite(out[i])) {
+            ++r.bad;
+            continue;
+        }
+        double err = std::fabs(out[i] - ref[i]);
+        sum += err;
+        sum2 += err * err;
+        ++count;
+        if (err > r.max_abs)
+            r.max_abs = err;
+        if (ref[i] != 0.0 && err / std::fabs(ref[i]) > r.max_rel)
+            r.max_rel = err / std::fabs(ref[i]);
+    }
+    if (count) {
+        r.mean_abs = sum / count;
+        r.rms = std::sqrt(sum2 / count);
+    }
+    return r;
+}
+
+/* DRIVER */
+
+// Run every task on 'threads' workers (0: one per hardware thread), in the
+// caller's rounding state. With a thread-local state the workers would start
+// from the defaults; with a shared one they already see the caller's, and
+// only write it if it differs so as not to race.
+static inline void flexfloat_sweep_run(std::vector<std::function<void()> > &tasks, unsigned threads) {
+    const uint_fast8_t roundingMode = softfloat_roundingMode, detectTininess = softfloat_detectTininess;
+    const uint_fast64_t seed = softfloat_stochasticSeed;
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> pool;
+
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    if (threads == 0)
+        threads = 1;
+    if (threads > tasks.size())
+        threads = (unsigned) tasks.size();
+
+    for (unsigned t = 0; t < threads; ++t)
+        pool.push_back(std::thread([&tasks, &next, roundingMode, detectTininess, seed]() {
+            if (softfloat_roundingMode != roundingMode)
+                softfloat_roundingMode = roundingMode;
+            if (softfloat_detectTininess != detectTininess)
+                softfloat_detectTininess = detectTininess;
+            if (softfloat_stochasticSeed != seed)
+                softfloat_stochasticSeed = seed;
+            for (size_t i; (i = next.fetch_add(1)) < tasks.size(); )
+                tasks[i]();
+        }));
+    for (size_t t = 0; t < pool.size(); ++t)
+        pool[t].join();
+}
+
+template <typename Kernel, typename Tag>
+static inline double flexfloat_sweep_time(const Kernel &kernel, Tag tag, std::vector<double> &out) {
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    kernel(tag, out);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+template <typename Kernel>
+static inline void flexfloat_sweep_tasks(const Kernel &, const std::vector<double> &,
+    flexfloat_formats<>, std::vector<flexfloat_sweep_result> &, std::vector<std::function<void()> > &) { }
+
+template <typename Kernel, uint_fast8_t e, uint_fast8_t f, typename... Rest>
+static inline void flexfloat_sweep_tasks(const Kernel &kernel, const std::vector<double> &ref,
+    flexfloat_formats<flexfloat_format<e, f>, Rest...>, std::vector<flexfloat_sweep_result> &results,
+    std::vector<std::function<void()> > &tasks)
+{
+    flexfloat_sweep_result *slot = &results[tasks.size()];
+    tasks.push_back([&kernel, &ref, slot]() {
+        std::vector<double> out;
+        double seconds = flexfloat_sweep_time(kernel, flexfloat_sweep_type<flexfloat<e, f> >(), out);
+        *slot = flexfloat_sweep_compare(e, f, ref, out, seconds);
+    });
+    flexfloat_sweep_tasks(kernel, ref, flexfloat_formats<Rest...>(), results, tasks);
+}
+
+// Run 'kernel' in double and in every format of the list; one result per format
+template <typename Kernel, typename... F>
+static inline std::vector<flexfloat_sweep_result> flexfloat_sweep(
+    const Kernel &kernel, flexfloat_formats<F...> formats, unsigned threads = 0)
+{
+    std::vector<double> ref;
+    std::vector<flexfloat_sweep_result> results(sizeof...(F));
+    std::vector<std::function<void()> > tasks;
+
+    kernel(flexfloat_sweep_type<double>(), ref);
+    flexfloat_sweep_tasks(kernel, ref, formats, results, tasks);
+    flexfloat_sweep_run(tasks, threads);
+    return results;
+}
+
+// Same for a kernel on the C interface: kernel(desc, out)
+template <typename Kernel>
+static inline std::vector<flexfloat_sweep_result> flexfloat_sweep_desc(
+    const Kernel &kernel, const std::vector<flexfloat_desc_t> &descs, unsigned threads = 0)
+{
+    const flexfloat_desc_t binary64 = { 11, 52 };
+    std::vector<double> ref;
+    std::vector<flexfloat_sweep_result> results(descs.size());
+    std::vector<std::function<void()> > tasks;
+
+    kernel(binary64, ref);
+    for (size_t i = 0; i < descs.size(); ++i) {
+        flexfloat_sweep_result *slot = &results[i];
+        flexfloat_desc_t desc = descs[i];
+        tasks.push_back([&kernel, &ref, slot, desc]() {
+            std::vector<double> out;
+            double seconds = flexfloat_sweep_time(kernel, desc, out);
+            *slot = flexfloat_sweep_compare(desc.exp_bits, desc.frac_bits, ref, out, seconds);
+        });
+    }
+    flexfloat_sweep_run(tasks, threads);
+    return results;
+}
+
+/* OUTPUT */
+
+static inline void flexfloat_sweep_print(std::ostream &os, const std::vector<flexfloat_sweep_result> &results) {
+    std::ios_base::fmtflags flags = os.flags();
+    os << std::setw(4) << "exp" << std::setw(5) << "frac" << std::setw(8) << "bad"
+       << std::setw(13) << "max_abs" << std::setw(13) << "mean_abs" << std::setw(13) << "rms"
+       << std::setw(13) << "max_rel" << std::setw(11) << "seconds" << "\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const flexfloat_sweep_result &r = results[i];
+        os << std::setw(4) << r.exp_bits << std::setw(5) << r.frac_bits << std::setw(8) << r.bad
+           << std::scientific << std::setprecision(4)
+           << std::setw(13) << r.max_abs << std::setw(13) << r.mean_abs << std::setw(13) << r.rms
+           << std::setw(13) << r.max_rel
+           << std::fixed << std::setprecision(4) << std::setw(11) << r.seconds << "\n";
+    }
+    os.flags(flags);
+}
+
+static inline void flexfloat_sweep_csv(std::ostream &os, const std::vector<flexfloat_sweep_result> &results) {
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision(17);
+    os << "exp_bits,frac_bits,n,bad,max_abs,mean_abs,rms,max_rel,seconds\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const flexfloat_sweep_result &r = results[i];
+        os << r.exp_bits << "," << r.frac_bits << "," << r.n << "," << r.bad << ","
+           << r.max_abs << "," << r.mean_abs << "," << r.rms << "," << r.max_rel << "," << r.seconds << "\n";
+    }
+    os.precision(precision);
+    os.flags(flags);
+}
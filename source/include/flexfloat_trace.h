@@ -0,0 +1,102 @@
+/* C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef flexfloat_trace_h
+#define flexfloat_trace_h 1
+
+#include "flexfloat.h"
+
+/*----------------------------------------------------------------------------
+| Trace and replay for precision exploration.
+|
+| While a trace is being recorded, every ff_* call of the recording thread is
+| appended to it as one node (operation, operand nodes, constant). Values are
+| tied to their variables, and each variable is a flexfloat_t object: the
+| result of a node is rounded to the format of the variable it is stored in.
+| Objects can be grouped under one named variable with flexfloat_trace_bind()
+| (all elements of an array, for instance); otherwise each object is its own
+| variable.
+|
+| A finished trace is a straight-line program: flexfloat_trace_replay()
+| re-evaluates it with any descriptor per variable, without running the host
+| program again, and returns the values read back through ff_get_*. Branches
+| taken by the recorded run on flexfloat values are not re-evaluated, so the
+| replay is only meaningful for programs whose control flow does not depend on
+| the precision.
+|
+| Recording is opt-in: compile the library with FLEXFLOAT_TRACE defined.
+| Otherwise the hooks below expand to nothing.
+*----------------------------------------------------------------------------*/
+
+enum {
+    flexfloat_trace_const = 0,  // constant, rounded to the variable
+    flexfloat_trace_cast,       // a, rounded to the variable
+    flexfloat_trace_neg,
+    flexfloat_trace_add,
+    flexfloat_trace_sub,
+    flexfloat_trace_mul,
+    flexfloat_trace_div,
+    flexfloat_trace_fma,        // a * b + c
+    flexfloat_trace_sqrt,
+    flexfloat_trace_min,
+    flexfloat_trace_max,
+    flexfloat_trace_abs,
+    flexfloat_trace_output      // value of a read back as output b
+};
+
+typedef struct flexfloat_trace flexfloat_trace_t;
+
+flexfloat_trace_t *flexfloat_trace_create(void);
+void flexfloat_trace_destroy(flexfloat_trace_t *t);
+
+// Record the ff_* calls of this thread into 't' until flexfloat_trace_end()
+bool flexfloat_trace_begin(flexfloat_trace_t *t);
+// Stop recording; false if the trace could not be recorded entirely (out of memory)
+bool flexfloat_trace_end(void);
+// Make 'obj' part of the variable called 'name' (recording thread only)
+void flexfloat_trace_bind(const flexfloat_t *obj, const char *name);
+
+size_t flexfloat_trace_nodes(const flexfloat_trace_t *t);
+size_t flexfloat_trace_vars(const flexfloat_trace_t *t);
+size_t flexfloat_trace_outputs(const flexfloat_trace_t *t);
+// Format of each variable in the recorded run, and its name (NULL if unnamed)
+flexfloat_desc_t flexfloat_trace_var_desc(const flexfloat_trace_t *t, size_t var);
+const char *flexfloat_trace_var_name(const flexfloat_trace_t *t, size_t var);
+// Variable bound to 'name', or -1
+long flexfloat_trace_find(const flexfloat_trace_t *t, const char *name);
+
+// Evaluate the trace with descs[var] for each variable; out receives the outputs
+bool flexfloat_trace_replay(const flexfloat_trace_t *t, const flexfloat_desc_t *descs,
+    uint_fast8_t roundingMode, double *out);
+// Evaluate 'count' configurations at once: descs[k * vars + var] and
+// out[k * outputs + i] for configuration k
+bool flexfloat_trace_replay_batch(const flexfloat_trace_t *t, const flexfloat_desc_t *descs,
+    size_t count, uint_fast8_t roundingMode, double *out);
+
+// Recording (used through the hooks below)
+void flexfloat_trace_op(int op, const flexfloat_t *dest, const flexfloat_t *a, const flexfloat_t *b, const flexfloat_t *c);
+void flexfloat_trace_commit(const flexfloat_t *dest);
+void flexfloat_trace_out(const flexfloat_t *a);
+
+// Hooks: OP before the operation (operands still hold their values), COMMIT
+// once dest holds the result
+#ifdef FLEXFLOAT_TRACE
+#define FLEXFLOAT_TRACE_OP(op, dest, a, b) flexfloat_trace_op((op), (dest), (a), (b), NULL)
+#define FLEXFLOAT_TRACE_FMA(dest, a, b, c) flexfloat_trace_op(flexfloat_trace_fma, (dest), (a), (b), (c))
+#define FLEXFLOAT_TRACE_COMMIT(dest) flexfloat_trace_commit(dest)
+#define FLEXFLOAT_TRACE_OUT(a) flexfloat_trace_out(a)
+#else
+#define FLEXFLOAT_TRACE_OP(op, dest, a, b) ((void) 0)
+#define FLEXFLOAT_TRACE_FMA(dest, a, b, c) ((void) 0)
+#define FLEXFLOAT_TRACE_COMMIT(dest) ((void) 0)
+#define FLEXFLOAT_TRACE_OUT(a) ((void) 0)
+#endif
+
+#endif
+
+/* C++ */
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,1065 @@
+/*
+ * Generic IEEE 754 binary format engine.
+ *
+ * ieee_format<ExpBits, FracBits> is a value type holding the raw encoding of
+ * a binary floating-point format with 'ExpBits' exponent bits and 'FracBits'
+ * stored fraction bits, together with a complete integer implementation of
+ * its arithmetic: add, sub, mul, div, sqrt, mulAdd, roundToInt, comparisons
+ * and conversions from/to integers, native types, the SoftFloat formats and
+ * any other ieee_format.
+ *
+ * The format parameters, the bias, all masks and the width of the working
+ * integers are compile-time constants, so every instantiation compiles down
+ * to straight-line code specialized for that format.  Formats with up to 23
+ * fraction bits compute in 32-bit words (64-bit products), wider ones in
+ * 64-bit words (128-bit products).
+ *
+ * Results honour softfloat_roundingMode, softfloat_detectTininess and raise
+ * softfloat_exceptionFlags exactly like the hand-written f16_* / f32_* code.
+ * NaN propagation and the results of invalid integer conversions follow the
+ * 8086 specialization the library is built with, so ieee_format<5, 10> is
+ * bit-for-bit identical to float16_t, ieee_format<8, 7> to bfloat16_t, and
+ * so on.
+ *
+ * ieee_format<5, 2> is correctly rounded (checked exhaustively in round to
+ * nearest even) but not identical to float8_t.  f8_mul, f8_div and f8_mulAdd
+ * agree with it on every finite result.  f8_add and f8_sub misround the
+ * cancellation of equal-exponent subnormals (640 of the 65536 pairs each in
+ * round to nearest even), and f8_sqrt is wrong for 92 of the 256 inputs.
+ * With an infinity operand, the f8_* routines return the NaN 0x7E where this
+ * engine returns 0xFE.
+ *
+ *   typedef ieee_format<4, 3> e4m3;
+ *   e4m3 x = e4m3::from(1.5f);
+ *   e4m3 y = e4m3::mulAdd(x, x, e4m3::from(0.25f));
+ */
+
+#pragma once
+#include "softfloat.h"
+
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+| Unsigned integer types by size in bytes.
+*----------------------------------------------------------------------------*/
+template <int Bytes> struct ieee_uint;
+template <> struct ieee_uint<1> { typedef uint8_t type; };
+template <> struct ieee_uint<2> { typedef uint16_t type; };
+template <> struct ieee_uint<4> { typedef uint32_t type; };
+template <> struct ieee_uint<8> { typedef uint64_t type; };
+
+/*----------------------------------------------------------------------------
+| Portable 128-bit unsigned integer and the double-word primitives used by
+| the engine.  Every primitive is overloaded for uint64_t (the double word of
+| 32-bit formats) and ieee_u128 (the double word of 64-bit formats), so the
+| algorithms below are written once for both word sizes.
+*----------------------------------------------------------------------------*/
+struct ieee_u128 { uint64_t hi, lo; };
+
+static inline ieee_u128 ieee_u128Make(uint64_t hi, uint64_t lo) {
+    ieee_u128 z;
+    z.hi = hi;
+    z.lo = lo;
+    return z;
+}
+
+static inline int ieee_clz(uint32_t a) {
+#if defined(__GNUC__)
+    return a ? __builtin_clz(a) : 32;
+#else
+    int n = 0;
+    for (; n < 32 && !(a & 0x80000000); ++n) a <<= 1;
+    return n;
+#endif
+}
+
+static inline int ieee_clz(uint64_t a) {
+#if defined(__GNUC__)
+    return a ? __builtin_clzll(a) : 64;
+#else
+    return (a >> 32) ? ieee_clz((uint32_t) (a >> 32))
+                     : 32 + ieee_clz((uint32_t) a);
+#endif
+}
+
+static inline int ieee_clz(const ieee_u128 &a) {
+    return a.hi ? ieee_clz(a.hi) : 64 + ieee_clz(a.lo);
+}
+
+// Shift right by 'dist' (any non-negative value), or-ing the lost bits into
+// the least-significant bit.
+static inline uint32_t ieee_shiftRightJam(uint32_t a, int dist) {
+    if (!dist) return a;
+    return (dist < 32) ? a >> dist | ((uint32_t) (a << (32 - dist)) != 0)
+                       : (a != 0);
+}
+
+static inline uint64_t ieee_shiftRightJam(uint64_t a, int dist) {
+    if (!dist) return a;
+    return (dist < 64) ? a >> dist | ((uint64_t) (a << (64 - dist)) != 0)
+                       : (a != 0);
+}
+
+static inline ieee_u128 ieee_shiftRightJam(const ieee_u128 &a, int dist) {
+    if (!dist) return a;
+    if (dist < 64) {
+        return ieee_u128Make(
+            a.hi >> dist,
+            a.hi << (64 - dist) | a.lo >> dist | ((a.lo << (64 - dist)) != 0));
+    }
+    if (dist < 128)
+        return ieee_u128Make(0, ieee_shiftRightJam(a.hi, dist - 64) | (a.lo != 0));
+    return ieee_u128Make(0, (a.hi | a.lo) != 0);
+}
+
+static inline uint64_t ieee_shiftLeft(uint64_t a, int dist) { return a << dist; }
+
+static inline ieee_u128 ieee_shiftLeft(const ieee_u128 &a, int dist) {
+    if (!dist) return a;
+    if (dist < 64) return ieee_u128Make(a.hi << dist | a.lo >> (64 - dist), a.lo << dist);
+    return ieee_u128Make(a.lo << (dist - 64), 0);
+}
+
+static inline uint64_t ieee_add(uint64_t a, uint64_t b) { return a + b; }
+static inline uint64_t ieee_sub(uint64_t a, uint64_t b) { return a - b; }
+static inline bool ieee_lt(uint64_t a, uint64_t b) { return a < b; }
+static inline bool ieee_isZero(uint64_t a) { return !a; }
+
+static inline ieee_u128 ieee_add(const ieee_u128 &a, const ieee_u128 &b) {
+    uint64_t lo = a.lo + b.lo;
+    return ieee_u128Make(a.hi + b.hi + (lo < a.lo), lo);
+}
+
+static inline ieee_u128 ieee_sub(const ieee_u128 &a, const ieee_u128 &b) {
+    return ieee_u128Make(a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo);
+}
+
+static inline bool ieee_lt(const ieee_u128 &a, const ieee_u128 &b) {
+    return (a.hi < b.hi) || ((a.hi == b.hi) && (a.lo < b.lo));
+}
+
+static inline bool ieee_isZero(const ieee_u128 &a) { return !(a.hi | a.lo); }
+
+// Word <-> double word
+static inline uint64_t ieee_widen(uint32_t a) { return a; }
+static inline ieee_u128 ieee_widen(uint64_t a) { return ieee_u128Make(0, a); }
+static inline uint32_t ieee_narrow(uint64_t a) { return (uint32_t) a; }
+static inline uint64_t ieee_narrow(const ieee_u128 &a) { return a.lo; }
+
+// Upper word, with the lower word jammed into its least-significant bit
+static inline uint32_t ieee_hiWordJam(uint64_t a) {
+    return (uint32_t) (a >> 32) | ((uint32_t) a != 0);
+}
+
+static inline uint64_t ieee_hiWordJam(const ieee_u128 &a) { return a.hi | (a.lo != 0); }
+
+// The two bits at positions 'pos' and 'pos'+1 ('pos' even)
+static inline uint32_t ieee_bits2(uint64_t a, int pos) { return (uint32_t) (a >> pos) & 3; }
+
+static inline uint64_t ieee_bits2(const ieee_u128 &a, int pos) {
+    return ((pos < 64) ? a.lo >> pos : a.hi >> (pos - 64)) & 3;
+}
+
+// Full product of two words
+static inline uint64_t ieee_mulWide(uint32_t a, uint32_t b) { return (uint64_t) a * b; }
+
+static inline ieee_u128 ieee_mulWide(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128) a * b;
+    return ieee_u128Make((uint64_t) (p >> 64), (uint64_t) p);
+#else
+    uint64_t a32 = a >> 32, a0 = (uint32_t) a, b32 = b >> 32, b0 = (uint32_t) b;
+    uint64_t mid1 = a32 * b0, mid = mid1 + a0 * b32;
+    uint64_t hi = a32 * b32 + ((uint64_t) (mid < mid1) << 32 | mid >> 32);
+    uint64_t lo = a0 * b0;
+    mid <<= 32;
+    lo += mid;
+    return ieee_u128Make(hi + (lo < mid), lo);
+#endif
+}
+
+// floor(a * 2^(bits-2) / b), jammed with the remainder.  Requires b/2 < a < 2b.
+static inline uint32_t ieee_divFrac(uint32_t a, uint32_t b) {
+    uint64_t n = (uint64_t) a << 30;
+    uint32_t q = (uint32_t) (n / b);
+    return q | ((uint64_t) q * b != n);
+}
+
+static inline uint64_t ieee_divFrac(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 n = (unsigned __int128) a << 62;
+    uint64_t q = (uint64_t) (n / b);
+    return q | ((unsigned __int128) q * b != n);
+#else
+    uint64_t q = 0;
+    for (int i = 0; i < 63; ++i) {
+        q <<= 1;
+        if (a >= b) {
+            a -= b;
+            q |= 1;
+        }
+        a <<= 1;
+    }
+    return q | (a != 0);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+| Working word for a format with 'FracBits' fraction bits.  The significand
+| is kept with its leading bit at position 'bits'-2, leaving at least 7
+| rounding bits below the last fraction bit.
+*----------------------------------------------------------------------------*/
+template <bool Wide> struct ieee_word {
+    typedef uint32_t word;
+    typedef uint64_t dword;
+    enum { bits = 32 };
+};
+
+template <> struct ieee_word<true> {
+    typedef uint64_t word;
+    typedef ieee_u128 dword;
+    enum { bits = 64 };
+};
+
+/*----------------------------------------------------------------------------
+| The engine.
+*----------------------------------------------------------------------------*/
+template <int ExpBits, int FracBits> struct ieee_format {
+    static_assert(ExpBits >= 2 && ExpBits <= 15, "ieee_format: ExpBits must be in [2, 15]");
+    static_assert(FracBits >= 1 && FracBits <= 52, "ieee_format: FracBits must be in [1, 52]");
+
+    enum {
+        expBits  = ExpBits,
+        fracBits = FracBits,
+        width    = 1 + ExpBits + FracBits,
+        bias     = (1 << (ExpBits - 1)) - 1,
+        expMax   = (1 << ExpBits) - 1
+    };
+
+    typedef typename ieee_uint<(width <= 8) ? 1 : (width <= 16) ? 2 : (width <= 32) ? 4 : 8>::type storage;
+    typedef typename ieee_uint<(width <= 32) ? 4 : 8>::type uiType;
+
+    typedef ieee_word<(FracBits > 23)> W;
+    typedef typename W::word word;
+    typedef typename W::dword dword;
+
+    enum {
+        N = W::bits,             // working word width
+        R = N - 2 - FracBits,    // rounding bits below the last fraction bit
+        D = 2 * N                // double word width
+    };
+
+    storage v;
+
+    /*------------------------------------------------------------------------
+    | Encoding helpers
+    *------------------------------------------------------------------------*/
+    static inline ieee_format fromBits(uiType ui) {
+        ieee_format z;
+        z.v = (storage) ui;
+        return z;
+    }
+
+    static inline uiType packUI(bool sign, int_fast32_t exp, uiType frac) {
+        return ((uiType) sign << (ExpBits + FracBits)) + ((uiType) exp << FracBits) + frac;
+    }
+
+    static inline bool signUI(uiType ui) { return (ui >> (ExpBits + FracBits)) & 1; }
+    static inline int_fast32_t expUI(uiType ui) { return (int_fast32_t) ((ui >> FracBits) & expMax); }
+    static inline uiType fracUI(uiType ui) { return ui & (((uiType) 1 << FracBits) - 1); }
+    static inline uiType quietBit() { return (uiType) 1 << (FracBits - 1); }
+    static inline uiType defaultNaNUI() { return packUI(1, expMax, quietBit()); }
+
+    static inline bool isNaNUI(uiType ui) { return expUI(ui) == expMax && fracUI(ui); }
+
+    static inline bool isSigNaNUI(uiType ui) {
+        return expUI(ui) == expMax && !(ui & quietBit()) && fracUI(ui);
+    }
+
+    // Combined NaN result of two operands, at least one of which is a NaN.
+    static inline uiType propagateNaNUI(uiType uiA, uiType uiB) {
+        bool isSigNaNA = isSigNaNUI(uiA), isSigNaNB = isSigNaNUI(uiB);
+        uiType uiNonsigA = uiA | quietBit(), uiNonsigB = uiB | quietBit();
+        if (isSigNaNA | isSigNaNB) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            if (isSigNaNA && !isSigNaNB) return isNaNUI(uiB) ? uiNonsigB : uiNonsigA;
+            if (!isSigNaNA) return isNaNUI(uiA) ? uiNonsigA : uiNonsigB;
+        }
+        uiType magMask = ((uiType) 1 << (ExpBits + FracBits)) - 1;
+        uiType uiMagA = uiA & magMask, uiMagB = uiB & magMask;
+        if (uiMagA < uiMagB) return uiNonsigB;
+        if (uiMagB < uiMagA) return uiNonsigA;
+        return (uiNonsigA < uiNonsigB) ? uiNonsigA : uiNonsigB;
+    }
+
+    // NaN payload aligned to the top of 64 bits, as in the 'commonNaN' form.
+    static inline uint64_t nanPayload(uiType ui) { return (uint64_t) ui << (64 - FracBits); }
+
+    static inline uiType nanFromPayload(bool sign, uint64_t payload) {
+        return packUI(sign, expMax, quietBit() | (uiType) (payload >> (64 - FracBits)));
+    }
+
+    // Normalized significand (leading bit at 'FracBits') of a finite nonzero
+    // value; 'exp' receives the matching biased exponent (<= 0 if subnormal).
+    static inline word unpack(uiType ui, int_fast32_t &exp) {
+        exp = expUI(ui);
+        word sig = (word) fracUI(ui);
+        if (!exp) {
+            int shift = ieee_clz(sig) - (N - 1 - FracBits);
+            exp = 1 - shift;
+            return sig << shift;
+        }
+        return sig | ((word) 1 << FracBits);
+    }
+
+    /*------------------------------------------------------------------------
+    | Rounding.  'sig' has its leading bit at position N-2 and 'exp' is one
+    | less than the biased exponent of that bit, as in softfloat_roundPackToF*.
+    *------------------------------------------------------------------------*/
+    static ieee_format roundPack(bool sign, int_fast32_t exp, word sig) {
+        const word roundMask = ((word) 1 << R) - 1, half = (word) 1 << (R - 1);
+        const word carry = (word) 1 << (N - 1);
+        uint_fast8_t roundingMode = softfloat_roundingMode;
+        bool roundNearEven = (roundingMode == softfloat_round_near_even);
+        word roundIncrement = half;
+        if (!roundNearEven && (roundingMode != softfloat_round_near_maxMag)) {
+            roundIncrement =
+                (roundingMode == (sign ? softfloat_round_min : softfloat_round_max))
+                    ? roundMask : 0;
+        }
+        word roundBits = sig & roundMask;
+        if ((uint_fast32_t) (expMax - 2) <= (uint_fast32_t) exp) {
+            if (exp < 0) {
+                bool isTiny =
+                    (softfloat_detectTininess == softfloat_tininess_beforeRounding)
+                        || (exp < -1) || (sig + roundIncrement < carry);
+                sig = ieee_shiftRightJam(sig, (int) -exp);
+                exp = 0;
+                roundBits = sig & roundMask;
+                if (isTiny && roundBits) softfloat_raiseFlags(softfloat_flag_underflow);
+            } else if ((expMax - 2 < exp) || (carry <= sig + roundIncrement)) {
+                softfloat_raiseFlags(softfloat_flag_overflow | softfloat_flag_inexact);
+                return fromBits(packUI(sign, expMax, 0) - !roundIncrement);
+            }
+        }
+        sig = (sig + roundIncrement) >> R;
+        if (roundBits) {
+            softfloat_exceptionFlags |= softfloat_flag_inexact;
+#ifdef SOFTFLOAT_ROUND_ODD
+            if (roundingMode == softfloat_round_odd) {
+                sig |= 1;
+                return fromBits(packUI(sign, exp, (uiType) sig));
+            }
+#endif
+        }
+        sig &= ~(word) (!(roundBits ^ half) & roundNearEven);
+        if (!sig) exp = 0;
+        return fromBits(packUI(sign, exp, (uiType) sig));
+    }
+
+    // As roundPack(), but 'sig' need only be nonzero with its leading bit at
+    // or below N-2, and 'exp' is the biased exponent of bit N-2.
+    static inline ieee_format normRoundPack(bool sign, int_fast32_t exp, word sig) {
+        int shift = ieee_clz(sig) - 1;
+        return roundPack(sign, exp - 1 - shift, sig << shift);
+    }
+
+    // As normRoundPack(), for 'sig' with its leading bit at N-2 or N-3.
+    static inline ieee_format shortNormRoundPack(bool sign, int_fast32_t exp, word sig) {
+        if (sig < ((word) 1 << (N - 2))) return roundPack(sign, exp - 2, sig << 1);
+        return roundPack(sign, exp - 1, sig);
+    }
+
+    // Round sign * sig64 * 2^(exp-63) ('sig64' normalized to bit 63).
+    static inline ieee_format roundPack64(bool sign, int_fast32_t exp, uint64_t sig64) {
+        return roundPack(sign, exp + bias - 1, (word) ieee_shiftRightJam(sig64, 65 - N));
+    }
+
+    /*------------------------------------------------------------------------
+    | Addition and subtraction
+    *------------------------------------------------------------------------*/
+    static ieee_format addMags(uiType uiA, uiType uiB, bool signZ) {
+        int_fast32_t expA = expUI(uiA), expB = expUI(uiB);
+        uiType fracA = fracUI(uiA), fracB = fracUI(uiB);
+        if (expA == expMax) {
+            if (fracA || ((expB == expMax) && fracB)) return fromBits(propagateNaNUI(uiA, uiB));
+            return fromBits(uiA);
+        }
+        if (expB == expMax) {
+            if (fracB) return fromBits(propagateNaNUI(uiA, uiB));
+            return fromBits(packUI(signZ, expMax, 0));
+        }
+        if (!expA && !expB) return fromBits(uiA + fracB);
+        if (!(expA | fracA)) return fromBits(packUI(signZ, expB, fracB));
+        if (!(expB | fracB)) return fromBits(uiA);
+        word sigA = unpack(uiA, expA) << (N - 3 - FracBits);
+        word sigB = unpack(uiB, expB) << (N - 3 - FracBits);
+        int_fast32_t expDiff = expA - expB;
+        if (expDiff < 0) {
+            expA = expB;
+            sigA = ieee_shiftRightJam(sigA, (int) -expDiff);
+        } else {
+            sigB = ieee_shiftRightJam(sigB, (int) expDiff);
+        }
+        return shortNormRoundPack(signZ, expA + 1, sigA + sigB);
+    }
+
+    static ieee_format subMags(uiType uiA, uiType uiB, bool signZ) {
+        int_fast32_t expA = expUI(uiA), expB = expUI(uiB);
+        uiType fracA = fracUI(uiA), fracB = fracUI(uiB);
+        if (expA == expMax) {
+            if (fracA) return fromBits(propagateNaNUI(uiA, uiB));
+            if (expB == expMax) {
+                if (fracB) return fromBits(propagateNaNUI(uiA, uiB));
+                softfloat_raiseFlags(softfloat_flag_invalid);
+                return fromBits(defaultNaNUI());
+            }
+            return fromBits(uiA);
+        }
+        if (expB == expMax) {
+            if (fracB) return fromBits(propagateNaNUI(uiA, uiB));
+            return fromBits(packUI(!signZ, expMax, 0));
+        }
+        bool zeroA = !(expA | fracA), zeroB = !(expB | fracB);
+        if (zeroA && zeroB)
+            return fromBits(packUI(softfloat_roundingMode == softfloat_round_min, 0, 0));
+        if (zeroB) return fromBits(uiA);
+        if (zeroA) return fromBits(packUI(!signZ, expB, fracB));
+        word sigA = unpack(uiA, expA) << (N - 2 - FracBits);
+        word sigB = unpack(uiB, expB) << (N - 2 - FracBits);
+        int_fast32_t expDiff = expA - expB;
+        if (!expDiff && (sigA == sigB))
+            return fromBits(packUI(softfloat_roundingMode == softfloat_round_min, 0, 0));
+        if ((expDiff < 0) || (!expDiff && (sigA < sigB))) {
+            word t = sigA;
+            sigA = sigB;
+            sigB = t;
+            expA = expB;
+            expDiff = -expDiff;
+            signZ = !signZ;
+        }
+        return normRoundPack(signZ, expA, sigA - ieee_shiftRightJam(sigB, (int) expDiff));
+    }
+
+    static inline ieee_format add(ieee_format a, ieee_format b) {
+        bool signA = signUI(a.v);
+        if (signA == signUI(b.v)) return addMags(a.v, b.v, signA);
+        return subMags(a.v, b.v, signA);
+    }
+
+    static inline ieee_format sub(ieee_format a, ieee_format b) {
+        bool signA = signUI(a.v);
+        if (signA == signUI(b.v)) return subMags(a.v, b.v, signA);
+        return addMags(a.v, b.v, signA);
+    }
+
+    /*------------------------------------------------------------------------
+    | Multiplication, division, square root
+    *------------------------------------------------------------------------*/
+    static ieee_format mul(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        int_fast32_t expA = expUI(uiA), expB = expUI(uiB);
+        uiType fracA = fracUI(uiA), fracB = fracUI(uiB);
+        bool signZ = signUI(uiA) ^ signUI(uiB);
+        uiType magBits;
+        if (expA == expMax) {
+            if (fracA || ((expB == expMax) && fracB)) return fromBits(propagateNaNUI(uiA, uiB));
+            magBits = expB | fracB;
+            goto infArg;
+        }
+        if (expB == expMax) {
+            if (fracB) return fromBits(propagateNaNUI(uiA, uiB));
+            magBits = expA | fracA;
+            goto infArg;
+        }
+        if (!(expA | fracA) || !(expB | fracB)) return fromBits(packUI(signZ, 0, 0));
+        {
+            word sigA = unpack(uiA, expA), sigB = unpack(uiB, expB);
+            dword prod = ieee_mulWide(sigA, sigB);
+            word sig;
+            if (2 * FracBits > N - 3) {
+                sig = ieee_narrow(ieee_shiftRightJam(prod, (2 * FracBits > N - 3) ? 2 * FracBits - (N - 3) : 0));
+            } else {
+                sig = ieee_narrow(prod) << ((2 * FracBits > N - 3) ? 0 : (N - 3) - 2 * FracBits);
+            }
+            return shortNormRoundPack(signZ, expA + expB - bias + 1, sig);
+        }
+    infArg:
+        if (!magBits) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return fromBits(defaultNaNUI());
+        }
+        return fromBits(packUI(signZ, expMax, 0));
+    }
+
+    static ieee_format div(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        int_fast32_t expA = expUI(uiA), expB = expUI(uiB);
+        uiType fracA = fracUI(uiA), fracB = fracUI(uiB);
+        bool signZ = signUI(uiA) ^ signUI(uiB);
+        if (expA == expMax) {
+            if (fracA) return fromBits(propagateNaNUI(uiA, uiB));
+            if (expB == expMax) {
+                if (fracB) return fromBits(propagateNaNUI(uiA, uiB));
+                softfloat_raiseFlags(softfloat_flag_invalid);
+                return fromBits(defaultNaNUI());
+            }
+            return fromBits(packUI(signZ, expMax, 0));
+        }
+        if (expB == expMax) {
+            if (fracB) return fromBits(propagateNaNUI(uiA, uiB));
+            return fromBits(packUI(signZ, 0, 0));
+        }
+        if (!(expB | fracB)) {
+            if (!(expA | fracA)) {
+                softfloat_raiseFlags(softfloat_flag_invalid);
+                return fromBits(defaultNaNUI());
+            }
+            softfloat_raiseFlags(softfloat_flag_infinite);
+            return fromBits(packUI(signZ, expMax, 0));
+        }
+        if (!(expA | fracA)) return fromBits(packUI(signZ, 0, 0));
+        word sigA = unpack(uiA, expA), sigB = unpack(uiB, expB);
+        return shortNormRoundPack(signZ, expA - expB + bias, ieee_divFrac(sigA, sigB));
+    }
+
+    static ieee_format sqrt(ieee_format a) {
+        uiType uiA = a.v;
+        int_fast32_t expA = expUI(uiA);
+        uiType fracA = fracUI(uiA);
+        bool signA = signUI(uiA);
+        if (expA == expMax) {
+            if (fracA) return fromBits(propagateNaNUI(uiA, 0));
+            if (!signA) return a;
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return fromBits(defaultNaNUI());
+        }
+        if (!(expA | fracA)) return a;
+        if (signA) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return fromBits(defaultNaNUI());
+        }
+        // Digit-by-digit root of sig * 2^(FracBits+4), made even-exponent.
+        const int L = FracBits + 2;
+        word sig = unpack(uiA, expA);
+        int_fast32_t exp = expA - bias;
+        int odd = (int) (exp & 1);
+        dword rad = ieee_shiftLeft(ieee_widen(sig), FracBits + 4 + odd);
+        word root = 0, rem = 0;
+        for (int i = L; i >= 0; --i) {
+            rem = (rem << 2) | (word) ieee_bits2(rad, 2 * i);
+            word trial = (root << 2) | 1;
+            root <<= 1;
+            if (rem >= trial) {
+                rem -= trial;
+                root |= 1;
+            }
+        }
+        return roundPack(0, (exp - odd) / 2 + bias - 1, root << (N - 2 - L) | (rem != 0));
+    }
+
+    /*------------------------------------------------------------------------
+    | Fused multiply-add: a * b + c with a single rounding.
+    *------------------------------------------------------------------------*/
+    static ieee_format mulAdd(ieee_format a, ieee_format b, ieee_format c) {
+        uiType uiA = a.v, uiB = b.v, uiC = c.v, uiZ, magBits;
+        int_fast32_t expA = expUI(uiA), expB = expUI(uiB), expC = expUI(uiC);
+        uiType fracA = fracUI(uiA), fracB = fracUI(uiB), fracC = fracUI(uiC);
+        bool signProd = signUI(uiA) ^ signUI(uiB), signC = signUI(uiC);
+        if (expA == expMax) {
+            if (fracA || ((expB == expMax) && fracB)) goto propagateNaN_ABC;
+            magBits = expB | fracB;
+            goto infProdArg;
+        }
+        if (expB == expMax) {
+            if (fracB) goto propagateNaN_ABC;
+            magBits = expA | fracA;
+            goto infProdArg;
+        }
+        if (expC == expMax) {
+            if (fracC) {
+                uiZ = 0;
+                goto propagateNaN_ZC;
+            }
+            return c;
+        }
+        if (!(expA | fracA) || !(expB | fracB)) {
+            if (!(expC | fracC) && (signProd != signC))
+                return fromBits(packUI(softfloat_roundingMode == softfloat_round_min, 0, 0));
+            return c;
+        }
+        {
+            // Both terms are placed in a double word with the product's
+            // leading bit at D-4 or D-3 and c's at D-4.
+            word sigA = unpack(uiA, expA), sigB = unpack(uiB, expB);
+            int_fast32_t expProd = expA + expB - bias, expZ = expProd;
+            dword sigZ = ieee_shiftLeft(ieee_mulWide(sigA, sigB), D - 4 - 2 * FracBits);
+            bool signZ = signProd;
+            if (expC | fracC) {
+                word sigC = unpack(uiC, expC);
+                dword sigC2 = ieee_shiftLeft(ieee_widen(sigC), D - 4 - FracBits);
+                int_fast32_t expDiff = expProd - expC;
+                dword big = sigZ, small = sigC2;
+                bool signBig = signProd, signSmall = signC;
+                if (expDiff < 0) {
+                    big = sigC2;
+                    small = sigZ;
+                    signBig = signC;
+                    signSmall = signProd;
+                    expZ = expC;
+                }
+                small = ieee_shiftRightJam(small, (int) (expDiff < 0 ? -expDiff : expDiff));
+                if (signBig == signSmall) {
+                    sigZ = ieee_add(big, small);
+                    signZ = signBig;
+                } else if (ieee_lt(small, big)) {
+                    sigZ = ieee_sub(big, small);
+                    signZ = signBig;
+                } else if (ieee_lt(big, small)) {
+                    sigZ = ieee_sub(small, big);
+                    signZ = signSmall;
+                } else {
+                    return fromBits(packUI(softfloat_roundingMode == softfloat_round_min, 0, 0));
+                }
+            }
+            int shift = ieee_clz(sigZ) - 1;
+            return roundPack(
+                signZ, expZ + 1 - shift, ieee_hiWordJam(ieee_shiftLeft(sigZ, shift)));
+        }
+    propagateNaN_ABC:
+        uiZ = propagateNaNUI(uiA, uiB);
+        goto propagateNaN_ZC;
+    infProdArg:
+        if (magBits) {
+            uiZ = packUI(signProd, expMax, 0);
+            if (expC != expMax) return fromBits(uiZ);
+            if (fracC) goto propagateNaN_ZC;
+            if (signProd == signC) return fromBits(uiZ);
+        }
+        softfloat_raiseFlags(softfloat_flag_invalid);
+        uiZ = defaultNaNUI();
+    propagateNaN_ZC:
+        return fromBits(propagateNaNUI(uiZ, uiC));
+    }
+
+    /*------------------------------------------------------------------------
+    | Round to an integral value in the same format.
+    *------------------------------------------------------------------------*/
+    static ieee_format roundToInt(ieee_format a, uint_fast8_t roundingMode, bool exact) {
+        uiType uiA = a.v, uiZ;
+        int_fast32_t exp = expUI(uiA);
+        if (exp <= bias - 1) {
+            // |a| < 1; 0.5 is subnormal when ExpBits == 2
+            uiType mag = uiA & (((uiType) 1 << (ExpBits + FracBits)) - 1);
+            uiType halfUI = (bias > 1) ? packUI(0, bias - 1, 0) : quietBit();
+            if (!mag) return a;
+            if (exact) softfloat_exceptionFlags |= softfloat_flag_inexact;
+            uiZ = uiA & packUI(1, 0, 0);
+            switch (roundingMode) {
+             case softfloat_round_near_even:
+                if (halfUI < mag) uiZ |= packUI(0, bias, 0);
+                break;
+             case softfloat_round_near_maxMag:
+                if (halfUI <= mag) uiZ |= packUI(0, bias, 0);
+                break;
+             case softfloat_round_min:
+                if (uiZ) uiZ = packUI(1, bias, 0);
+                break;
+             case softfloat_round_max:
+                if (!uiZ) uiZ = packUI(0, bias, 0);
+                break;
+            }
+            return fromBits(uiZ);
+        }
+        if ((bias + FracBits <= exp) || (exp == expMax)) {
+            if ((exp == expMax) && fracUI(uiA)) return fromBits(propagateNaNUI(uiA, 0));
+            return a;
+        }
+        uiZ = uiA;
+        uiType lastBitMask = (uiType) 1 << (bias + FracBits - exp);
+        uiType roundBitsMask = lastBitMask - 1;
+        if (roundingMode == softfloat_round_near_maxMag) {
+            uiZ += lastBitMask >> 1;
+        } else if (roundingMode == softfloat_round_near_even) {
+            uiZ += lastBitMask >> 1;
+            if (!(uiZ & roundBitsMask)) uiZ &= ~lastBitMask;
+        } else if (roundingMode == (signUI(uiZ) ? softfloat_round_min : softfloat_round_max)) {
+            uiZ += roundBitsMask;
+        }
+        uiZ &= ~roundBitsMask;
+        if (exact && (uiZ != uiA)) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        return fromBits(uiZ);
+    }
+
+    /*------------------------------------------------------------------------
+    | Comparisons (same semantics as f16_eq, f16_eq_signaling, f16_le, ...)
+    *------------------------------------------------------------------------*/
+    static inline bool eq(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        if (isNaNUI(uiA) || isNaNUI(uiB)) {
+            if (isSigNaNUI(uiA) || isSigNaNUI(uiB))
+                softfloat_raiseFlags(softfloat_flag_invalid);
+            return false;
+        }
+        return (uiA == uiB) || isZeroPair(uiA, uiB);
+    }
+
+    static inline bool isZeroPair(uiType uiA, uiType uiB) {
+        return !((uiA | uiB) & (((uiType) 1 << (ExpBits + FracBits)) - 1));
+    }
+
+    static inline bool eq_signaling(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        if (isNaNUI(uiA) || isNaNUI(uiB)) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return false;
+        }
+        return (uiA == uiB) || isZeroPair(uiA, uiB);
+    }
+
+    static inline bool le_quiet(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        if (isNaNUI(uiA) || isNaNUI(uiB)) {
+            if (isSigNaNUI(uiA) || isSigNaNUI(uiB))
+                softfloat_raiseFlags(softfloat_flag_invalid);
+            return false;
+        }
+        return compareLe(uiA, uiB);
+    }
+
+    static inline bool lt_quiet(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        if (isNaNUI(uiA) || isNaNUI(uiB)) {
+            if (isSigNaNUI(uiA) || isSigNaNUI(uiB))
+                softfloat_raiseFlags(softfloat_flag_invalid);
+            return false;
+        }
+        return compareLt(uiA, uiB);
+    }
+
+    static inline bool le(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        if (isNaNUI(uiA) || isNaNUI(uiB)) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return false;
+        }
+        return compareLe(uiA, uiB);
+    }
+
+    static inline bool lt(ieee_format a, ieee_format b) {
+        uiType uiA = a.v, uiB = b.v;
+        if (isNaNUI(uiA) || isNaNUI(uiB)) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return false;
+        }
+        return compareLt(uiA, uiB);
+    }
+
+    static inline bool compareLe(uiType uiA, uiType uiB) {
+        bool signA = signUI(uiA);
+        if (signA != signUI(uiB)) return signA || isZeroPair(uiA, uiB);
+        return (uiA == uiB) || (signA ^ (uiA < uiB));
+    }
+
+    static inline bool compareLt(uiType uiA, uiType uiB) {
+        bool signA = signUI(uiA);
+        if (signA != signUI(uiB)) return signA && !isZeroPair(uiA, uiB);
+        return (uiA != uiB) && (signA ^ (uiA < uiB));
+    }
+
+    static inline bool isSignalingNaN(ieee_format a) { return isSigNaNUI(a.v); }
+
+    /*------------------------------------------------------------------------
+    | Conversions between ieee formats
+    *------------------------------------------------------------------------*/
+    template <int E, int F> static ieee_format from(const ieee_format<E, F> &a) {
+        typedef ieee_format<E, F> Src;
+        typename Src::uiType uiA = a.v;
+        bool sign = Src::signUI(uiA);
+        int_fast32_t exp = Src::expUI(uiA);
+        if (exp == Src::expMax) {
+            if (!Src::fracUI(uiA)) return fromBits(packUI(sign, expMax, 0));
+            if (Src::isSigNaNUI(uiA)) softfloat_raiseFlags(softfloat_flag_invalid);
+            return fromBits(nanFromPayload(sign, Src::nanPayload(uiA)));
+        }
+        if (!(exp | Src::fracUI(uiA))) return fromBits(packUI(sign, 0, 0));
+        uint64_t sig64 = (uint64_t) Src::unpack(uiA, exp) << (63 - F);
+        return roundPack64(sign, exp - Src::bias, sig64);
+    }
+
+    /*------------------------------------------------------------------------
+    | Conversions from the SoftFloat formats and native types
+    *------------------------------------------------------------------------*/
+    static inline ieee_format from(float8_t a) { return from(ieee_format<5, 2>::fromBits(a.v)); }
+    static inline ieee_format from(float16_t a) { return from(ieee_format<5, 10>::fromBits(a.v)); }
+    static inline ieee_format from(e4m3_t a) { return from(e4m3_to_f32(a)); }
+    static inline ieee_format from(bfloat16_t a) { return from(ieee_format<8, 7>::fromBits(a.v)); }
+    static inline ieee_format from(float32_t a) { return from(ieee_format<8, 23>::fromBits(a.v)); }
+    static inline ieee_format from(float64_t a) { return from(ieee_format<11, 52>::fromBits(a.v)); }
+
+    static ieee_format from(const extFloat80_t &a) {
+        bool sign = a.signExp >> 15;
+        int_fast32_t exp = a.signExp & 0x7FFF;
+        uint64_t sig = a.signif;
+        if (exp == 0x7FFF) {
+            if (!(sig & UINT64_C(0x7FFFFFFFFFFFFFFF))) return fromBits(packUI(sign, expMax, 0));
+            if (!(sig & UINT64_C(0x4000000000000000)) && (sig & UINT64_C(0x3FFFFFFFFFFFFFFF)))
+                softfloat_raiseFlags(softfloat_flag_invalid);
+            return fromBits(nanFromPayload(sign, sig << 1));
+        }
+        if (!sig) return fromBits(packUI(sign, 0, 0));
+        if (!exp) exp = 1;
+        int shift = ieee_clz(sig);
+        return roundPack64(sign, exp - 0x3FFF - shift, sig << shift);
+    }
+
+    static ieee_format from(const float128_t &a) {
+        uint64_t hi = a.v[softfloat_f128Hi], lo = a.v[!softfloat_f128Hi];
+        bool sign = hi >> 63;
+        int_fast32_t exp = (hi >> 48) & 0x7FFF;
+        ieee_u128 frac = ieee_u128Make(hi & UINT64_C(0x0000FFFFFFFFFFFF), lo);
+        if (exp == 0x7FFF) {
+            if (ieee_isZero(frac)) return fromBits(packUI(sign, expMax, 0));
+            if (!(hi & UINT64_C(0x0000800000000000)) && !ieee_isZero(frac))
+                softfloat_raiseFlags(softfloat_flag_invalid);
+            return fromBits(nanFromPayload(sign, frac.hi << 16 | frac.lo >> 48));
+        }
+        if (!exp) {
+            if (ieee_isZero(frac)) return fromBits(packUI(sign, 0, 0));
+            exp = 1;
+        } else {
+            frac.hi |= UINT64_C(0x0001000000000000);
+        }
+        int shift = ieee_clz(frac);
+        return roundPack64(sign, exp - 0x3FFF + 15 - shift,
+                           ieee_hiWordJam(ieee_shiftLeft(frac, shift)));
+    }
+
+    static inline ieee_format from(float a) {
+        float32_t t;
+        memcpy(&t.v, &a, sizeof(t.v));
+        return from(t);
+    }
+
+    static inline ieee_format from(double a) {
+        float64_t t;
+        memcpy(&t.v, &a, sizeof(t.v));
+        return from(t);
+    }
+
+    static inline ieee_format from(long double a) {
+        extFloat80_t t;
+        memcpy(&t, &a, sizeof(t));
+        return from(t);
+    }
+
+    /*------------------------------------------------------------------------
+    | Conversions from integers
+    *------------------------------------------------------------------------*/
+    static inline ieee_format from(uint64_t a) {
+        if (!a) return fromBits(0);
+        int shift = ieee_clz(a);
+        return roundPack64(0, 63 - shift, a << shift);
+    }
+
+    static inline ieee_format from(int64_t a) {
+        bool sign = (a < 0);
+        uint64_t absA = sign ? -(uint64_t) a : (uint64_t) a;
+        if (!absA) return fromBits(0);
+        int shift = ieee_clz(absA);
+        return roundPack64(sign, 63 - shift, absA << shift);
+    }
+
+    static inline ieee_format from(uint32_t a) { return from((uint64_t) a); }
+    static inline ieee_format from(int32_t a) { return from((int64_t) a); }
+
+    /*------------------------------------------------------------------------
+    | Conversions to the SoftFloat formats
+    *------------------------------------------------------------------------*/
+    static inline float8_t toF8(ieee_format a) {
+        float8_t z;
+        z.v = ieee_format<5, 2>::from(a).v;
+        return z;
+    }
+
+    static inline float16_t toF16(ieee_format a) {
+        float16_t z;
+        z.v = ieee_format<5, 10>::from(a).v;
+        return z;
+    }
+
+    // E4M3 has no infinities; the narrowing follows e4m3_overflowMode.
+    static inline e4m3_t toE4M3(ieee_format a) {
+        extFloat80_t x = toExtF80(a);
+        return extF80M_to_e4m3(&x);
+    }
+
+    static inline bfloat16_t toBF16(ieee_format a) {
+        bfloat16_t z;
+        z.v = ieee_format<8, 7>::from(a).v;
+        return z;
+    }
+
+    static inline float32_t toF32(ieee_format a) {
+        float32_t z;
+        z.v = ieee_format<8, 23>::from(a).v;
+        return z;
+    }
+
+    static inline float64_t toF64(ieee_format a) {
+        float64_t z;
+        z.v = ieee_format<11, 52>::from(a).v;
+        return z;
+    }
+
+    // Exact: extFloat80_t holds every ieee_format.
+    static extFloat80_t toExtF80(ieee_format a) {
+        uiType uiA = a.v;
+        bool sign = signUI(uiA);
+        int_fast32_t exp = expUI(uiA);
+        extFloat80_t z;
+        z.signExp = (uint16_t) sign << 15;
+        z.signif = 0;
+        if (exp == expMax) {
+            z.signExp |= 0x7FFF;
+            if (!fracUI(uiA)) {
+                z.signif = UINT64_C(0x8000000000000000);
+            } else {
+                if (isSigNaNUI(uiA)) softfloat_raiseFlags(softfloat_flag_invalid);
+                z.signif = UINT64_C(0xC000000000000000) | nanPayload(uiA) >> 1;
+            }
+            return z;
+        }
+        if (!(exp | fracUI(uiA))) return z;
+        uint64_t sig = (uint64_t) unpack(uiA, exp) << (63 - FracBits);
+        exp += 0x3FFF - bias;
+        if (exp <= 0) {
+            sig >>= 1 - exp;
+            exp = 0;
+        }
+        z.signExp |= (uint16_t) exp;
+        z.signif = sig;
+        return z;
+    }
+
+    static inline float128_t toF128(ieee_format a) {
+        extFloat80_t x = toExtF80(a);
+        float128_t z;
+        extF80M_to_f128M(&x, &z);
+        return z;
+    }
+
+    /*------------------------------------------------------------------------
+    | Conversions to integers (invalid results as in the 8086 specialization)
+    *------------------------------------------------------------------------*/
+    // Rounds |a| to an integer magnitude; false if NaN, infinite or >= 2^64.
+    static bool roundToMag(uiType uiA, uint_fast8_t roundingMode, uint64_t &mag, bool &inexact) {
+        int_fast32_t exp = expUI(uiA);
+        bool sign = signUI(uiA);
+        mag = 0;
+        inexact = false;
+        if (exp == expMax) return false;
+        if (!(exp | fracUI(uiA))) return true;
+        uint64_t sig = (uint64_t) unpack(uiA, exp) << (63 - FracBits);
+        int_fast32_t dist = 63 - (exp - bias);
+        uint64_t extra;
+        if (dist < 0) return false;
+        if (!dist) {
+            mag = sig;
+            extra = 0;
+        } else if (dist < 64) {
+            mag = sig >> dist;
+            extra = sig << (64 - dist);
+        } else {
+            extra = (dist == 64) ? sig : 1;
+        }
+        if (!extra) return true;
+        inexact = true;
+        bool increment = false;
+        switch (roundingMode) {
+         case softfloat_round_near_even:
+            increment = (extra > UINT64_C(0x8000000000000000))
+                     || ((extra == UINT64_C(0x8000000000000000)) && (mag & 1));
+            break;
+         case softfloat_round_near_maxMag:
+            increment = (extra >= UINT64_C(0x8000000000000000));
+            break;
+         case softfloat_round_min:
+            increment = sign;
+            break;
+         case softfloat_round_max:
+            increment = !sign;
+            break;
+        }
+        if (increment && !++mag) return false;
+        return true;
+    }
+
+    static int_fast64_t toI64(ieee_format a, uint_fast8_t roundingMode, bool exact) {
+        uint64_t mag;
+        bool inexact, sign = signUI(a.v);
+        if (!roundToMag(a.v, roundingMode, mag, inexact)
+                || (mag > (sign ? UINT64_C(0x8000000000000000) : UINT64_C(0x7FFFFFFFFFFFFFFF)))) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return -INT64_C(0x7FFFFFFFFFFFFFFF) - 1;
+        }
+        if (inexact && exact) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        return sign ? -(int_fast64_t) (mag - 1) - 1 : (int_fast64_t) mag;
+    }
+
+    static uint_fast64_t toUI64(ieee_format a, uint_fast8_t roundingMode, bool exact) {
+        uint64_t mag;
+        bool inexact;
+        if (!roundToMag(a.v, roundingMode, mag, inexact) || (signUI(a.v) && mag)) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return UINT64_C(0xFFFFFFFFFFFFFFFF);
+        }
+        if (inexact && exact) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        return mag;
+    }
+
+    static int_fast32_t toI32(ieee_format a, uint_fast8_t roundingMode, bool exact) {
+        uint64_t mag;
+        bool inexact, sign = signUI(a.v);
+        if (!roundToMag(a.v, roundingMode, mag, inexact)
+                || (mag > (sign ? UINT64_C(0x80000000) : UINT64_C(0x7FFFFFFF)))) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return -0x7FFFFFFF - 1;
+        }
+        if (inexact && exact) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        return sign ? -(int_fast32_t) (mag - 1) - 1 : (int_fast32_t) mag;
+    }
+
+    static uint_fast32_t toUI32(ieee_format a, uint_fast8_t roundingMode, bool exact) {
+        uint64_t mag;
+        bool inexact;
+        if (!roundToMag(a.v, roundingMode, mag, inexact)
+                || (signUI(a.v) && mag) || (mag > UINT64_C(0xFFFFFFFF))) {
+            softfloat_raiseFlags(softfloat_flag_invalid);
+            return 0xFFFFFFFF;
+        }
+        if (inexact && exact) softfloat_exceptionFlags |= softfloat_flag_inexact;
+        return (uint_fast32_t) mag;
+    }
+
+    /*------------------------------------------------------------------------
+    | Sign operations and classification (exact, no flags)
+    *------------------------------------------------------------------------*/
+    static inline ieee_format neg(ieee_format a) { return fromBits(a.v ^ packUI(1, 0, 0)); }
+    static inline ieee_format abs(ieee_format a) { return fromBits(a.v & ~packUI(1, 0, 0)); }
+
+    static inline ieee_format copySign(ieee_format a, ieee_format b) {
+        return fromBits((a.v & ~packUI(1, 0, 0)) | (b.v & packUI(1, 0, 0)));
+    }
+
+    static inline bool signbit(ieee_format a) { return signUI(a.v); }
+    static inline bool isNaN(ieee_format a) { return isNaNUI(a.v); }
+    static inline bool isInf(ieee_format a) { return expUI(a.v) == expMax && !fracUI(a.v); }
+
+    static inline uint_fast16_t classify(ieee_format a) {
+        uiType uiA = a.v;
+        return softfloat_packClass(
+            signUI(uiA), !expUI(uiA), expUI(uiA) == expMax, !fracUI(uiA),
+            (uiA & quietBit()) != 0);
+    }
+};
@@ -42,12 +42,24 @@ Extended for float8 by Stefan Mach, Integrated Systems Institute, ETH Zurich
 #define internals_h 1
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "primitives.h"
 #include "softfloat_types.h"
 
+/*----------------------------------------------------------------------------
+| Everything declared below is internal to the library.  Giving it hidden
+| visibility lets calls between library routines bind directly instead of
+| going through the PLT when SoftFloat is built as a shared object.
+*----------------------------------------------------------------------------*/
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility push(hidden)
+#endif
+
 union ui8_f8   { uint8_t ui;  float8_t  f; };
+union ui8_e4m3 { uint8_t ui;  e4m3_t    f; };
 union ui16_f16 { uint16_t ui; float16_t f; };
+union ui16_bf16 { uint16_t ui; bfloat16_t f; };
 union ui32_f32 { uint32_t ui; float32_t f; };
 union ui64_f64 { uint64_t ui; float64_t f; };
 
@@ -61,6 +73,31 @@ enum {
     softfloat_mulAdd_subProd = 2
 };
 
+/*----------------------------------------------------------------------------
+| Increments 'softfloat_stochasticCounter' and returns 64 random bits hashed
+| from it and 'softfloat_stochasticSeed' (SplitMix64).
+*----------------------------------------------------------------------------*/
+uint_fast64_t softfloat_stochasticBits( void );
+
+/*----------------------------------------------------------------------------
+| Like 'softfloat_shiftRightJam64', except in rounding mode "stochastic",
+| where the bits shifted off are not jammed but round the shifted value up by
+| one with a probability equal to their value, and raise the inexact
+| exception when nonzero.  The shifted value of an 'a' whose bits shifted off
+| are all ones can therefore carry out of the width of 'a>>dist'.  This lets
+| the rounding bits kept for 'softfloat_roundPackTo...' stand for the whole
+| discarded part instead of jamming it into a sticky bit.
+*----------------------------------------------------------------------------*/
+uint64_t softfloat_shiftRightStochJam64( uint64_t a, uint_fast32_t dist );
+
+/*----------------------------------------------------------------------------
+| Returns 'a' with the bits 'rem' discarded below it, aligned to the top of a
+| 64-bit word, jammed into its least-significant bit.  In rounding mode
+| "stochastic", 'a' is instead rounded up by one with a probability of
+| 'rem' / 2^64, and the inexact exception is raised when 'rem' is nonzero.
+*----------------------------------------------------------------------------*/
+uint64_t softfloat_stochJam64( uint64_t a, uint64_t rem );
+
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
 uint_fast32_t softfloat_roundToUI32( bool, uint_fast64_t, uint_fast8_t, bool );
@@ -83,6 +120,26 @@ int_fast64_t
 int_fast64_t softfloat_roundMToI64( bool, uint32_t *, uint_fast8_t, bool );
 #endif
 
+/*----------------------------------------------------------------------------
+| 128-bit integers: their upper and lower 64 bits, and the integer formed
+| from the two halves.  The rounding routines take a 5-word integer whose
+| least-significant word is the fraction, like 'softfloat_roundMToI64'.
+*----------------------------------------------------------------------------*/
+#ifdef __SIZEOF_INT128__
+#define int128V64( a ) ((uint64_t) ((uint128_t) (a)>>64))
+#define int128V0( a ) ((uint64_t) (a))
+#define packToUI128( a64, a0 ) ((uint128_t) (a64)<<64 | (a0))
+#define packToI128( a64, a0 ) ((int128_t) packToUI128( a64, a0 ))
+#else
+#define int128V64( a ) ((a).v64)
+#define int128V0( a ) ((a).v0)
+#define packToUI128( a64, a0 ) ((uint128_t) { .v0 = (a0), .v64 = (a64) })
+#define packToI128( a64, a0 ) ((int128_t) { .v0 = (a0), .v64 = (a64) })
+#endif
+
+uint128_t softfloat_roundMToUI128( bool, uint32_t *, uint_fast8_t, bool );
+int128_t softfloat_roundMToI128( bool, uint32_t *, uint_fast8_t, bool );
+
 /*----------------------------------------------------------------------------
 | Added float8 functions (smach)
 *----------------------------------------------------------------------------*/
@@ -105,6 +162,217 @@ float8_t
  softfloat_mulAddF8(
      uint_fast8_t, uint_fast8_t, uint_fast8_t, uint_fast8_t );
 
+/*----------------------------------------------------------------------------
+| bfloat16 is the upper half of binary32: its operations run on binary32
+| through softfloat_opToBF16.
+*----------------------------------------------------------------------------*/
+#define signBF16UI( a ) ((bool) ((uint16_t) (a)>>15))
+#define expBF16UI( a ) ((int_fast16_t) ((a)>>7) & 0xFF)
+#define fracBF16UI( a ) ((a) & 0x007F)
+#define packToBF16UI( sign, exp, sig ) (((uint16_t) (sign)<<15) + ((uint16_t) (exp)<<7) + (sig))
+
+#define isNaNBF16UI( a ) (((~(a) & 0x7F80) == 0) && ((a) & 0x007F))
+
+bfloat16_t softfloat_roundPackToBF16( bool, int_fast16_t, uint_fast32_t );
+bfloat16_t softfloat_normRoundPackToBF16( bool, int_fast16_t, uint_fast32_t );
+
+enum {
+    softfloat_opBF16_add = 0,
+    softfloat_opBF16_sub,
+    softfloat_opBF16_mul,
+    softfloat_opBF16_mulAdd,
+    softfloat_opBF16_div,
+    softfloat_opBF16_sqrt
+};
+bfloat16_t
+ softfloat_opToBF16( uint_fast8_t, uint_fast16_t, uint_fast16_t, uint_fast16_t );
+
+/*----------------------------------------------------------------------------
+| OCP E4M3: bias 7, the top exponent holds finite values and S.1111.111 is the
+| only NaN.  Binary operations and conversions from 16-bit formats use lazily
+| built tables when rounding to nearest even (softfloat_tableE4M3).
+*----------------------------------------------------------------------------*/
+#define signE4M3UI( a ) ((bool) ((uint8_t) (a)>>7))
+#define expE4M3UI( a ) ((int_fast8_t) ((a)>>3) & 0xF)
+#define fracE4M3UI( a ) ((a) & 0x07)
+#define packToE4M3UI( sign, exp, sig ) (((uint8_t) (sign)<<7) + ((uint8_t) (exp)<<3) + (sig))
+
+#define isNaNE4M3UI( a ) (((a) & 0x7F) == 0x7F)
+
+/*----------------------------------------------------------------------------
+| The encoding standing in for an infinity of sign 'sign': NaN, or the largest
+| finite value when saturating.
+*----------------------------------------------------------------------------*/
+#define softfloat_infToE4M3UI( sign ) (packToE4M3UI( sign, 0xF, 6 ) | (e4m3_overflowMode != e4m3_overflow_saturate))
+
+extern const uint32_t softfloat_e4m3ToF32UI[256];
+extern const uint16_t softfloat_e4m3ToF16UI[256];
+
+e4m3_t softfloat_roundPackToE4M3( bool, int_fast16_t, uint_fast32_t );
+e4m3_t softfloat_normRoundPackToE4M3( bool, int_fast16_t, uint_fast32_t );
+
+enum {
+    softfloat_opE4M3_add = 0,
+    softfloat_opE4M3_sub,
+    softfloat_opE4M3_mul,
+    softfloat_opE4M3_div,
+    softfloat_opE4M3_fromF16,
+    softfloat_opE4M3_fromBF16,
+    softfloat_opE4M3_tables,
+    softfloat_opE4M3_mulAdd = softfloat_opE4M3_tables,
+    softfloat_opE4M3_sqrt
+};
+e4m3_t
+ softfloat_opToE4M3( uint_fast8_t, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+const uint16_t *softfloat_tableE4M3( uint_fast8_t );
+uint_fast8_t softfloat_entryToE4M3UI( uint_fast16_t );
+
+/*----------------------------------------------------------------------------
+| MX block formats: element rounding (of an already scaled, finite value) and
+| exact binary32 values of the elements, FP6/FP4 decoding tables, scaling of
+| a binary32 value by 2^exp with a single rounding, and block (un)packing.
+*----------------------------------------------------------------------------*/
+extern const uint32_t softfloat_e3m2ToF32UI[64];
+extern const uint32_t softfloat_e2m3ToF32UI[64];
+extern const uint32_t softfloat_e2m1ToF32UI[16];
+
+uint_fast8_t softfloat_f64ToMXUI( uint_fast8_t, float64_t );
+uint_fast32_t softfloat_mxToF32UI( uint_fast8_t, uint_fast8_t );
+uint_fast32_t softfloat_mxScaleF32UI( uint_fast32_t, int_fast16_t );
+void
+ softfloat_mxQuantizeBlock( uint_fast8_t, const uint32_t *, size_t, uint8_t * );
+uint_fast8_t
+ softfloat_mxUnpackBlock( uint_fast8_t, const uint8_t *, uint32_t * );
+
+/*----------------------------------------------------------------------------
+| FP6 and FP4 arithmetic.  Round-to-nearest-even results come from the static
+| tables (see s_tablesE3M2.c); the other rounding modes and mulAdd compute in
+| binary64 and round once with softfloat_f64ToMXUI.
+*----------------------------------------------------------------------------*/
+extern const uint16_t softfloat_addE3M2[4096];
+extern const uint16_t softfloat_mulE3M2[4096];
+extern const uint16_t softfloat_divE3M2[4096];
+extern const uint16_t softfloat_sqrtE3M2[64];
+extern const uint16_t softfloat_addE2M3[4096];
+extern const uint16_t softfloat_mulE2M3[4096];
+extern const uint16_t softfloat_divE2M3[4096];
+extern const uint16_t softfloat_sqrtE2M3[64];
+extern const uint16_t softfloat_addE2M1[256];
+extern const uint16_t softfloat_mulE2M1[256];
+extern const uint16_t softfloat_divE2M1[256];
+extern const uint16_t softfloat_sqrtE2M1[16];
+
+enum {
+    softfloat_opMX_add = 0,
+    softfloat_opMX_sub,
+    softfloat_opMX_mul,
+    softfloat_opMX_mulAdd,
+    softfloat_opMX_div,
+    softfloat_opMX_sqrt
+};
+uint_fast8_t
+ softfloat_opToMXUI(
+     uint_fast8_t, uint_fast8_t, uint_fast8_t, uint_fast8_t, uint_fast8_t );
+uint_fast8_t softfloat_entryToMXUI( uint_fast16_t );
+
+/*----------------------------------------------------------------------------
+| Fixed-point elements of the batch conversions: 'softfloat_f64ToFixed' rounds
+| 'a' * 2^'fracBits' to an integer once, saturates it to the range of 'type'
+| and stores it at element 'i' of 'zPtr'; 'softfloat_fixedToF64' returns
+| element 'i' of 'aPtr' times 2^-'fracBits', which is always exact.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_f64ToFixed(
+     uint_fast8_t, int_fast8_t, float64_t, void *, size_t );
+float64_t
+ softfloat_fixedToF64( uint_fast8_t, int_fast8_t, const void *, size_t );
+
+/*----------------------------------------------------------------------------
+| Round-to-nearest-even batch conversions between fixed point and float32_t
+| ('sigBits' = 23) or float16_t ('sigBits' = 10) elements, with the results
+| and flags of the element-wise kernels above.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_toFixedNearEven(
+     uint_fast8_t, int_fast8_t, uint_fast8_t, const void *, void *, size_t );
+void
+ softfloat_fromFixedNearEven(
+     uint_fast8_t, int_fast8_t, const void *, uint_fast8_t, void *, size_t );
+
+/*----------------------------------------------------------------------------
+| Posits of 'n' bits with 'es' exponent bits, held in the low 'n' bits of the
+| integer.  Unpacked, a nonzero magnitude is a scale and a significand in
+| [2^30, 2^31) (value sig * 2^(scale - 30)).  Results are rounded to nearest
+| even on the encoding and never to zero or NaR; no flags are raised.
+*----------------------------------------------------------------------------*/
+#define softfloat_positNaRUI( n ) ((uint_fast32_t) 1<<((n) - 1))
+#define softfloat_positMaskUI( n ) ((uint_fast32_t) (((uint_fast64_t) 1<<(n)) - 1))
+
+struct exp16_sig32
+ softfloat_unpackPositUI( uint_fast8_t, uint_fast8_t, uint_fast32_t );
+uint_fast32_t
+ softfloat_normRoundPackToPositUI(
+     uint_fast8_t, uint_fast8_t, bool, int_fast32_t, uint_fast64_t );
+uint_fast32_t
+ softfloat_addSigsToPositUI(
+     uint_fast8_t,
+     uint_fast8_t,
+     bool,
+     int_fast32_t,
+     uint_fast64_t,
+     bool,
+     int_fast32_t,
+     uint_fast64_t
+ );
+uint_fast32_t
+ softfloat_addPositUI( uint_fast8_t, uint_fast8_t, uint_fast32_t, uint_fast32_t );
+uint_fast32_t
+ softfloat_mulPositUI( uint_fast8_t, uint_fast8_t, uint_fast32_t, uint_fast32_t );
+uint_fast32_t
+ softfloat_mulAddPositUI(
+     uint_fast8_t, uint_fast8_t, uint_fast32_t, uint_fast32_t, uint_fast32_t );
+uint_fast32_t
+ softfloat_divPositUI( uint_fast8_t, uint_fast8_t, uint_fast32_t, uint_fast32_t );
+uint_fast32_t softfloat_sqrtPositUI( uint_fast8_t, uint_fast8_t, uint_fast32_t );
+uint_fast32_t
+ softfloat_f64ToPositUI( uint_fast8_t, uint_fast8_t, uint_fast64_t );
+uint_fast64_t
+ softfloat_positToF64UI( uint_fast8_t, uint_fast8_t, uint_fast32_t );
+uint_fast32_t
+ softfloat_positToPositUI(
+     uint_fast8_t, uint_fast8_t, uint_fast8_t, uint_fast8_t, uint_fast32_t );
+
+/*----------------------------------------------------------------------------
+| A quire of 'words' 64-bit words has 2*(n - 2)*2^es fraction bits; NaR is
+| the most negative value.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_quireFdp(
+     uint_fast8_t,
+     uint_fast8_t,
+     uint64_t *,
+     uint_fast8_t,
+     uint_fast32_t,
+     uint_fast32_t,
+     bool
+ );
+uint_fast32_t
+ softfloat_quireToPositUI(
+     uint_fast8_t, uint_fast8_t, const uint64_t *, uint_fast8_t );
+
+/*----------------------------------------------------------------------------
+| posit8 addition, multiplication and division are looked up in 64K-entry
+| tables (index a<<8 | b), and square root in a 256-entry one, built on
+| first use.  A null pointer means the table could not be allocated.
+*----------------------------------------------------------------------------*/
+enum {
+    softfloat_opP8_add = 0,
+    softfloat_opP8_mul,
+    softfloat_opP8_div,
+    softfloat_opP8_sqrt
+};
+const uint8_t *softfloat_tableP8( uint_fast8_t );
+
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
 #define signF16UI( a ) ((bool) ((uint16_t) (a)>>15))
@@ -147,6 +415,21 @@ float32_t
  softfloat_mulAddF32(
      uint_fast32_t, uint_fast32_t, uint_fast32_t, uint_fast8_t );
 
+/*----------------------------------------------------------------------------
+| TF32 values are binary32 values whose lower 13 fraction bits are zero.  Its
+| operations run on binary32 through softfloat_opToTF32.
+*----------------------------------------------------------------------------*/
+enum {
+    softfloat_opTF32_add = 0,
+    softfloat_opTF32_sub,
+    softfloat_opTF32_mul,
+    softfloat_opTF32_mulAdd,
+    softfloat_opTF32_div,
+    softfloat_opTF32_sqrt
+};
+float32_t
+ softfloat_opToTF32( uint_fast8_t, uint_fast32_t, uint_fast32_t, uint_fast32_t );
+
 /*----------------------------------------------------------------------------
 *----------------------------------------------------------------------------*/
 #define signF64UI( a ) ((bool) ((uint64_t) (a)>>63))
@@ -159,6 +442,14 @@ float32_t
 struct exp16_sig64 { int_fast16_t exp; uint_fast64_t sig; };
 struct exp16_sig64 softfloat_normSubnormalF64Sig( uint_fast64_t );
 
+/*----------------------------------------------------------------------------
+| Shifts the 128-bit unsigned integer 'a64':'a0' right by the least distance
+| that leaves it below 2^'width' ('width' < 64), jamming any nonzero bits
+| shifted off into the least-significant bit.  Returns the shifted value as
+| 'sig' and the distance as 'exp'.
+*----------------------------------------------------------------------------*/
+struct exp16_sig64 softfloat_narrowUI128( uint64_t, uint64_t, uint_fast8_t );
+
 float64_t softfloat_roundPackToF64( bool, int_fast16_t, uint_fast64_t );
 float64_t softfloat_normRoundPackToF64( bool, int_fast16_t, uint_fast64_t );
 
@@ -299,7 +590,25 @@ void
      uint_fast8_t
  );
 
+/*----------------------------------------------------------------------------
+| Multiword floating-point.  'softfloat_normRoundPackMToBigF' rounds the
+| value sig * 2^(exp + 1 - 32 * size_words) to the precision of 'zPtr',
+| where 'sigPtr' points to an integer of 'size_words' words (overwritten); a
+| zero significand gives a zero of the given sign.  The comparison returns
+| the sign of A - B for operands that are not NaNs.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_normRoundPackMToBigF(
+     bool, int32_t, uint_fast8_t, uint32_t *, bigFloat_t * );
+void
+ softfloat_addBigF(
+     const bigFloat_t *, const bigFloat_t *, bigFloat_t *, bool );
+int softfloat_compareBigF( const bigFloat_t *, const bigFloat_t * );
+
 #endif
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility pop
 #endif
 
+#endif
@@ -0,0 +1,316 @@
+/*
+ * C++ wrappers for the posit types, in the style of softfloat.hpp.
+ *
+ * posit<T> wraps posit8_t, posit16_t or posit32_t with the arithmetic,
+ * relational and compound-assignment operators, so templated kernels can
+ * swap posit8/posit16/posit32 for the softfloat types.  quire<T> is the
+ * matching exact accumulator:
+ *
+ *   quire16 q;
+ *   for (size_t i = 0; i < n; ++i)
+ *       q.fdp_add(x[i], y[i]);
+ *   posit16 dot = q.value();    // rounded once
+ *
+ * Conversions from and to float and double are exact where the target holds
+ * the value and otherwise round once (posits to nearest even, binary32 in the
+ * current rounding mode).
+ */
+
+#pragma once
+#include "softfloat.h"
+
+#include <cstring>
+#include <ostream>
+
+template <typename T> struct posit_format;
+
+template <> struct posit_format<posit8_t> {
+    typedef uint8_t storage;
+    typedef quire8_t quire;
+    static const int bits = 8, es = 0;
+};
+
+template <> struct posit_format<posit16_t> {
+    typedef uint16_t storage;
+    typedef quire16_t quire;
+    static const int bits = 16, es = 1;
+};
+
+template <> struct posit_format<posit32_t> {
+    typedef uint32_t storage;
+    typedef quire32_t quire;
+    static const int bits = 32, es = 2;
+};
+
+/*----------------------------------------------------------------------------
+| Overloads forwarding to the C functions of each format.
+*----------------------------------------------------------------------------*/
+static inline posit8_t posit_add(posit8_t a, posit8_t b) { return p8_add(a, b); }
+static inline posit8_t posit_sub(posit8_t a, posit8_t b) { return p8_sub(a, b); }
+static inline posit8_t posit_mul(posit8_t a, posit8_t b) { return p8_mul(a, b); }
+static inline posit8_t posit_div(posit8_t a, posit8_t b) { return p8_div(a, b); }
+static inline posit8_t posit_mulAdd(posit8_t a, posit8_t b, posit8_t c) { return p8_mulAdd(a, b, c); }
+static inline posit8_t posit_sqrt(posit8_t a) { return p8_sqrt(a); }
+static inline posit8_t posit_neg(posit8_t a) { return p8_neg(a); }
+static inline posit8_t posit_abs(posit8_t a) { return p8_abs(a); }
+static inline bool posit_isNaR(posit8_t a) { return p8_isNaR(a); }
+static inline bool posit_eq(posit8_t a, posit8_t b) { return p8_eq(a, b); }
+static inline bool posit_le(posit8_t a, posit8_t b) { return p8_le(a, b); }
+static inline bool posit_lt(posit8_t a, posit8_t b) { return p8_lt(a, b); }
+static inline float32_t posit_toF32(posit8_t a) { return p8_to_f32(a); }
+static inline float64_t posit_toF64(posit8_t a) { return p8_to_f64(a); }
+static inline void posit_fromF32(float32_t a, posit8_t &z) { z = f32_to_p8(a); }
+static inline void posit_fromF64(float64_t a, posit8_t &z) { z = f64_to_p8(a); }
+static inline void posit_clr(quire8_t &q) { q8_clr(&q); }
+static inline void posit_fdpAdd(quire8_t &q, posit8_t a, posit8_t b) { q8_fdp_add(&q, a, b); }
+static inline void posit_fdpSub(quire8_t &q, posit8_t a, posit8_t b) { q8_fdp_sub(&q, a, b); }
+static inline posit8_t posit_fromQuire(const quire8_t &q) { return q8_to_p8(&q); }
+static inline void posit_convert(posit8_t a, posit8_t &z) { z = a; }
+static inline void posit_convert(posit8_t a, posit16_t &z) { z = p8_to_p16(a); }
+static inline void posit_convert(posit8_t a, posit32_t &z) { z = p8_to_p32(a); }
+
+static inline posit16_t posit_add(posit16_t a, posit16_t b) { return p16_add(a, b); }
+static inline posit16_t posit_sub(posit16_t a, posit16_t b) { return p16_sub(a, b); }
+static inline posit16_t posit_mul(posit16_t a, posit16_t b) { return p16_mul(a, b); }
+static inline posit16_t posit_div(posit16_t a, posit16_t b) { return p16_div(a, b); }
+static inline posit16_t posit_mulAdd(posit16_t a, posit16_t b, posit16_t c) { return p16_mulAdd(a, b, c); }
+static inline posit16_t posit_sqrt(posit16_t a) { return p16_sqrt(a); }
+static inline posit16_t posit_neg(posit16_t a) { return p16_neg(a); }
+static inline posit16_t posit_abs(posit16_t a) { return p16_abs(a); }
+static inline bool posit_isNaR(posit16_t a) { return p16_isNaR(a); }
+static inline bool posit_eq(posit16_t a, posit16_t b) { return p16_eq(a, b); }
+static inline bool posit_le(posit16_t a, posit16_t b) { return p16_le(a, b); }
+static inline bool posit_lt(posit16_t a, posit16_t b) { return p16_lt(a, b); }
+static inline float32_t posit_toF32(posit16_t a) { return p16_to_f32(a); }
+static inline float64_t posit_toF64(posit16_t a) { return p16_to_f64(a); }
+static inline void posit_fromF32(float32_t a, posit16_t &z) { z = f32_to_p16(a); }
+static inline void posit_fromF64(float64_t a, posit16_t &z) { z = f64_to_p16(a); }
+static inline void posit_clr(quire16_t &q) { q16_clr(&q); }
+static inline void posit_fdpAdd(quire16_t &q, posit16_t a, posit16_t b) { q16_fdp_add(&q, a, b); }
+static inline void posit_fdpSub(quire16_t &q, posit16_t a, posit16_t b) { q16_fdp_sub(&q, a, b); }
+static inline posit16_t posit_fromQuire(const quire16_t &q) { return q16_to_p16(&q); }
+static inline void posit_convert(posit16_t a, posit8_t &z) { z = p16_to_p8(a); }
+static inline void posit_convert(posit16_t a, posit16_t &z) { z = a; }
+static inline void posit_convert(posit16_t a, posit32_t &z) { z = p16_to_p32(a); }
+
+static inline posit32_t posit_add(posit32_t a, posit32_t b) { return p32_add(a, b); }
+static inline posit32_t posit_sub(posit32_t a, posit32_t b) { return p32_sub(a, b); }
+static inline posit32_t posit_mul(posit32_t a, posit32_t b) { return p32_mul(a, b); }
+static inline posit32_t posit_div(posit32_t a, posit32_t b) { return p32_div(a, b); }
+static inline posit32_t posit_mulAdd(posit32_t a, posit32_t b, posit32_t c) { return p32_mulAdd(a, b, c); }
+static inline posit32_t posit_sqrt(posit32_t a) { return p32_sqrt(a); }
+static inline posit32_t posit_neg(posit32_t a) { return p32_neg(a); }
+static inline posit32_t posit_abs(posit32_t a) { return p32_abs(a); }
+static inline bool posit_isNaR(posit32_t a) { return p32_isNaR(a); }
+static inline bool posit_eq(posit32_t a, posit32_t b) { return p32_eq(a, b); }
+static inline bool posit_le(posit32_t a, posit32_t b) { return p32_le(a, b); }
+static inline bool posit_lt(posit32_t a, posit32_t b) { return p32_lt(a, b); }
+static inline float32_t posit_toF32(posit32_t a) { return p32_to_f32(a); }
+static inline float64_t posit_toF64(posit32_t a) { return p32_to_f64(a); }
+static inline void posit_fromF32(float32_t a, posit32_t &z) { z = f32_to_p32(a); }
+static inline void posit_fromF64(float64_t a, posit32_t &z) { z = f64_to_p32(a); }
+static inline void posit_clr(quire32_t &q) { q32_clr(&q); }
+static inline void posit_fdpAdd(quire32_t &q, posit32_t a, posit32_t b) { q32_fdp_add(&q, a, b); }
+static inline void posit_fdpSub(quire32_t &q, posit32_t a, posit32_t b) { q32_fdp_sub(&q, a, b); }
+static inline posit32_t posit_fromQuire(const quire32_t &q) { return q32_to_p32(&q); }
+static inline void posit_convert(posit32_t a, posit8_t &z) { z = p32_to_p8(a); }
+static inline void posit_convert(posit32_t a, posit16_t &z) { z = p32_to_p16(a); }
+static inline void posit_convert(posit32_t a, posit32_t &z) { z = a; }
+
+template <typename T> class posit {
+protected:
+    T v;
+
+public:
+    // Empty constructor --> initialize to zero.
+    inline posit() {
+        v.v = 0;
+    }
+
+    // Constructor from wrapped type T
+    inline posit(const T &v) : v(v) {}
+
+    // Conversion from other posit types, rounded to nearest even (explicit:
+    // mixed-format arithmetic has no implied promotion)
+    template <typename U> inline explicit posit(const posit<U> &w) {
+        posit_convert(U(w), v);
+    }
+
+    // Constructors from native types: float and double convert exactly into
+    // binary64 first, so each of them rounds once.
+    inline posit(double d) {
+        float64_t a;
+        std::memcpy(&a.v, &d, sizeof d);
+        posit_fromF64(a, v);
+    }
+
+    inline posit(float f) {
+        float32_t a;
+        std::memcpy(&a.v, &f, sizeof f);
+        posit_fromF32(a, v);
+    }
+
+    inline posit(int i) {
+        posit_fromF64(i32_to_f64(i), v);
+    }
+
+    /*------------------------------------------------------------------------
+    | OPERATOR OVERLOADS: CASTS
+    *------------------------------------------------------------------------*/
+    inline operator T() const {
+        return v;
+    }
+
+    inline explicit operator float() const {
+        float32_t a = posit_toF32(v);
+        float f;
+        std::memcpy(&f, &a.v, sizeof f);
+        return f;
+    }
+
+    inline explicit operator double() const {
+        float64_t a = posit_toF64(v);
+        double d;
+        std::memcpy(&d, &a.v, sizeof d);
+        return d;
+    }
+
+    /*------------------------------------------------------------------------
+    | OPERATOR OVERLOADS: Arithmetics
+    *------------------------------------------------------------------------*/
+    inline posit operator-() const {
+        return posit_neg(v);
+    }
+
+    inline posit operator+() const {
+        return *this;
+    }
+
+    friend inline posit operator+(const posit &a, const posit &b) {
+        return posit_add(a.v, b.v);
+    }
+
+    friend inline posit operator-(const posit &a, const posit &b) {
+        return posit_sub(a.v, b.v);
+    }
+
+    friend inline posit operator*(const posit &a, const posit &b) {
+        return posit_mul(a.v, b.v);
+    }
+
+    friend inline posit operator/(const posit &a, const posit &b) {
+        return posit_div(a.v, b.v);
+    }
+
+    // a * b + c, rounded once
+    friend inline posit fma(const posit &a, const posit &b, const posit &c) {
+        return posit_mulAdd(a.v, b.v, c.v);
+    }
+
+    friend inline posit sqrt(const posit &a) {
+        return posit_sqrt(a.v);
+    }
+
+    friend inline posit abs(const posit &a) {
+        return posit_abs(a.v);
+    }
+
+    friend inline bool isnar(const posit &a) {
+        return posit_isNaR(a.v);
+    }
+
+    /*------------------------------------------------------------------------
+    | OPERATOR OVERLOADS: Relational operators (NaR is below every value)
+    *------------------------------------------------------------------------*/
+    inline bool operator==(const posit &b) const {
+        return posit_eq(v, b.v);
+    }
+
+    inline bool operator!=(const posit &b) const {
+        return !posit_eq(v, b.v);
+    }
+
+    inline bool operator<(const posit &b) const {
+        return posit_lt(v, b.v);
+    }
+
+    inline bool operator<=(const posit &b) const {
+        return posit_le(v, b.v);
+    }
+
+    inline bool operator>(const posit &b) const {
+        return posit_lt(b.v, v);
+    }
+
+    inline bool operator>=(const posit &b) const {
+        return posit_le(b.v, v);
+    }
+
+    /*------------------------------------------------------------------------
+    | OPERATOR OVERLOADS: Compound assignment operators
+    *------------------------------------------------------------------------*/
+    inline posit &operator+=(const posit &b) {
+        return *this = *this + b;
+    }
+
+    inline posit &operator-=(const posit &b) {
+        return *this = *this - b;
+    }
+
+    inline posit &operator*=(const posit &b) {
+        return *this = *this * b;
+    }
+
+    inline posit &operator/=(const posit &b) {
+        return *this = *this / b;
+    }
+
+    /*------------------------------------------------------------------------
+    | OPERATOR OVERLOADS: IO streams operators
+    *------------------------------------------------------------------------*/
+    friend std::ostream &operator<<(std::ostream &os, const posit &obj) {
+        return os << (double) obj;
+    }
+
+};
+
+/*----------------------------------------------------------------------------
+| Exact accumulator of posit<T> products.
+*----------------------------------------------------------------------------*/
+template <typename T> class quire {
+protected:
+    typename posit_format<T>::quire q;
+
+public:
+    inline quire() {
+        posit_clr(q);
+    }
+
+    inline void clear() {
+        posit_clr(q);
+    }
+
+    // q += a * b and q -= a * b, exactly
+    inline quire &fdp_add(const posit<T> &a, const posit<T> &b) {
+        posit_fdpAdd(q, a, b);
+        return *this;
+    }
+
+    inline quire &fdp_sub(const posit<T> &a, const posit<T> &b) {
+        posit_fdpSub(q, a, b);
+        return *this;
+    }
+
+    // The accumulated value, rounded once
+    inline posit<T> value() const {
+        return posit_fromQuire(q);
+    }
+
+};
+
+typedef posit<posit8_t>  posit8;
+typedef posit<posit16_t> posit16;
+typedef posit<posit32_t> posit32;
+typedef quire<posit8_t>  quire8;
+typedef quire<posit16_t> quire16;
+typedef quire<posit32_t> quire32;
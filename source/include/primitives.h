@@ -45,6 +45,10 @@ Extended for float8 by Stefan Mach, Integrated Systems Institute, ETH Zurich
 #include <stdint.h>
 #include "primitiveTypes.h"
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility push(hidden)
+#endif
+
 #ifndef softfloat_shortShiftRightJam64
 /*----------------------------------------------------------------------------
 | Shifts 'a' right by the number of bits given in 'dist', which must be in
@@ -1176,7 +1180,64 @@ void
 #define softfloat_remStep160MBy32( remPtr, dist, bPtr, q, zPtr ) softfloat_remStepMBy32( 5, remPtr, dist, bPtr, q, zPtr )
 #endif
 
+#ifndef softfloat_mulM
+/*----------------------------------------------------------------------------
+| Multiplies the two N-bit unsigned integers pointed to by 'aPtr' and 'bPtr',
+| where N = 'size_words' * 32, and stores the 2N-bit product at the location
+| pointed to by 'zPtr'.  Each of 'aPtr' and 'bPtr' points to a 'size_words'-
+| long array of 32-bit elements that concatenate in the platform's normal
+| endian order to form an N-bit integer; 'zPtr' points to an array twice as
+| long, which must not overlap the operands.  Large operands are multiplied
+| by Karatsuba's method.  'size_words' can be at most 64.
+*----------------------------------------------------------------------------*/
+void
+ softfloat_mulM(
+     uint_fast8_t size_words,
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint32_t *zPtr
+ );
+#endif
+
+#ifndef softfloat_divRemM
+/*----------------------------------------------------------------------------
+| Divides the unsigned integer A of 'sizeA_words' 32-bit words pointed to by
+| 'remPtr' by the integer B of 'sizeB_words' words pointed to by 'bPtr',
+| storing the quotient, 'sizeA_words' - 'sizeB_words' words long, at 'qPtr'
+| and the remainder in the low 'sizeB_words' words of A (the other words of A
+| are cleared).  All three integers are arrays of 32-bit elements in the
+| platform's normal endian order.  The most-significant bit of B must be set,
+| and the top 'sizeB_words' words of A must form an integer less than B (as
+| they do when the top word of A is zero).
+*----------------------------------------------------------------------------*/
+void
+ softfloat_divRemM(
+     uint_fast8_t sizeA_words,
+     uint32_t *remPtr,
+     uint_fast8_t sizeB_words,
+     const uint32_t *bPtr,
+     uint32_t *qPtr
+ );
+#endif
+
+#ifndef softfloat_sqrtM
+/*----------------------------------------------------------------------------
+| Stores at 'zPtr' the square root, truncated to an integer, of the unsigned
+| integer of 2 * 'size_words' 32-bit words pointed to by 'aPtr', and returns
+| true if the root is inexact.  Both integers are arrays of 32-bit elements in
+| the platform's normal endian order, and at least one of the two most-
+| significant bits of the operand must be set, so that the root has its most-
+| significant bit set.  'size_words' can be at most 64.
+*----------------------------------------------------------------------------*/
+bool
+ softfloat_sqrtM(
+     uint_fast8_t size_words, const uint32_t *aPtr, uint32_t *zPtr );
 #endif
 
 #endif
 
+#if defined __GNUC__ && (4 <= __GNUC__)
+#pragma GCC visibility pop
+#endif
+
+#endif
@@ -55,6 +55,7 @@ extern "C" {
 #define softfloat_h 1
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "softfloat_types.h"
 
@@ -82,9 +83,32 @@ enum {
     softfloat_round_min         = 2,
     softfloat_round_max         = 3,
     softfloat_round_near_maxMag = 4,
-    softfloat_round_odd         = 6
+    softfloat_round_odd         = 6,
+    softfloat_round_stochastic  = 7
 };
 
+/*----------------------------------------------------------------------------
+| Random source of mode "stochastic", which rounds away from zero with a
+| probability equal to the part of an ulp being discarded.  That part is
+| resolved exactly by the addition, subtraction and multiplication of
+| float8_t, float16_t, bfloat16_t, float32_t and float64_t and by the
+| conversions from float32_t and float64_t to the narrower formats.  The fused
+| multiply-adds of float8_t and float16_t resolve it to 2^-12 and 2^-20 of an
+| ulp; other operations only to their rounding bits, below which it is
+| jammed into a sticky bit (4 bits for 8- and 16-bit formats, 7 for binary32,
+| 10 for binary64, 23 for bfloat16).
+| A tiny result raises the underflow exception in this mode only if some of
+| its rounding bits are nonzero once the part below them has been rounded.
+| The mode is supported by the operations and conversions rounding to
+| float8_t, float16_t, bfloat16_t, float32_t and float64_t and by the
+| conversions to fixed point; other results are rounded toward zero in this
+| mode.  Each draw of random bits increments the thread's
+| 'softfloat_stochasticCounter' and hashes it with 'softfloat_stochasticSeed',
+| so setting both replays the same roundings.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL uint_fast64_t softfloat_stochasticSeed;
+extern THREAD_LOCAL uint_fast64_t softfloat_stochasticCounter;
+
 /*----------------------------------------------------------------------------
 | Software floating-point exception flags.
 *----------------------------------------------------------------------------*/
@@ -107,6 +131,8 @@ void softfloat_raiseFlags( uint_fast8_t );
 | -> added float8 support (smach)
 *----------------------------------------------------------------------------*/
 float8_t  ui32_to_f8 ( uint32_t );
+bfloat16_t ui32_to_bf16( uint32_t );
+e4m3_t ui32_to_e4m3( uint32_t );
 float16_t ui32_to_f16( uint32_t );
 float32_t ui32_to_f32( uint32_t );
 float64_t ui32_to_f64( uint32_t );
@@ -117,6 +143,8 @@ float128_t ui32_to_f128( uint32_t );
 void ui32_to_extF80M( uint32_t, extFloat80_t * );
 void ui32_to_f128M( uint32_t, float128_t * );
 float8_t  ui64_to_f8 ( uint64_t );
+bfloat16_t ui64_to_bf16( uint64_t );
+e4m3_t ui64_to_e4m3( uint64_t );
 float16_t ui64_to_f16( uint64_t );
 float32_t ui64_to_f32( uint64_t );
 float64_t ui64_to_f64( uint64_t );
@@ -126,7 +154,10 @@ float128_t ui64_to_f128( uint64_t );
 #endif
 void ui64_to_extF80M( uint64_t, extFloat80_t * );
 void ui64_to_f128M( uint64_t, float128_t * );
+void ui64_to_bigF( uint64_t, bigFloat_t * );
 float8_t  i32_to_f8 ( int32_t );
+bfloat16_t i32_to_bf16( int32_t );
+e4m3_t i32_to_e4m3( int32_t );
 float16_t i32_to_f16( int32_t );
 float32_t i32_to_f32( int32_t );
 float64_t i32_to_f64( int32_t );
@@ -137,6 +168,8 @@ float128_t i32_to_f128( int32_t );
 void i32_to_extF80M( int32_t, extFloat80_t * );
 void i32_to_f128M( int32_t, float128_t * );
 float8_t  i64_to_f8 ( int64_t );
+bfloat16_t i64_to_bf16( int64_t );
+e4m3_t i64_to_e4m3( int64_t );
 float16_t i64_to_f16( int64_t );
 float32_t i64_to_f32( int64_t );
 float64_t i64_to_f64( int64_t );
@@ -146,6 +179,17 @@ float128_t i64_to_f128( int64_t );
 #endif
 void i64_to_extF80M( int64_t, extFloat80_t * );
 void i64_to_f128M( int64_t, float128_t * );
+void i64_to_bigF( int64_t, bigFloat_t * );
+float16_t ui128_to_f16( uint128_t );
+float32_t ui128_to_f32( uint128_t );
+float64_t ui128_to_f64( uint128_t );
+void ui128_to_extF80M( uint128_t, extFloat80_t * );
+void ui128_to_f128M( uint128_t, float128_t * );
+float16_t i128_to_f16( int128_t );
+float32_t i128_to_f32( int128_t );
+float64_t i128_to_f64( int128_t );
+void i128_to_extF80M( int128_t, extFloat80_t * );
+void i128_to_f128M( int128_t, float128_t * );
 
 /*----------------------------------------------------------------------------
 | 8-bit (quarter-precision) floating-point operations for PULP. (smach)
@@ -160,6 +204,8 @@ int_fast32_t f8_to_i32_r_minMag( float8_t, bool );
 int_fast64_t f8_to_i64_r_minMag( float8_t, bool );
 float16_t f8_to_f16( float8_t ); // NEWLY ADDED
 float32_t f8_to_f32( float8_t );
+bfloat16_t f8_to_bf16( float8_t );
+e4m3_t f8_to_e4m3( float8_t );
 float64_t f8_to_f64( float8_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f8_to_extF80( float8_t );
@@ -183,6 +229,330 @@ bool f8_le_quiet( float8_t, float8_t );
 bool f8_lt_quiet( float8_t, float8_t );
 bool f8_isSignalingNaN( float8_t );
 
+/*----------------------------------------------------------------------------
+| bfloat16 (8-bit exponent, 7-bit fraction) floating-point operations.
+*----------------------------------------------------------------------------*/
+uint_fast32_t bf16_to_ui32( bfloat16_t, uint_fast8_t, bool );
+uint_fast64_t bf16_to_ui64( bfloat16_t, uint_fast8_t, bool );
+int_fast32_t bf16_to_i32( bfloat16_t, uint_fast8_t, bool );
+int_fast64_t bf16_to_i64( bfloat16_t, uint_fast8_t, bool );
+uint_fast32_t bf16_to_ui32_r_minMag( bfloat16_t, bool );
+uint_fast64_t bf16_to_ui64_r_minMag( bfloat16_t, bool );
+int_fast32_t bf16_to_i32_r_minMag( bfloat16_t, bool );
+int_fast64_t bf16_to_i64_r_minMag( bfloat16_t, bool );
+float8_t  bf16_to_f8(  bfloat16_t );
+e4m3_t bf16_to_e4m3( bfloat16_t );
+void bf16_to_e4m3_array( const bfloat16_t *, e4m3_t *, size_t );
+float16_t bf16_to_f16( bfloat16_t );
+float32_t bf16_to_f32( bfloat16_t );
+float64_t bf16_to_f64( bfloat16_t );
+posit8_t bf16_to_p8( bfloat16_t );
+posit16_t bf16_to_p16( bfloat16_t );
+posit32_t bf16_to_p32( bfloat16_t );
+#ifdef SOFTFLOAT_FAST_INT64
+extFloat80_t bf16_to_extF80( bfloat16_t );
+float128_t bf16_to_f128( bfloat16_t );
+#endif
+void bf16_to_extF80M( bfloat16_t, extFloat80_t * );
+void bf16_to_f128M( bfloat16_t, float128_t * );
+bfloat16_t bf16_roundToInt( bfloat16_t, uint_fast8_t, bool );
+bfloat16_t bf16_add( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_sub( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_mul( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_mulAdd( bfloat16_t, bfloat16_t, bfloat16_t );
+bfloat16_t bf16_div( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_rem( bfloat16_t, bfloat16_t );
+bfloat16_t bf16_sqrt( bfloat16_t );
+bool bf16_eq( bfloat16_t, bfloat16_t );
+bool bf16_le( bfloat16_t, bfloat16_t );
+bool bf16_lt( bfloat16_t, bfloat16_t );
+bool bf16_eq_signaling( bfloat16_t, bfloat16_t );
+bool bf16_le_quiet( bfloat16_t, bfloat16_t );
+bool bf16_lt_quiet( bfloat16_t, bfloat16_t );
+bool bf16_isSignalingNaN( bfloat16_t );
+
+/*----------------------------------------------------------------------------
+| Overflow behaviour of the OCP E4M3 format, which has no infinities.  A result
+| that would be infinite (an overflow rounded away from zero, a division by
+| zero, an infinite operand of a conversion) is NaN, or the largest finite
+| value of the same sign (448) with 'e4m3_overflow_saturate'.  The exception
+| flags are those of the IEEE operation either way.
+*----------------------------------------------------------------------------*/
+extern THREAD_LOCAL uint_fast8_t e4m3_overflowMode;
+enum {
+    e4m3_overflow_nan      = 0,
+    e4m3_overflow_saturate = 1
+};
+
+/*----------------------------------------------------------------------------
+| OCP FP8 E4M3 (4-bit exponent, 3-bit fraction) floating-point operations.
+| Binary operations are table lookups when rounding to nearest even.
+*----------------------------------------------------------------------------*/
+uint_fast32_t e4m3_to_ui32( e4m3_t, uint_fast8_t, bool );
+uint_fast64_t e4m3_to_ui64( e4m3_t, uint_fast8_t, bool );
+int_fast32_t e4m3_to_i32( e4m3_t, uint_fast8_t, bool );
+int_fast64_t e4m3_to_i64( e4m3_t, uint_fast8_t, bool );
+uint_fast32_t e4m3_to_ui32_r_minMag( e4m3_t, bool );
+uint_fast64_t e4m3_to_ui64_r_minMag( e4m3_t, bool );
+int_fast32_t e4m3_to_i32_r_minMag( e4m3_t, bool );
+int_fast64_t e4m3_to_i64_r_minMag( e4m3_t, bool );
+float8_t  e4m3_to_f8(  e4m3_t );
+bfloat16_t e4m3_to_bf16( e4m3_t );
+float16_t e4m3_to_f16( e4m3_t );
+float32_t e4m3_to_f32( e4m3_t );
+float64_t e4m3_to_f64( e4m3_t );
+#ifdef SOFTFLOAT_FAST_INT64
+extFloat80_t e4m3_to_extF80( e4m3_t );
+float128_t e4m3_to_f128( e4m3_t );
+#endif
+void e4m3_to_extF80M( e4m3_t, extFloat80_t * );
+void e4m3_to_f128M( e4m3_t, float128_t * );
+void e4m3_to_bf16_array( const e4m3_t *, bfloat16_t *, size_t );
+void e4m3_to_f16_array( const e4m3_t *, float16_t *, size_t );
+void e4m3_to_f32_array( const e4m3_t *, float32_t *, size_t );
+e4m3_t e4m3_roundToInt( e4m3_t, uint_fast8_t, bool );
+e4m3_t e4m3_add( e4m3_t, e4m3_t );
+e4m3_t e4m3_sub( e4m3_t, e4m3_t );
+e4m3_t e4m3_mul( e4m3_t, e4m3_t );
+e4m3_t e4m3_mulAdd( e4m3_t, e4m3_t, e4m3_t );
+e4m3_t e4m3_div( e4m3_t, e4m3_t );
+e4m3_t e4m3_rem( e4m3_t, e4m3_t );
+e4m3_t e4m3_sqrt( e4m3_t );
+bool e4m3_eq( e4m3_t, e4m3_t );
+bool e4m3_le( e4m3_t, e4m3_t );
+bool e4m3_lt( e4m3_t, e4m3_t );
+bool e4m3_eq_signaling( e4m3_t, e4m3_t );
+bool e4m3_le_quiet( e4m3_t, e4m3_t );
+bool e4m3_lt_quiet( e4m3_t, e4m3_t );
+bool e4m3_isSignalingNaN( e4m3_t );
+
+/*----------------------------------------------------------------------------
+| OCP FP6 (E3M2, E2M3) and FP4 (E2M1) element formats.  The encoding sits in
+| the low 6 or 4 bits.  There are no infinities or NaNs: results beyond the
+| largest finite value saturate (overflow is still signaled), division by
+| zero saturates, converting an infinity saturates, and the invalid
+| operations (0/0, square root of a negative, converting a NaN) return +0.
+| Binary operations and square root are table lookups when rounding to
+| nearest even.  '_pack' stores n elements in (6n + 7) / 8 or (n + 1) / 2
+| bytes (four FP6 elements in three bytes, two FP4 elements per byte, least-
+| significant bits first) and '_unpack' reverses it.
+*----------------------------------------------------------------------------*/
+float32_t e3m2_to_f32( e3m2_t );
+float64_t e3m2_to_f64( e3m2_t );
+void e3m2_to_f32_array( const e3m2_t *, float32_t *, size_t );
+void e3m2_pack( const e3m2_t *, uint8_t *, size_t );
+void e3m2_unpack( const uint8_t *, e3m2_t *, size_t );
+e3m2_t e3m2_add( e3m2_t, e3m2_t );
+e3m2_t e3m2_sub( e3m2_t, e3m2_t );
+e3m2_t e3m2_mul( e3m2_t, e3m2_t );
+e3m2_t e3m2_mulAdd( e3m2_t, e3m2_t, e3m2_t );
+e3m2_t e3m2_div( e3m2_t, e3m2_t );
+e3m2_t e3m2_sqrt( e3m2_t );
+bool e3m2_eq( e3m2_t, e3m2_t );
+bool e3m2_le( e3m2_t, e3m2_t );
+bool e3m2_lt( e3m2_t, e3m2_t );
+float32_t e2m3_to_f32( e2m3_t );
+float64_t e2m3_to_f64( e2m3_t );
+void e2m3_to_f32_array( const e2m3_t *, float32_t *, size_t );
+void e2m3_pack( const e2m3_t *, uint8_t *, size_t );
+void e2m3_unpack( const uint8_t *, e2m3_t *, size_t );
+e2m3_t e2m3_add( e2m3_t, e2m3_t );
+e2m3_t e2m3_sub( e2m3_t, e2m3_t );
+e2m3_t e2m3_mul( e2m3_t, e2m3_t );
+e2m3_t e2m3_mulAdd( e2m3_t, e2m3_t, e2m3_t );
+e2m3_t e2m3_div( e2m3_t, e2m3_t );
+e2m3_t e2m3_sqrt( e2m3_t );
+bool e2m3_eq( e2m3_t, e2m3_t );
+bool e2m3_le( e2m3_t, e2m3_t );
+bool e2m3_lt( e2m3_t, e2m3_t );
+float32_t e2m1_to_f32( e2m1_t );
+float64_t e2m1_to_f64( e2m1_t );
+void e2m1_to_f32_array( const e2m1_t *, float32_t *, size_t );
+void e2m1_pack( const e2m1_t *, uint8_t *, size_t );
+void e2m1_unpack( const uint8_t *, e2m1_t *, size_t );
+e2m1_t e2m1_add( e2m1_t, e2m1_t );
+e2m1_t e2m1_sub( e2m1_t, e2m1_t );
+e2m1_t e2m1_mul( e2m1_t, e2m1_t );
+e2m1_t e2m1_mulAdd( e2m1_t, e2m1_t, e2m1_t );
+e2m1_t e2m1_div( e2m1_t, e2m1_t );
+e2m1_t e2m1_sqrt( e2m1_t );
+bool e2m1_eq( e2m1_t, e2m1_t );
+bool e2m1_le( e2m1_t, e2m1_t );
+bool e2m1_lt( e2m1_t, e2m1_t );
+
+/*----------------------------------------------------------------------------
+| OCP Microscaling (MX) block formats.  A block holds MX_BLOCK_SIZE elements
+| sharing one E8M0 scale byte, the power of two 2^(scale - 127) (0xFF is NaN).
+| Packed layout of a block: the scale byte, then the elements in order: one
+| byte each for FP8 and INT8, four FP6 elements in three bytes and two FP4
+| elements per byte, least-significant bits first.  A partial last block is
+| padded with zero elements.
+|   Quantization sets the scale to floor(log2(max |a|)) minus the largest
+| element exponent, then rounds each scaled element once in the current
+| rounding mode, saturating to the largest finite element.  A block holding a
+| NaN or an infinity gets the NaN scale.  'mx_dot' sums each block of
+| products in binary32, scales the sum and accumulates it in binary32.
+*----------------------------------------------------------------------------*/
+#define MX_BLOCK_SIZE 32
+#define mx_scaleNaN 0xFF
+enum {
+    mx_e5m2 = 0,    /* FP8, float8_t encoding */
+    mx_e4m3,        /* FP8, e4m3_t encoding */
+    mx_e3m2,        /* FP6, largest finite 28 */
+    mx_e2m3,        /* FP6, largest finite 7.5 */
+    mx_e2m1,        /* FP4, largest finite 6 */
+    mx_int8         /* two's complement times 2^-6 */
+};
+static inline size_t mx_blockBytes( uint_fast8_t fmt )
+{
+    return
+        1 + ((fmt == mx_e3m2) || (fmt == mx_e2m3) ? MX_BLOCK_SIZE * 3 / 4
+                 : (fmt == mx_e2m1) ? MX_BLOCK_SIZE / 2 : MX_BLOCK_SIZE);
+}
+static inline size_t mx_bytes( uint_fast8_t fmt, size_t n )
+    { return (n + MX_BLOCK_SIZE - 1) / MX_BLOCK_SIZE * mx_blockBytes( fmt ); }
+void f32_to_mx( uint_fast8_t, const float32_t *, uint8_t *, size_t );
+void bf16_to_mx( uint_fast8_t, const bfloat16_t *, uint8_t *, size_t );
+void mx_to_f32( uint_fast8_t, const uint8_t *, float32_t *, size_t );
+float32_t
+ mx_dot( uint_fast8_t, const uint8_t *, uint_fast8_t, const uint8_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| Batch conversions between floating-point and integer or fixed-point arrays.
+| An element of 'type' stands for its integer value times 2^-'fracBits' (Qm.n
+| fixed point has 'fracBits' = n, plain integers 0; 'fracBits' may be
+| negative).  To fixed point, each value is scaled and rounded once in the
+| current rounding mode; results out of the range of 'type' saturate to its
+| bounds and NaNs become 0, raising the invalid exception.  From fixed point,
+| each value is rounded once to the destination format.
+*----------------------------------------------------------------------------*/
+enum {
+    fixed_i8 = 0,   /* int8_t */
+    fixed_ui8,      /* uint8_t */
+    fixed_i16,      /* int16_t */
+    fixed_i32       /* int32_t */
+};
+void
+ f8_to_fixed_array(
+     uint_fast8_t, int_fast8_t, const float8_t *, void *, size_t );
+void
+ f16_to_fixed_array(
+     uint_fast8_t, int_fast8_t, const float16_t *, void *, size_t );
+void
+ bf16_to_fixed_array(
+     uint_fast8_t, int_fast8_t, const bfloat16_t *, void *, size_t );
+void
+ e4m3_to_fixed_array(
+     uint_fast8_t, int_fast8_t, const e4m3_t *, void *, size_t );
+void
+ f32_to_fixed_array(
+     uint_fast8_t, int_fast8_t, const float32_t *, void *, size_t );
+void
+ f64_to_fixed_array(
+     uint_fast8_t, int_fast8_t, const float64_t *, void *, size_t );
+void
+ fixed_to_f8_array(
+     uint_fast8_t, int_fast8_t, const void *, float8_t *, size_t );
+void
+ fixed_to_f16_array(
+     uint_fast8_t, int_fast8_t, const void *, float16_t *, size_t );
+void
+ fixed_to_bf16_array(
+     uint_fast8_t, int_fast8_t, const void *, bfloat16_t *, size_t );
+void
+ fixed_to_e4m3_array(
+     uint_fast8_t, int_fast8_t, const void *, e4m3_t *, size_t );
+void
+ fixed_to_f32_array(
+     uint_fast8_t, int_fast8_t, const void *, float32_t *, size_t );
+void
+ fixed_to_f64_array(
+     uint_fast8_t, int_fast8_t, const void *, float64_t *, size_t );
+
+/*----------------------------------------------------------------------------
+| Posit operations: posit8 (es = 0), posit16 (es = 1) and posit32 (es = 2).
+| Results are rounded to nearest even and never to zero or NaR.  NaR comes
+| from NaR operands, division by zero, the square root of a negative value
+| and the conversion of a NaN or an infinity; the only flag raised is invalid,
+| for a signaling NaN.  The
+| 'q*_fdp_add'/'_sub' functions add or subtract the exact product of two
+| posits to a quire (cleared by 'q*_clr'), which 'q*_to_p*' rounds once;
+| 'p*_dot' is the exact dot product of two arrays, rounded once.
+*----------------------------------------------------------------------------*/
+posit8_t p8_add( posit8_t, posit8_t );
+posit8_t p8_sub( posit8_t, posit8_t );
+posit8_t p8_mul( posit8_t, posit8_t );
+posit8_t p8_mulAdd( posit8_t, posit8_t, posit8_t );
+posit8_t p8_div( posit8_t, posit8_t );
+posit8_t p8_sqrt( posit8_t );
+posit8_t p8_dot( const posit8_t *, const posit8_t *, size_t );
+float16_t p8_to_f16( posit8_t );
+bfloat16_t p8_to_bf16( posit8_t );
+float32_t p8_to_f32( posit8_t );
+float64_t p8_to_f64( posit8_t );
+posit16_t p8_to_p16( posit8_t );
+posit32_t p8_to_p32( posit8_t );
+void q8_fdp_add( quire8_t *, posit8_t, posit8_t );
+void q8_fdp_sub( quire8_t *, posit8_t, posit8_t );
+posit8_t q8_to_p8( const quire8_t * );
+posit16_t p16_add( posit16_t, posit16_t );
+posit16_t p16_sub( posit16_t, posit16_t );
+posit16_t p16_mul( posit16_t, posit16_t );
+posit16_t p16_mulAdd( posit16_t, posit16_t, posit16_t );
+posit16_t p16_div( posit16_t, posit16_t );
+posit16_t p16_sqrt( posit16_t );
+posit16_t p16_dot( const posit16_t *, const posit16_t *, size_t );
+float16_t p16_to_f16( posit16_t );
+bfloat16_t p16_to_bf16( posit16_t );
+float32_t p16_to_f32( posit16_t );
+float64_t p16_to_f64( posit16_t );
+posit8_t p16_to_p8( posit16_t );
+posit32_t p16_to_p32( posit16_t );
+void q16_fdp_add( quire16_t *, posit16_t, posit16_t );
+void q16_fdp_sub( quire16_t *, posit16_t, posit16_t );
+posit16_t q16_to_p16( const quire16_t * );
+posit32_t p32_add( posit32_t, posit32_t );
+posit32_t p32_sub( posit32_t, posit32_t );
+posit32_t p32_mul( posit32_t, posit32_t );
+posit32_t p32_mulAdd( posit32_t, posit32_t, posit32_t );
+posit32_t p32_div( posit32_t, posit32_t );
+posit32_t p32_sqrt( posit32_t );
+posit32_t p32_dot( const posit32_t *, const posit32_t *, size_t );
+float16_t p32_to_f16( posit32_t );
+bfloat16_t p32_to_bf16( posit32_t );
+float32_t p32_to_f32( posit32_t );
+float64_t p32_to_f64( posit32_t );
+posit8_t p32_to_p8( posit32_t );
+posit16_t p32_to_p16( posit32_t );
+void q32_fdp_add( quire32_t *, posit32_t, posit32_t );
+void q32_fdp_sub( quire32_t *, posit32_t, posit32_t );
+posit32_t q32_to_p32( const quire32_t * );
+
+/*----------------------------------------------------------------------------
+| Multiword floating-point operations.  Every result is rounded to the
+| precision of the destination, which 'bigF_init' sets (and clears the value
+| to +0); the destination may be one of the operands.  Rounding follows the
+| current rounding mode and raises the usual flags, but there are no
+| subnormals: results beyond the exponent range BIGF_EXP_MIN to BIGF_EXP_MAX
+| overflow or underflow.  NaNs carry no payload and are all quiet.
+| Conversions to the IEEE formats are rounded once, with the subnormals and
+| flags of those formats.
+*----------------------------------------------------------------------------*/
+void bigF_init( bigFloat_t *, uint_fast16_t );
+void bigF_round( const bigFloat_t *, bigFloat_t * );
+void bigF_add( const bigFloat_t *, const bigFloat_t *, bigFloat_t * );
+void bigF_sub( const bigFloat_t *, const bigFloat_t *, bigFloat_t * );
+void bigF_mul( const bigFloat_t *, const bigFloat_t *, bigFloat_t * );
+void bigF_div( const bigFloat_t *, const bigFloat_t *, bigFloat_t * );
+void bigF_sqrt( const bigFloat_t *, bigFloat_t * );
+bool bigF_eq( const bigFloat_t *, const bigFloat_t * );
+bool bigF_le( const bigFloat_t *, const bigFloat_t * );
+bool bigF_lt( const bigFloat_t *, const bigFloat_t * );
+float32_t bigF_to_f32( const bigFloat_t * );
+float64_t bigF_to_f64( const bigFloat_t * );
+void bigF_to_extF80M( const bigFloat_t *, extFloat80_t * );
+void bigF_to_f128M( const bigFloat_t *, float128_t * );
+
 /*----------------------------------------------------------------------------
 | 16-bit (half-precision) floating-point operations.
 *----------------------------------------------------------------------------*/
@@ -194,9 +564,19 @@ uint_fast32_t f16_to_ui32_r_minMag( float16_t, bool );
 uint_fast64_t f16_to_ui64_r_minMag( float16_t, bool );
 int_fast32_t f16_to_i32_r_minMag( float16_t, bool );
 int_fast64_t f16_to_i64_r_minMag( float16_t, bool );
+uint128_t f16_to_ui128( float16_t, uint_fast8_t, bool );
+int128_t f16_to_i128( float16_t, uint_fast8_t, bool );
+uint128_t f16_to_ui128_r_minMag( float16_t, bool );
+int128_t f16_to_i128_r_minMag( float16_t, bool );
 float8_t  f16_to_f8(  float16_t ); // NEWLY ADDED
 float32_t f16_to_f32( float16_t );
+bfloat16_t f16_to_bf16( float16_t );
+e4m3_t f16_to_e4m3( float16_t );
+void f16_to_e4m3_array( const float16_t *, e4m3_t *, size_t );
 float64_t f16_to_f64( float16_t );
+posit8_t f16_to_p8( float16_t );
+posit16_t f16_to_p16( float16_t );
+posit32_t f16_to_p32( float16_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f16_to_extF80( float16_t );
 float128_t f16_to_f128( float16_t );
@@ -230,16 +610,38 @@ uint_fast32_t f32_to_ui32_r_minMag( float32_t, bool );
 uint_fast64_t f32_to_ui64_r_minMag( float32_t, bool );
 int_fast32_t f32_to_i32_r_minMag( float32_t, bool );
 int_fast64_t f32_to_i64_r_minMag( float32_t, bool );
+uint128_t f32_to_ui128( float32_t, uint_fast8_t, bool );
+int128_t f32_to_i128( float32_t, uint_fast8_t, bool );
+uint128_t f32_to_ui128_r_minMag( float32_t, bool );
+int128_t f32_to_i128_r_minMag( float32_t, bool );
 float8_t  f32_to_f8(  float32_t ); // NEWLY ADDED
 float16_t f32_to_f16( float32_t );
+bfloat16_t f32_to_bf16( float32_t );
+e4m3_t f32_to_e4m3( float32_t );
+void f32_to_e4m3_array( const float32_t *, e4m3_t *, size_t );
+void f32_to_f8_array( const float32_t *, float8_t *, size_t );
+void f32_to_f16_array( const float32_t *, float16_t *, size_t );
+void f32_to_bf16_array( const float32_t *, bfloat16_t *, size_t );
+e3m2_t f32_to_e3m2( float32_t );
+e2m3_t f32_to_e2m3( float32_t );
+e2m1_t f32_to_e2m1( float32_t );
+void f32_to_e3m2_array( const float32_t *, e3m2_t *, size_t );
+void f32_to_e2m3_array( const float32_t *, e2m3_t *, size_t );
+void f32_to_e2m1_array( const float32_t *, e2m1_t *, size_t );
 float64_t f32_to_f64( float32_t );
+posit8_t f32_to_p8( float32_t );
+posit16_t f32_to_p16( float32_t );
+posit32_t f32_to_p32( float32_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f32_to_extF80( float32_t );
 float128_t f32_to_f128( float32_t );
 #endif
 void f32_to_extF80M( float32_t, extFloat80_t * );
 void f32_to_f128M( float32_t, float128_t * );
+void f32_to_bigF( float32_t, bigFloat_t * );
 float32_t f32_roundToInt( float32_t, uint_fast8_t, bool );
+float32_t f32_roundToTF32( float32_t );
+void f32_roundToTF32_array( const float32_t *, float32_t *, size_t );
 float32_t f32_add( float32_t, float32_t );
 float32_t f32_sub( float32_t, float32_t );
 float32_t f32_mul( float32_t, float32_t );
@@ -255,6 +657,21 @@ bool f32_le_quiet( float32_t, float32_t );
 bool f32_lt_quiet( float32_t, float32_t );
 bool f32_isSignalingNaN( float32_t );
 
+/*----------------------------------------------------------------------------
+| TF32 (8-bit exponent, 10-bit fraction) operations.  TF32 values are held in
+| binary32 containers with the lower 13 fraction bits zero; operands are used
+| as they are and each result is rounded once to TF32.  'tf32_dot' rounds the
+| elements of both arrays to TF32 and adds each exact product to the binary32
+| accumulator with one rounding, starting from the last operand.
+*----------------------------------------------------------------------------*/
+float32_t tf32_add( float32_t, float32_t );
+float32_t tf32_sub( float32_t, float32_t );
+float32_t tf32_mul( float32_t, float32_t );
+float32_t tf32_mulAdd( float32_t, float32_t, float32_t );
+float32_t tf32_div( float32_t, float32_t );
+float32_t tf32_sqrt( float32_t );
+float32_t tf32_dot( const float32_t *, const float32_t *, size_t, float32_t );
+
 /*----------------------------------------------------------------------------
 | 64-bit (double-precision) floating-point operations.
 *----------------------------------------------------------------------------*/
@@ -266,15 +683,28 @@ uint_fast32_t f64_to_ui32_r_minMag( float64_t, bool );
 uint_fast64_t f64_to_ui64_r_minMag( float64_t, bool );
 int_fast32_t f64_to_i32_r_minMag( float64_t, bool );
 int_fast64_t f64_to_i64_r_minMag( float64_t, bool );
+uint128_t f64_to_ui128( float64_t, uint_fast8_t, bool );
+int128_t f64_to_i128( float64_t, uint_fast8_t, bool );
+uint128_t f64_to_ui128_r_minMag( float64_t, bool );
+int128_t f64_to_i128_r_minMag( float64_t, bool );
 float8_t  f64_to_f8(  float64_t ); // NEWLY ADDED
 float16_t f64_to_f16( float64_t );
 float32_t f64_to_f32( float64_t );
+posit8_t f64_to_p8( float64_t );
+posit16_t f64_to_p16( float64_t );
+posit32_t f64_to_p32( float64_t );
+bfloat16_t f64_to_bf16( float64_t );
+e4m3_t f64_to_e4m3( float64_t );
+e3m2_t f64_to_e3m2( float64_t );
+e2m3_t f64_to_e2m3( float64_t );
+e2m1_t f64_to_e2m1( float64_t );
 #ifdef SOFTFLOAT_FAST_INT64
 extFloat80_t f64_to_extF80( float64_t );
 float128_t f64_to_f128( float64_t );
 #endif
 void f64_to_extF80M( float64_t, extFloat80_t * );
 void f64_to_f128M( float64_t, float128_t * );
+void f64_to_bigF( float64_t, bigFloat_t * );
 float64_t f64_roundToInt( float64_t, uint_fast8_t, bool );
 float64_t f64_add( float64_t, float64_t );
 float64_t f64_sub( float64_t, float64_t );
@@ -312,6 +742,8 @@ int_fast64_t extF80_to_i64_r_minMag( extFloat80_t, bool );
 float8_t  extF80_to_f8(  extFloat80_t ); // NEWLY ADDED
 float16_t extF80_to_f16( extFloat80_t );
 float32_t extF80_to_f32( extFloat80_t );
+bfloat16_t extF80_to_bf16( extFloat80_t );
+e4m3_t extF80_to_e4m3( extFloat80_t );
 float64_t extF80_to_f64( extFloat80_t );
 float128_t extF80_to_f128( extFloat80_t );
 extFloat80_t extF80_roundToInt( extFloat80_t, uint_fast8_t, bool );
@@ -337,11 +769,18 @@ uint_fast32_t extF80M_to_ui32_r_minMag( const extFloat80_t *, bool );
 uint_fast64_t extF80M_to_ui64_r_minMag( const extFloat80_t *, bool );
 int_fast32_t extF80M_to_i32_r_minMag( const extFloat80_t *, bool );
 int_fast64_t extF80M_to_i64_r_minMag( const extFloat80_t *, bool );
+uint128_t extF80M_to_ui128( const extFloat80_t *, uint_fast8_t, bool );
+int128_t extF80M_to_i128( const extFloat80_t *, uint_fast8_t, bool );
+uint128_t extF80M_to_ui128_r_minMag( const extFloat80_t *, bool );
+int128_t extF80M_to_i128_r_minMag( const extFloat80_t *, bool );
 float8_t  extF80M_to_f8(  const extFloat80_t * ); // NEWLY ADDED
 float16_t extF80M_to_f16( const extFloat80_t * );
 float32_t extF80M_to_f32( const extFloat80_t * );
+bfloat16_t extF80M_to_bf16( const extFloat80_t * );
+e4m3_t extF80M_to_e4m3( const extFloat80_t * );
 float64_t extF80M_to_f64( const extFloat80_t * );
 void extF80M_to_f128M( const extFloat80_t *, float128_t * );
+void extF80M_to_bigF( const extFloat80_t *, bigFloat_t * );
 void
  extF80M_roundToInt(
      const extFloat80_t *, uint_fast8_t, bool, extFloat80_t * );
@@ -374,6 +813,8 @@ int_fast64_t f128_to_i64_r_minMag( float128_t, bool );
 float8_t  f128_to_f8(  float128_t ); // NEWLY ADDED
 float16_t f128_to_f16( float128_t );
 float32_t f128_to_f32( float128_t );
+bfloat16_t f128_to_bf16( float128_t );
+e4m3_t f128_to_e4m3( float128_t );
 float64_t f128_to_f64( float128_t );
 extFloat80_t f128_to_extF80( float128_t );
 float128_t f128_roundToInt( float128_t, uint_fast8_t, bool );
@@ -400,11 +841,18 @@ uint_fast32_t f128M_to_ui32_r_minMag( const float128_t *, bool );
 uint_fast64_t f128M_to_ui64_r_minMag( const float128_t *, bool );
 int_fast32_t f128M_to_i32_r_minMag( const float128_t *, bool );
 int_fast64_t f128M_to_i64_r_minMag( const float128_t *, bool );
+uint128_t f128M_to_ui128( const float128_t *, uint_fast8_t, bool );
+int128_t f128M_to_i128( const float128_t *, uint_fast8_t, bool );
+uint128_t f128M_to_ui128_r_minMag( const float128_t *, bool );
+int128_t f128M_to_i128_r_minMag( const float128_t *, bool );
 float8_t  f128M_to_f8(  const float128_t * ); // NEWLY ADDED
 float16_t f128M_to_f16( const float128_t * );
 float32_t f128M_to_f32( const float128_t * );
+bfloat16_t f128M_to_bf16( const float128_t * );
+e4m3_t f128M_to_e4m3( const float128_t * );
 float64_t f128M_to_f64( const float128_t * );
 void f128M_to_extF80M( const float128_t *, extFloat80_t * );
+void f128M_to_bigF( const float128_t *, bigFloat_t * );
 void f128M_roundToInt( const float128_t *, uint_fast8_t, bool, float128_t * );
 void f128M_add( const float128_t *, const float128_t *, float128_t * );
 void f128M_sub( const float128_t *, const float128_t *, float128_t * );
@@ -424,6 +872,489 @@ bool f128M_le_quiet( const float128_t *, const float128_t * );
 bool f128M_lt_quiet( const float128_t *, const float128_t * );
 bool f128M_isSignalingNaN( const float128_t * );
 
+/*----------------------------------------------------------------------------
+| Sign operations and classification.  These only manipulate or inspect the
+| bit pattern of their operand: they never round and never raise exception
+| flags, and 'neg', 'abs' and 'copySign' are applied to NaNs as well.  They
+| are defined inline here since each one reduces to one or two integer
+| instructions.
+|
+| The 'classify' functions return one of the one-hot 'softfloat_class_*'
+| values below (the same encoding as the RISC-V FCLASS instructions).
+*----------------------------------------------------------------------------*/
+enum {
+    softfloat_class_negInf       = 0x001,
+    softfloat_class_negNormal    = 0x002,
+    softfloat_class_negSubnormal = 0x004,
+    softfloat_class_negZero      = 0x008,
+    softfloat_class_posZero      = 0x010,
+    softfloat_class_posSubnormal = 0x020,
+    softfloat_class_posNormal    = 0x040,
+    softfloat_class_posInf       = 0x080,
+    softfloat_class_sNaN         = 0x100,
+    softfloat_class_qNaN         = 0x200
+};
+
+static inline uint_fast16_t
+ softfloat_packClass(
+     bool sign, bool expZero, bool expMax, bool sigZero, bool quiet )
+{
+    int rank;
+
+    if ( expMax && ! sigZero ) {
+        return quiet ? softfloat_class_qNaN : softfloat_class_sNaN;
+    }
+    /* 0 = zero, 1 = subnormal, 2 = normal, 3 = infinity */
+    rank = expMax ? 3 : expZero ? ! sigZero : 2;
+    return (uint_fast16_t) 1<<(sign ? 3 - rank : 4 + rank);
+}
+
+/*----------------------------------------------------------------------------
+| 8-bit sign operations and classification.
+*----------------------------------------------------------------------------*/
+static inline float8_t f8_neg( float8_t a ) { a.v ^= 0x80; return a; }
+static inline float8_t f8_abs( float8_t a ) { a.v &= ~0x80; return a; }
+static inline float8_t f8_copySign( float8_t a, float8_t b )
+{
+    a.v = (a.v & ~0x80) | (b.v & 0x80);
+    return a;
+}
+static inline bool f8_signbit( float8_t a ) { return a.v>>7; }
+static inline bool f8_isNaN( float8_t a )
+{
+    return ((a.v & 0x7C) == 0x7C) && (a.v & 0x03);
+}
+static inline bool f8_isInf( float8_t a )
+{
+    return (a.v & ~0x80) == 0x7C;
+}
+static inline uint_fast16_t f8_classify( float8_t a )
+{
+    return
+        softfloat_packClass(
+            a.v>>7,
+            ! (a.v & 0x7C),
+            (a.v & 0x7C) == 0x7C,
+            ! (a.v & 0x03),
+            (a.v & 0x02) != 0
+        );
+}
+
+/*----------------------------------------------------------------------------
+| E4M3 sign operations and classification (no infinities; the NaN is quiet).
+*----------------------------------------------------------------------------*/
+static inline e4m3_t e4m3_neg( e4m3_t a ) { a.v ^= 0x80; return a; }
+static inline e4m3_t e4m3_abs( e4m3_t a ) { a.v &= ~0x80; return a; }
+static inline e4m3_t e4m3_copySign( e4m3_t a, e4m3_t b )
+{
+    a.v = (a.v & ~0x80) | (b.v & 0x80);
+    return a;
+}
+static inline bool e4m3_signbit( e4m3_t a ) { return a.v>>7; }
+static inline bool e4m3_isNaN( e4m3_t a ) { return (a.v & 0x7F) == 0x7F; }
+static inline bool e4m3_isInf( e4m3_t a ) { (void) a; return false; }
+static inline uint_fast16_t e4m3_classify( e4m3_t a )
+{
+    return
+        softfloat_packClass(
+            a.v>>7,
+            ! (a.v & 0x78),
+            (a.v & 0x7F) == 0x7F,
+            ! (a.v & 0x07),
+            true
+        );
+}
+
+/*----------------------------------------------------------------------------
+| FP6 and FP4 sign operations and classification (no infinities or NaNs).
+*----------------------------------------------------------------------------*/
+static inline e3m2_t e3m2_neg( e3m2_t a ) { a.v ^= 0x20; return a; }
+static inline e3m2_t e3m2_abs( e3m2_t a ) { a.v &= ~0x20; return a; }
+static inline e3m2_t e3m2_copySign( e3m2_t a, e3m2_t b )
+{
+    a.v = (a.v & ~0x20) | (b.v & 0x20);
+    return a;
+}
+static inline bool e3m2_signbit( e3m2_t a ) { return (a.v>>5) & 1; }
+static inline bool e3m2_isNaN( e3m2_t a ) { (void) a; return false; }
+static inline bool e3m2_isInf( e3m2_t a ) { (void) a; return false; }
+static inline uint_fast16_t e3m2_classify( e3m2_t a )
+{
+    return
+        softfloat_packClass(
+            (a.v>>5) & 1, ! (a.v & 0x1C), false, ! (a.v & 0x03), true );
+}
+
+static inline e2m3_t e2m3_neg( e2m3_t a ) { a.v ^= 0x20; return a; }
+static inline e2m3_t e2m3_abs( e2m3_t a ) { a.v &= ~0x20; return a; }
+static inline e2m3_t e2m3_copySign( e2m3_t a, e2m3_t b )
+{
+    a.v = (a.v & ~0x20) | (b.v & 0x20);
+    return a;
+}
+static inline bool e2m3_signbit( e2m3_t a ) { return (a.v>>5) & 1; }
+static inline bool e2m3_isNaN( e2m3_t a ) { (void) a; return false; }
+static inline bool e2m3_isInf( e2m3_t a ) { (void) a; return false; }
+static inline uint_fast16_t e2m3_classify( e2m3_t a )
+{
+    return
+        softfloat_packClass(
+            (a.v>>5) & 1, ! (a.v & 0x18), false, ! (a.v & 0x07), true );
+}
+
+static inline e2m1_t e2m1_neg( e2m1_t a ) { a.v ^= 0x08; return a; }
+static inline e2m1_t e2m1_abs( e2m1_t a ) { a.v &= ~0x08; return a; }
+static inline e2m1_t e2m1_copySign( e2m1_t a, e2m1_t b )
+{
+    a.v = (a.v & ~0x08) | (b.v & 0x08);
+    return a;
+}
+static inline bool e2m1_signbit( e2m1_t a ) { return (a.v>>3) & 1; }
+static inline bool e2m1_isNaN( e2m1_t a ) { (void) a; return false; }
+static inline bool e2m1_isInf( e2m1_t a ) { (void) a; return false; }
+static inline uint_fast16_t e2m1_classify( e2m1_t a )
+{
+    return
+        softfloat_packClass(
+            (a.v>>3) & 1, ! (a.v & 0x06), false, ! (a.v & 0x01), true );
+}
+
+/*----------------------------------------------------------------------------
+| Posit sign operations and comparisons.  Posits order like two's-complement
+| integers: NaR equals itself and is below every other value.
+*----------------------------------------------------------------------------*/
+static inline posit8_t p8_neg( posit8_t a ) { a.v = -a.v; return a; }
+static inline posit8_t p8_abs( posit8_t a )
+    { if ( a.v & 0x80 ) a.v = -a.v; return a; }
+static inline bool p8_isNaR( posit8_t a ) { return a.v == 0x80; }
+static inline bool p8_eq( posit8_t a, posit8_t b ) { return a.v == b.v; }
+static inline bool p8_le( posit8_t a, posit8_t b )
+    { return (a.v ^ 0x80) <= (b.v ^ 0x80); }
+static inline bool p8_lt( posit8_t a, posit8_t b )
+    { return (a.v ^ 0x80) < (b.v ^ 0x80); }
+static inline void q8_clr( quire8_t *q ) { q->v[0] = 0; }
+
+static inline posit16_t p16_neg( posit16_t a ) { a.v = -a.v; return a; }
+static inline posit16_t p16_abs( posit16_t a )
+    { if ( a.v & 0x8000 ) a.v = -a.v; return a; }
+static inline bool p16_isNaR( posit16_t a ) { return a.v == 0x8000; }
+static inline bool p16_eq( posit16_t a, posit16_t b ) { return a.v == b.v; }
+static inline bool p16_le( posit16_t a, posit16_t b )
+    { return (a.v ^ 0x8000) <= (b.v ^ 0x8000); }
+static inline bool p16_lt( posit16_t a, posit16_t b )
+    { return (a.v ^ 0x8000) < (b.v ^ 0x8000); }
+static inline void q16_clr( quire16_t *q )
+    { int i; for ( i = 0; i < 2; ++i ) q->v[i] = 0; }
+
+static inline posit32_t p32_neg( posit32_t a ) { a.v = -a.v; return a; }
+static inline posit32_t p32_abs( posit32_t a )
+    { if ( a.v & 0x80000000 ) a.v = -a.v; return a; }
+static inline bool p32_isNaR( posit32_t a ) { return a.v == 0x80000000; }
+static inline bool p32_eq( posit32_t a, posit32_t b ) { return a.v == b.v; }
+static inline bool p32_le( posit32_t a, posit32_t b )
+    { return (a.v ^ 0x80000000) <= (b.v ^ 0x80000000); }
+static inline bool p32_lt( posit32_t a, posit32_t b )
+    { return (a.v ^ 0x80000000) < (b.v ^ 0x80000000); }
+static inline void q32_clr( quire32_t *q )
+    { int i; for ( i = 0; i < 8; ++i ) q->v[i] = 0; }
+
+/*----------------------------------------------------------------------------
+| bfloat16 sign operations and classification.
+*----------------------------------------------------------------------------*/
+static inline bfloat16_t bf16_neg( bfloat16_t a ) { a.v ^= 0x8000; return a; }
+static inline bfloat16_t bf16_abs( bfloat16_t a ) { a.v &= ~0x8000; return a; }
+static inline bfloat16_t bf16_copySign( bfloat16_t a, bfloat16_t b )
+{
+    a.v = (a.v & ~0x8000) | (b.v & 0x8000);
+    return a;
+}
+static inline bool bf16_signbit( bfloat16_t a ) { return a.v>>15; }
+static inline bool bf16_isNaN( bfloat16_t a )
+{
+    return ((a.v & 0x7F80) == 0x7F80) && (a.v & 0x007F);
+}
+static inline bool bf16_isInf( bfloat16_t a )
+{
+    return (a.v & ~0x8000) == 0x7F80;
+}
+static inline uint_fast16_t bf16_classify( bfloat16_t a )
+{
+    return
+        softfloat_packClass(
+            a.v>>15,
+            ! (a.v & 0x7F80),
+            (a.v & 0x7F80) == 0x7F80,
+            ! (a.v & 0x007F),
+            (a.v & 0x0040) != 0
+        );
+}
+
+/*----------------------------------------------------------------------------
+| 16-bit sign operations and classification.
+*----------------------------------------------------------------------------*/
+static inline float16_t f16_neg( float16_t a ) { a.v ^= 0x8000; return a; }
+static inline float16_t f16_abs( float16_t a ) { a.v &= ~0x8000; return a; }
+static inline float16_t f16_copySign( float16_t a, float16_t b )
+{
+    a.v = (a.v & ~0x8000) | (b.v & 0x8000);
+    return a;
+}
+static inline bool f16_signbit( float16_t a ) { return a.v>>15; }
+static inline bool f16_isNaN( float16_t a )
+{
+    return ((a.v & 0x7C00) == 0x7C00) && (a.v & 0x03FF);
+}
+static inline bool f16_isInf( float16_t a )
+{
+    return (a.v & ~0x8000) == 0x7C00;
+}
+static inline uint_fast16_t f16_classify( float16_t a )
+{
+    return
+        softfloat_packClass(
+            a.v>>15,
+            ! (a.v & 0x7C00),
+            (a.v & 0x7C00) == 0x7C00,
+            ! (a.v & 0x03FF),
+            (a.v & 0x0200) != 0
+        );
+}
+
+/*----------------------------------------------------------------------------
+| 32-bit sign operations and classification.
+*----------------------------------------------------------------------------*/
+static inline float32_t f32_neg( float32_t a ) { a.v ^= 0x80000000; return a; }
+static inline float32_t f32_abs( float32_t a ) { a.v &= ~0x80000000; return a; }
+static inline float32_t f32_copySign( float32_t a, float32_t b )
+{
+    a.v = (a.v & ~0x80000000) | (b.v & 0x80000000);
+    return a;
+}
+static inline bool f32_signbit( float32_t a ) { return a.v>>31; }
+static inline bool f32_isNaN( float32_t a )
+{
+    return ((a.v & 0x7F800000) == 0x7F800000) && (a.v & 0x007FFFFF);
+}
+static inline bool f32_isInf( float32_t a )
+{
+    return (a.v & ~0x80000000) == 0x7F800000;
+}
+static inline uint_fast16_t f32_classify( float32_t a )
+{
+    return
+        softfloat_packClass(
+            a.v>>31,
+            ! (a.v & 0x7F800000),
+            (a.v & 0x7F800000) == 0x7F800000,
+            ! (a.v & 0x007FFFFF),
+            (a.v & 0x00400000) != 0
+        );
+}
+
+/*----------------------------------------------------------------------------
+| 64-bit sign operations and classification.
+*----------------------------------------------------------------------------*/
+static inline float64_t f64_neg( float64_t a )
+{
+    a.v ^= UINT64_C( 0x8000000000000000 );
+    return a;
+}
+static inline float64_t f64_abs( float64_t a )
+{
+    a.v &= UINT64_C( 0x7FFFFFFFFFFFFFFF );
+    return a;
+}
+static inline float64_t f64_copySign( float64_t a, float64_t b )
+{
+    a.v =
+        (a.v & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            | (b.v & UINT64_C( 0x8000000000000000 ));
+    return a;
+}
+static inline bool f64_signbit( float64_t a ) { return a.v>>63; }
+static inline bool f64_isNaN( float64_t a )
+{
+    return
+        ((a.v & UINT64_C( 0x7FF0000000000000 ))
+             == UINT64_C( 0x7FF0000000000000 ))
+            && (a.v & UINT64_C( 0x000FFFFFFFFFFFFF ));
+}
+static inline bool f64_isInf( float64_t a )
+{
+    return
+        (a.v & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            == UINT64_C( 0x7FF0000000000000 );
+}
+static inline uint_fast16_t f64_classify( float64_t a )
+{
+    return
+        softfloat_packClass(
+            a.v>>63,
+            ! (a.v & UINT64_C( 0x7FF0000000000000 )),
+            (a.v & UINT64_C( 0x7FF0000000000000 ))
+                == UINT64_C( 0x7FF0000000000000 ),
+            ! (a.v & UINT64_C( 0x000FFFFFFFFFFFFF )),
+            (a.v & UINT64_C( 0x0008000000000000 )) != 0
+        );
+}
+
+/*----------------------------------------------------------------------------
+| 80-bit extended double-precision sign operations and classification.  The
+| significand is tested without its explicit integer bit.
+*----------------------------------------------------------------------------*/
+static inline extFloat80_t extF80_neg( extFloat80_t a )
+{
+    a.signExp ^= 0x8000;
+    return a;
+}
+static inline extFloat80_t extF80_abs( extFloat80_t a )
+{
+    a.signExp &= 0x7FFF;
+    return a;
+}
+static inline extFloat80_t extF80_copySign( extFloat80_t a, extFloat80_t b )
+{
+    a.signExp = (a.signExp & 0x7FFF) | (b.signExp & 0x8000);
+    return a;
+}
+static inline bool extF80_signbit( extFloat80_t a ) { return a.signExp>>15; }
+static inline bool extF80_isNaN( extFloat80_t a )
+{
+    return
+        ((a.signExp & 0x7FFF) == 0x7FFF)
+            && (a.signif & UINT64_C( 0x7FFFFFFFFFFFFFFF ));
+}
+static inline bool extF80_isInf( extFloat80_t a )
+{
+    return
+        ((a.signExp & 0x7FFF) == 0x7FFF)
+            && ! (a.signif & UINT64_C( 0x7FFFFFFFFFFFFFFF ));
+}
+static inline uint_fast16_t extF80_classify( extFloat80_t a )
+{
+    return
+        softfloat_packClass(
+            a.signExp>>15,
+            ! (a.signExp & 0x7FFF),
+            (a.signExp & 0x7FFF) == 0x7FFF,
+            ! (a.signif & UINT64_C( 0x7FFFFFFFFFFFFFFF )),
+            (a.signif & UINT64_C( 0x4000000000000000 )) != 0
+        );
+}
+static inline void extF80M_neg( const extFloat80_t *aPtr, extFloat80_t *zPtr )
+{
+    *zPtr = extF80_neg( *aPtr );
+}
+static inline void extF80M_abs( const extFloat80_t *aPtr, extFloat80_t *zPtr )
+{
+    *zPtr = extF80_abs( *aPtr );
+}
+static inline void
+ extF80M_copySign(
+     const extFloat80_t *aPtr, const extFloat80_t *bPtr, extFloat80_t *zPtr )
+{
+    *zPtr = extF80_copySign( *aPtr, *bPtr );
+}
+static inline bool extF80M_signbit( const extFloat80_t *aPtr )
+    { return extF80_signbit( *aPtr ); }
+static inline bool extF80M_isNaN( const extFloat80_t *aPtr )
+    { return extF80_isNaN( *aPtr ); }
+static inline bool extF80M_isInf( const extFloat80_t *aPtr )
+    { return extF80_isInf( *aPtr ); }
+static inline uint_fast16_t extF80M_classify( const extFloat80_t *aPtr )
+    { return extF80_classify( *aPtr ); }
+
+/*----------------------------------------------------------------------------
+| 128-bit quadruple-precision sign operations and classification.  The most-
+| significant 64 bits are held in 'v[1]' on little-endian platforms (see
+| "softfloat_types.h").  The byte order is taken from the compiler when it
+| reports one, since users of this header do not include "platform.h", and
+| otherwise from 'LITTLEENDIAN'.
+*----------------------------------------------------------------------------*/
+#if defined __BYTE_ORDER__ && defined __ORDER_LITTLE_ENDIAN__
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define softfloat_f128Hi 1
+#else
+#define softfloat_f128Hi 0
+#endif
+#elif defined LITTLEENDIAN
+#define softfloat_f128Hi 1
+#else
+#define softfloat_f128Hi 0
+#endif
+
+static inline float128_t f128_neg( float128_t a )
+{
+    a.v[softfloat_f128Hi] ^= UINT64_C( 0x8000000000000000 );
+    return a;
+}
+static inline float128_t f128_abs( float128_t a )
+{
+    a.v[softfloat_f128Hi] &= UINT64_C( 0x7FFFFFFFFFFFFFFF );
+    return a;
+}
+static inline float128_t f128_copySign( float128_t a, float128_t b )
+{
+    a.v[softfloat_f128Hi] =
+        (a.v[softfloat_f128Hi] & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+            | (b.v[softfloat_f128Hi] & UINT64_C( 0x8000000000000000 ));
+    return a;
+}
+static inline bool f128_signbit( float128_t a )
+    { return a.v[softfloat_f128Hi]>>63; }
+static inline bool f128_isNaN( float128_t a )
+{
+    uint64_t a64 = a.v[softfloat_f128Hi];
+    return
+        ((a64 & UINT64_C( 0x7FFF000000000000 ))
+             == UINT64_C( 0x7FFF000000000000 ))
+            && ((a64 & UINT64_C( 0x0000FFFFFFFFFFFF ))
+                    || a.v[! softfloat_f128Hi]);
+}
+static inline bool f128_isInf( float128_t a )
+{
+    return
+        ((a.v[softfloat_f128Hi] & UINT64_C( 0x7FFFFFFFFFFFFFFF ))
+             == UINT64_C( 0x7FFF000000000000 ))
+            && ! a.v[! softfloat_f128Hi];
+}
+static inline uint_fast16_t f128_classify( float128_t a )
+{
+    uint64_t a64 = a.v[softfloat_f128Hi];
+    return
+        softfloat_packClass(
+            a64>>63,
+            ! (a64 & UINT64_C( 0x7FFF000000000000 )),
+            (a64 & UINT64_C( 0x7FFF000000000000 ))
+                == UINT64_C( 0x7FFF000000000000 ),
+            ! ((a64 & UINT64_C( 0x0000FFFFFFFFFFFF ))
+                   || a.v[! softfloat_f128Hi]),
+            (a64 & UINT64_C( 0x0000800000000000 )) != 0
+        );
+}
+static inline void f128M_neg( const float128_t *aPtr, float128_t *zPtr )
+{
+    *zPtr = f128_neg( *aPtr );
+}
+static inline void f128M_abs( const float128_t *aPtr, float128_t *zPtr )
+{
+    *zPtr = f128_abs( *aPtr );
+}
+static inline void
+ f128M_copySign(
+     const float128_t *aPtr, const float128_t *bPtr, float128_t *zPtr )
+{
+    *zPtr = f128_copySign( *aPtr, *bPtr );
+}
+static inline bool f128M_signbit( const float128_t *aPtr )
+    { return f128_signbit( *aPtr ); }
+static inline bool f128M_isNaN( const float128_t *aPtr )
+    { return f128_isNaN( *aPtr ); }
+static inline bool f128M_isInf( const float128_t *aPtr )
+    { return f128_isInf( *aPtr ); }
+static inline uint_fast16_t f128M_classify( const float128_t *aPtr )
+    { return f128_classify( *aPtr ); }
+
 #endif
 
 /* C++ */
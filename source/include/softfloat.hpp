@@ -40,6 +40,7 @@
 
 #pragma once
 #include "softfloat.h"
+#include "ieee_format.hpp"
 
 /*----------------------------------------------------------------------------
 |  _______                   _       _
@@ -54,7 +55,10 @@
 /*----------------------------------------------------------------------------
 | Function Templates
 *----------------------------------------------------------------------------*/
-template <typename From, typename To> static inline To softfloat_cast(const From &);
+template <typename From, typename To> struct softfloat_converter;
+template <typename From, typename To> static inline To softfloat_cast(const From &v) {
+    return softfloat_converter<From, To>::cast(v);
+}
 template <typename T> static inline T softfloat_roundToInt(const T &);
 template <typename T> static inline T softfloat_add(const T &, const T &);
 template <typename T> static inline T softfloat_sub(const T &, const T &);
@@ -67,12 +71,150 @@ template <typename T> static inline bool softfloat_eq(const T &, const T &);
 template <typename T> static inline bool softfloat_le(const T &, const T &);
 template <typename T> static inline bool softfloat_lt(const T &, const T &);
 template <typename T> static inline bool softfloat_isSignalingNaN(const T &);
+template <typename T> static inline T softfloat_neg(const T &);
+template <typename T> static inline T softfloat_abs(const T &);
+template <typename T> static inline T softfloat_copySign(const T &, const T &);
+template <typename T> static inline bool softfloat_signbit(const T &);
+template <typename T> static inline bool softfloat_isNaN(const T &);
+template <typename T> static inline bool softfloat_isInf(const T &);
+template <typename T> static inline uint_fast16_t softfloat_classify(const T &);
 
 /*----------------------------------------------------------------------------
 | Class Template
 *----------------------------------------------------------------------------*/
 template <typename T> class softfloat;
 
+/*----------------------------------------------------------------------------
+| Format Traits
+|
+| 'expBits' is the exponent width and 'sigBits' the significand precision
+| (including the hidden bit).  'storage' is the raw type holding the bits of
+| a value and 'wider' is the next format in the promotion chain
+| f8 -> f16 -> f32 -> f64 -> extF80 -> f128 (e4m3 -> f16, bf16 -> f32).
+*----------------------------------------------------------------------------*/
+template <typename T> struct softfloat_format;
+
+template <> struct softfloat_format<float8_t> {
+    enum { expBits = 5, sigBits = 3 };
+    typedef uint8_t storage;
+    typedef float16_t wider;
+};
+
+template <> struct softfloat_format<e4m3_t> {
+    enum { expBits = 4, sigBits = 4 };
+    typedef uint8_t storage;
+    typedef float16_t wider;
+};
+
+template <> struct softfloat_format<bfloat16_t> {
+    enum { expBits = 8, sigBits = 8 };
+    typedef uint16_t storage;
+    typedef float32_t wider;
+};
+
+template <> struct softfloat_format<float16_t> {
+    enum { expBits = 5, sigBits = 11 };
+    typedef uint16_t storage;
+    typedef float32_t wider;
+};
+
+template <> struct softfloat_format<float32_t> {
+    enum { expBits = 8, sigBits = 24 };
+    typedef uint32_t storage;
+    typedef float64_t wider;
+};
+
+template <> struct softfloat_format<float64_t> {
+    enum { expBits = 11, sigBits = 53 };
+    typedef uint64_t storage;
+    typedef extFloat80_t wider;
+};
+
+template <> struct softfloat_format<extFloat80_t> {
+    enum { expBits = 15, sigBits = 64 };
+    typedef extFloat80_t storage;
+    typedef float128_t wider;
+};
+
+template <> struct softfloat_format<float128_t> {
+    enum { expBits = 15, sigBits = 113 };
+    typedef float128_t storage;
+    typedef float128_t wider;
+};
+
+/*----------------------------------------------------------------------------
+| True if every value of format U is exactly representable in format T.
+*----------------------------------------------------------------------------*/
+template <typename T, typename U> struct softfloat_contains {
+    enum {
+        value = (int) softfloat_format<T>::expBits >= (int) softfloat_format<U>::expBits
+             && (int) softfloat_format<T>::sigBits >= (int) softfloat_format<U>::sigBits
+    };
+};
+
+/*----------------------------------------------------------------------------
+| Promotion rule for mixed-format operations: the narrowest format that holds
+| both operand formats exactly.  Operands are converted into it without
+| rounding, so a mixed operation rounds exactly once.
+*----------------------------------------------------------------------------*/
+template <typename T, typename U,
+          bool = softfloat_contains<T, U>::value,
+          bool = softfloat_contains<U, T>::value>
+struct softfloat_promote {
+    typedef typename softfloat_promote<typename softfloat_format<T>::wider, U>::type type;
+};
+
+template <typename T, typename U, bool UHoldsT>
+struct softfloat_promote<T, U, true, UHoldsT> {
+    typedef T type;
+};
+
+template <typename T, typename U>
+struct softfloat_promote<T, U, false, true> {
+    typedef U type;
+};
+
+/*----------------------------------------------------------------------------
+| True if the product of any two values of format T is exactly representable
+| in format W (significand, overflow and subnormal range are all checked).
+*----------------------------------------------------------------------------*/
+template <typename T, typename W> struct softfloat_holds_product {
+    enum {
+        sigT  = softfloat_format<T>::sigBits,
+        sigW  = softfloat_format<W>::sigBits,
+        emaxT = (1 << (softfloat_format<T>::expBits - 1)) - 1,
+        emaxW = (1 << (softfloat_format<W>::expBits - 1)) - 1,
+        value = (2 * sigT <= sigW)
+             && (2 * emaxT + 2 <= emaxW + 1)
+             && (2 * (2 - emaxT - sigT) >= 2 - emaxW - sigW)
+    };
+};
+
+// E4M3 uses the top exponent for finite values: 448 * 448 overflows f16.
+template <> struct softfloat_holds_product<e4m3_t, float16_t> {
+    enum { value = false };
+};
+
+/*----------------------------------------------------------------------------
+| The narrowest format holding the exact product of two T values, or 'void'
+| if there is none (extF80 and f128).
+*----------------------------------------------------------------------------*/
+template <typename T, typename W = typename softfloat_format<T>::wider,
+          bool = softfloat_holds_product<T, W>::value>
+struct softfloat_product {
+    typedef typename softfloat_product<T, typename softfloat_format<W>::wider>::type type;
+};
+
+template <typename T, typename W>
+struct softfloat_product<T, W, true> {
+    typedef W type;
+};
+
+template <typename T>
+struct softfloat_product<T, float128_t, false> {
+    typedef void type;
+};
+
 
 /*----------------------------------------------------------------------------
 |  ______                    _____        __ _       _ _   _
@@ -98,6 +240,14 @@ template <> float8_t softfloat_cast<uint32_t, float8_t>(const uint32_t &v) {
     return ui32_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<uint32_t, e4m3_t>(const uint32_t &v) {
+    return ui32_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<uint32_t, bfloat16_t>(const uint32_t &v) {
+    return ui32_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<uint32_t, float16_t>(const uint32_t &v) {
     return ui32_to_f16(v);
 }
@@ -130,6 +280,14 @@ template <> float8_t softfloat_cast<uint64_t, float8_t>(const uint64_t &v) {
     return ui64_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<uint64_t, e4m3_t>(const uint64_t &v) {
+    return ui64_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<uint64_t, bfloat16_t>(const uint64_t &v) {
+    return ui64_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<uint64_t, float16_t>(const uint64_t &v) {
     return ui64_to_f16(v);
 }
@@ -161,6 +319,14 @@ template <> float8_t softfloat_cast<int32_t, float8_t>(const int32_t &v) {
     return i32_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<int32_t, e4m3_t>(const int32_t &v) {
+    return i32_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<int32_t, bfloat16_t>(const int32_t &v) {
+    return i32_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<int32_t, float16_t>(const int32_t &v) {
     return i32_to_f16(v);
 }
@@ -192,6 +358,14 @@ template <> float8_t softfloat_cast<int64_t, float8_t>(const int64_t &v) {
     return i64_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<int64_t, e4m3_t>(const int64_t &v) {
+    return i64_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<int64_t, bfloat16_t>(const int64_t &v) {
+    return i64_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<int64_t, float16_t>(const int64_t &v) {
     return i64_to_f16(v);
 }
@@ -216,6 +390,60 @@ template <> float128_t softfloat_cast<int64_t, float128_t>(const int64_t &v) {
     return tmp;
 }
 
+/*----------------------------------------------------------------------------
+| From ui128
+*----------------------------------------------------------------------------*/
+template <> float16_t softfloat_cast<uint128_t, float16_t>(const uint128_t &v) {
+    return ui128_to_f16(v);
+}
+
+template <> float32_t softfloat_cast<uint128_t, float32_t>(const uint128_t &v) {
+    return ui128_to_f32(v);
+}
+
+template <> float64_t softfloat_cast<uint128_t, float64_t>(const uint128_t &v) {
+    return ui128_to_f64(v);
+}
+
+template <> extFloat80_t softfloat_cast<uint128_t, extFloat80_t>(const uint128_t &v) {
+    extFloat80_t tmp;
+    ui128_to_extF80M(v, &tmp);
+    return tmp;
+}
+
+template <> float128_t softfloat_cast<uint128_t, float128_t>(const uint128_t &v) {
+    float128_t tmp;
+    ui128_to_f128M(v, &tmp);
+    return tmp;
+}
+
+/*----------------------------------------------------------------------------
+| From i128
+*----------------------------------------------------------------------------*/
+template <> float16_t softfloat_cast<int128_t, float16_t>(const int128_t &v) {
+    return i128_to_f16(v);
+}
+
+template <> float32_t softfloat_cast<int128_t, float32_t>(const int128_t &v) {
+    return i128_to_f32(v);
+}
+
+template <> float64_t softfloat_cast<int128_t, float64_t>(const int128_t &v) {
+    return i128_to_f64(v);
+}
+
+template <> extFloat80_t softfloat_cast<int128_t, extFloat80_t>(const int128_t &v) {
+    extFloat80_t tmp;
+    i128_to_extF80M(v, &tmp);
+    return tmp;
+}
+
+template <> float128_t softfloat_cast<int128_t, float128_t>(const int128_t &v) {
+    float128_t tmp;
+    i128_to_f128M(v, &tmp);
+    return tmp;
+}
+
 /*----------------------------------------------------------------------------
 |  __                __ _           __ _
 | /   _  _ _|_ _    |_ |_)   ---   |_ |_)
@@ -233,6 +461,20 @@ template <> float8_t softfloat_cast<float, float8_t>(const float &v) {
     return f32_to_f8(result);
 }
 
+template <> e4m3_t softfloat_cast<float, e4m3_t>(const float &v) {
+    float32_t result;
+    const uint32_t *value = reinterpret_cast<const uint32_t *>(&v);
+    result.v = *value;
+    return f32_to_e4m3(result);
+}
+
+template <> bfloat16_t softfloat_cast<float, bfloat16_t>(const float &v) {
+    float32_t result;
+    const uint32_t *value = reinterpret_cast<const uint32_t *>(&v);
+    result.v = *value;
+    return f32_to_bf16(result);
+}
+
 template <> float16_t softfloat_cast<float, float16_t>(const float &v) {
     float32_t result;
     const uint32_t *value = reinterpret_cast<const uint32_t *>(&v);
@@ -282,6 +524,20 @@ template <> float8_t softfloat_cast<double, float8_t>(const double &v) {
     return f64_to_f8(result);
 }
 
+template <> e4m3_t softfloat_cast<double, e4m3_t>(const double &v) {
+    float64_t result;
+    const uint64_t *value = reinterpret_cast<const uint64_t *>(&v);
+    result.v = *value;
+    return f64_to_e4m3(result);
+}
+
+template <> bfloat16_t softfloat_cast<double, bfloat16_t>(const double &v) {
+    float64_t result;
+    const uint64_t *value = reinterpret_cast<const uint64_t *>(&v);
+    result.v = *value;
+    return f64_to_bf16(result);
+}
+
 template <> float16_t softfloat_cast<double, float16_t>(const double &v) {
     float64_t result;
     const uint64_t *value = reinterpret_cast<const uint64_t *>(&v);
@@ -332,6 +588,22 @@ template <> float8_t softfloat_cast<long double, float8_t>(const long double &v)
     return f128M_to_f8(&result);
 }
 
+template <> e4m3_t softfloat_cast<long double, e4m3_t>(const long double &v) {
+    float128_t result;
+    const uint64_t *value = reinterpret_cast<const uint64_t *>(&v);
+    result.v[0] = value[0];
+    result.v[1] = value[1];
+    return f128M_to_e4m3(&result);
+}
+
+template <> bfloat16_t softfloat_cast<long double, bfloat16_t>(const long double &v) {
+    float128_t result;
+    const uint64_t *value = reinterpret_cast<const uint64_t *>(&v);
+    result.v[0] = value[0];
+    result.v[1] = value[1];
+    return f128M_to_bf16(&result);
+}
+
 template <> float16_t softfloat_cast<long double, float16_t>(const long double &v) {
     float128_t result;
     const uint64_t *value = reinterpret_cast<const uint64_t *>(&v);
@@ -381,6 +653,14 @@ template <> float8_t softfloat_cast<float8_t, float8_t>(const float8_t &v) {
     return v;
 }
 
+template <> e4m3_t softfloat_cast<float8_t, e4m3_t>(const float8_t &v) {
+    return f8_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<float8_t, bfloat16_t>(const float8_t &v) {
+    return f8_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<float8_t, float16_t>(const float8_t &v) {
     return f8_to_f16(v);
 }
@@ -405,6 +685,84 @@ template <> float128_t softfloat_cast<float8_t, float128_t>(const float8_t &v) {
     return tmp;
 }
 
+/*----------------------------------------------------------------------------
+| From bf16
+*----------------------------------------------------------------------------*/
+template <> float8_t softfloat_cast<bfloat16_t, float8_t>(const bfloat16_t &v) {
+    return bf16_to_f8(v);
+}
+
+template <> e4m3_t softfloat_cast<bfloat16_t, e4m3_t>(const bfloat16_t &v) {
+    return bf16_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<bfloat16_t, bfloat16_t>(const bfloat16_t &v) {
+    return v;
+}
+
+template <> float16_t softfloat_cast<bfloat16_t, float16_t>(const bfloat16_t &v) {
+    return bf16_to_f16(v);
+}
+
+template <> float32_t softfloat_cast<bfloat16_t, float32_t>(const bfloat16_t &v) {
+    return bf16_to_f32(v);
+}
+
+template <> float64_t softfloat_cast<bfloat16_t, float64_t>(const bfloat16_t &v) {
+    return bf16_to_f64(v);
+}
+
+template <> extFloat80_t softfloat_cast<bfloat16_t, extFloat80_t>(const bfloat16_t &v) {
+    extFloat80_t tmp;
+    bf16_to_extF80M(v, &tmp);
+    return tmp;
+}
+
+template <> float128_t softfloat_cast<bfloat16_t, float128_t>(const bfloat16_t &v) {
+    float128_t tmp;
+    bf16_to_f128M(v, &tmp);
+    return tmp;
+}
+
+/*----------------------------------------------------------------------------
+| From e4m3
+*----------------------------------------------------------------------------*/
+template <> float8_t softfloat_cast<e4m3_t, float8_t>(const e4m3_t &v) {
+    return e4m3_to_f8(v);
+}
+
+template <> e4m3_t softfloat_cast<e4m3_t, e4m3_t>(const e4m3_t &v) {
+    return v;
+}
+
+template <> bfloat16_t softfloat_cast<e4m3_t, bfloat16_t>(const e4m3_t &v) {
+    return e4m3_to_bf16(v);
+}
+
+template <> float16_t softfloat_cast<e4m3_t, float16_t>(const e4m3_t &v) {
+    return e4m3_to_f16(v);
+}
+
+template <> float32_t softfloat_cast<e4m3_t, float32_t>(const e4m3_t &v) {
+    return e4m3_to_f32(v);
+}
+
+template <> float64_t softfloat_cast<e4m3_t, float64_t>(const e4m3_t &v) {
+    return e4m3_to_f64(v);
+}
+
+template <> extFloat80_t softfloat_cast<e4m3_t, extFloat80_t>(const e4m3_t &v) {
+    extFloat80_t tmp;
+    e4m3_to_extF80M(v, &tmp);
+    return tmp;
+}
+
+template <> float128_t softfloat_cast<e4m3_t, float128_t>(const e4m3_t &v) {
+    float128_t tmp;
+    e4m3_to_f128M(v, &tmp);
+    return tmp;
+}
+
 /*----------------------------------------------------------------------------
 | From f16
 *----------------------------------------------------------------------------*/
@@ -412,6 +770,14 @@ template <> float8_t softfloat_cast<float16_t, float8_t>(const float16_t &v) {
     return f16_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<float16_t, e4m3_t>(const float16_t &v) {
+    return f16_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<float16_t, bfloat16_t>(const float16_t &v) {
+    return f16_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<float16_t, float16_t>(const float16_t &v) {
     return v;
 }
@@ -443,6 +809,14 @@ template <> float8_t softfloat_cast<float32_t, float8_t>(const float32_t &v) {
     return f32_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<float32_t, e4m3_t>(const float32_t &v) {
+    return f32_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<float32_t, bfloat16_t>(const float32_t &v) {
+    return f32_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<float32_t, float16_t>(const float32_t &v) {
     return f32_to_f16(v);
 }
@@ -474,6 +848,14 @@ template <> float8_t softfloat_cast<float64_t, float8_t>(const float64_t &v) {
     return f64_to_f8(v);
 }
 
+template <> e4m3_t softfloat_cast<float64_t, e4m3_t>(const float64_t &v) {
+    return f64_to_e4m3(v);
+}
+
+template <> bfloat16_t softfloat_cast<float64_t, bfloat16_t>(const float64_t &v) {
+    return f64_to_bf16(v);
+}
+
 template <> float16_t softfloat_cast<float64_t, float16_t>(const float64_t &v) {
     return f64_to_f16(v);
 }
@@ -505,6 +887,14 @@ template <> float8_t softfloat_cast<extFloat80_t, float8_t>(const extFloat80_t &
     return extF80M_to_f8(&v);
 }
 
+template <> e4m3_t softfloat_cast<extFloat80_t, e4m3_t>(const extFloat80_t &v) {
+    return extF80M_to_e4m3(&v);
+}
+
+template <> bfloat16_t softfloat_cast<extFloat80_t, bfloat16_t>(const extFloat80_t &v) {
+    return extF80M_to_bf16(&v);
+}
+
 template <> float16_t softfloat_cast<extFloat80_t, float16_t>(const extFloat80_t &v) {
     return extF80M_to_f16(&v);
 }
@@ -534,6 +924,14 @@ template <> float8_t softfloat_cast<float128_t, float8_t>(const float128_t &v) {
     return f128M_to_f8(&v);
 }
 
+template <> e4m3_t softfloat_cast<float128_t, e4m3_t>(const float128_t &v) {
+    return f128M_to_e4m3(&v);
+}
+
+template <> bfloat16_t softfloat_cast<float128_t, bfloat16_t>(const float128_t &v) {
+    return f128M_to_bf16(&v);
+}
+
 template <> float16_t softfloat_cast<float128_t, float16_t>(const float128_t &v) {
     return f128M_to_f16(&v);
 }
@@ -582,6 +980,44 @@ template <> int64_t softfloat_cast<float8_t, int64_t>(const float8_t &v) {
     return f8_to_i64_r_minMag(v, true);
 }
 
+/*----------------------------------------------------------------------------
+| From bf16
+*----------------------------------------------------------------------------*/
+template <> uint32_t softfloat_cast<bfloat16_t, uint32_t>(const bfloat16_t &v) {
+    return bf16_to_ui32_r_minMag(v, true);
+}
+
+template <> uint64_t softfloat_cast<bfloat16_t, uint64_t>(const bfloat16_t &v) {
+    return bf16_to_ui64_r_minMag(v, true);
+}
+
+template <> int32_t softfloat_cast<bfloat16_t, int32_t>(const bfloat16_t &v) {
+    return bf16_to_i32_r_minMag(v, true);
+}
+
+template <> int64_t softfloat_cast<bfloat16_t, int64_t>(const bfloat16_t &v) {
+    return bf16_to_i64_r_minMag(v, true);
+}
+
+/*----------------------------------------------------------------------------
+| From e4m3
+*----------------------------------------------------------------------------*/
+template <> uint32_t softfloat_cast<e4m3_t, uint32_t>(const e4m3_t &v) {
+    return e4m3_to_ui32_r_minMag(v, true);
+}
+
+template <> uint64_t softfloat_cast<e4m3_t, uint64_t>(const e4m3_t &v) {
+    return e4m3_to_ui64_r_minMag(v, true);
+}
+
+template <> int32_t softfloat_cast<e4m3_t, int32_t>(const e4m3_t &v) {
+    return e4m3_to_i32_r_minMag(v, true);
+}
+
+template <> int64_t softfloat_cast<e4m3_t, int64_t>(const e4m3_t &v) {
+    return e4m3_to_i64_r_minMag(v, true);
+}
+
 /*----------------------------------------------------------------------------
 | From f16
 *----------------------------------------------------------------------------*/
@@ -601,6 +1037,14 @@ template <> int64_t softfloat_cast<float16_t, int64_t>(const float16_t &v) {
     return f16_to_i64_r_minMag(v, true);
 }
 
+template <> uint128_t softfloat_cast<float16_t, uint128_t>(const float16_t &v) {
+    return f16_to_ui128_r_minMag(v, true);
+}
+
+template <> int128_t softfloat_cast<float16_t, int128_t>(const float16_t &v) {
+    return f16_to_i128_r_minMag(v, true);
+}
+
 /*----------------------------------------------------------------------------
 | From f32
 *----------------------------------------------------------------------------*/
@@ -620,6 +1064,14 @@ template <> int64_t softfloat_cast<float32_t, int64_t>(const float32_t &v) {
     return f32_to_i64_r_minMag(v, true);
 }
 
+template <> uint128_t softfloat_cast<float32_t, uint128_t>(const float32_t &v) {
+    return f32_to_ui128_r_minMag(v, true);
+}
+
+template <> int128_t softfloat_cast<float32_t, int128_t>(const float32_t &v) {
+    return f32_to_i128_r_minMag(v, true);
+}
+
 /*----------------------------------------------------------------------------
 | From f64
 *----------------------------------------------------------------------------*/
@@ -639,6 +1091,14 @@ template <> int64_t softfloat_cast<float64_t, int64_t>(const float64_t &v) {
     return f64_to_i64_r_minMag(v, true);
 }
 
+template <> uint128_t softfloat_cast<float64_t, uint128_t>(const float64_t &v) {
+    return f64_to_ui128_r_minMag(v, true);
+}
+
+template <> int128_t softfloat_cast<float64_t, int128_t>(const float64_t &v) {
+    return f64_to_i128_r_minMag(v, true);
+}
+
 /*----------------------------------------------------------------------------
 | From ext80
 *----------------------------------------------------------------------------*/
@@ -658,6 +1118,14 @@ template <> int64_t softfloat_cast<extFloat80_t, int64_t>(const extFloat80_t &v)
     return extF80M_to_i64_r_minMag(&v, true);
 }
 
+template <> uint128_t softfloat_cast<extFloat80_t, uint128_t>(const extFloat80_t &v) {
+    return extF80M_to_ui128_r_minMag(&v, true);
+}
+
+template <> int128_t softfloat_cast<extFloat80_t, int128_t>(const extFloat80_t &v) {
+    return extF80M_to_i128_r_minMag(&v, true);
+}
+
 /*----------------------------------------------------------------------------
 | From f128
 *----------------------------------------------------------------------------*/
@@ -677,6 +1145,14 @@ template <> int64_t softfloat_cast<float128_t, int64_t>(const float128_t &v) {
     return f128M_to_i64_r_minMag(&v, true);
 }
 
+template <> uint128_t softfloat_cast<float128_t, uint128_t>(const float128_t &v) {
+    return f128M_to_ui128_r_minMag(&v, true);
+}
+
+template <> int128_t softfloat_cast<float128_t, int128_t>(const float128_t &v) {
+    return f128M_to_i128_r_minMag(&v, true);
+}
+
 /*----------------------------------------------------------------------------
 |  _
 | |_) _    __  _|   _|_ _     o __ _|_
@@ -688,6 +1164,14 @@ template <> float8_t softfloat_roundToInt(const float8_t &v) {
     return f8_roundToInt(v, softfloat_roundingMode, true);
 }
 
+template <> e4m3_t softfloat_roundToInt(const e4m3_t &v) {
+    return e4m3_roundToInt(v, softfloat_roundingMode, true);
+}
+
+template <> bfloat16_t softfloat_roundToInt(const bfloat16_t &v) {
+    return bf16_roundToInt(v, softfloat_roundingMode, true);
+}
+
 template <> float16_t softfloat_roundToInt(const float16_t &v) {
     return f16_roundToInt(v, softfloat_roundingMode, true);
 }
@@ -722,6 +1206,14 @@ template <> float8_t softfloat_add(const float8_t &a, const float8_t &b) {
     return f8_add(a,b);
 }
 
+template <> e4m3_t softfloat_add(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_add(a,b);
+}
+
+template <> bfloat16_t softfloat_add(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_add(a,b);
+}
+
 template <> float16_t softfloat_add(const float16_t &a, const float16_t &b) {
     return f16_add(a,b);
 }
@@ -756,6 +1248,14 @@ template <> float8_t softfloat_sub(const float8_t &a, const float8_t &b) {
     return f8_sub(a,b);
 }
 
+template <> e4m3_t softfloat_sub(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_sub(a,b);
+}
+
+template <> bfloat16_t softfloat_sub(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_sub(a,b);
+}
+
 template <> float16_t softfloat_sub(const float16_t &a, const float16_t &b) {
     return f16_sub(a,b);
 }
@@ -790,6 +1290,14 @@ template <> float8_t softfloat_mul(const float8_t &a, const float8_t &b) {
     return f8_mul(a,b);
 }
 
+template <> e4m3_t softfloat_mul(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_mul(a,b);
+}
+
+template <> bfloat16_t softfloat_mul(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_mul(a,b);
+}
+
 template <> float16_t softfloat_mul(const float16_t &a, const float16_t &b) {
     return f16_mul(a,b);
 }
@@ -824,11 +1332,19 @@ template <> float8_t softfloat_mulAdd(const float8_t &a, const float8_t &b, cons
     return f8_mulAdd(a,b,c);
 }
 
-template <> float16_t softfloat_mulAdd(const float16_t &a, const float16_t &b, const float16_t &c) {
-    return f16_mulAdd(a,b,c);
+template <> e4m3_t softfloat_mulAdd(const e4m3_t &a, const e4m3_t &b, const e4m3_t &c) {
+    return e4m3_mulAdd(a,b,c);
 }
 
-template <> float32_t softfloat_mulAdd(const float32_t &a, const float32_t &b, const float32_t &c) {
+template <> bfloat16_t softfloat_mulAdd(const bfloat16_t &a, const bfloat16_t &b, const bfloat16_t &c) {
+    return bf16_mulAdd(a,b,c);
+}
+
+template <> float16_t softfloat_mulAdd(const float16_t &a, const float16_t &b, const float16_t &c) {
+    return f16_mulAdd(a,b,c);
+}
+
+template <> float32_t softfloat_mulAdd(const float32_t &a, const float32_t &b, const float32_t &c) {
     return f32_mulAdd(a,b,c);
 }
 
@@ -856,6 +1372,14 @@ template <> float8_t softfloat_div(const float8_t &a, const float8_t &b) {
     return f8_div(a,b);
 }
 
+template <> e4m3_t softfloat_div(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_div(a,b);
+}
+
+template <> bfloat16_t softfloat_div(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_div(a,b);
+}
+
 template <> float16_t softfloat_div(const float16_t &a, const float16_t &b) {
     return f16_div(a,b);
 }
@@ -890,6 +1414,14 @@ template <> float8_t softfloat_rem(const float8_t &a, const float8_t &b) {
     return f8_rem(a,b);
 }
 
+template <> e4m3_t softfloat_rem(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_rem(a,b);
+}
+
+template <> bfloat16_t softfloat_rem(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_rem(a,b);
+}
+
 template <> float16_t softfloat_rem(const float16_t &a, const float16_t &b) {
     return f16_rem(a,b);
 }
@@ -924,6 +1456,14 @@ template <> float8_t softfloat_sqrt(const float8_t &a) {
     return f8_sqrt(a);
 }
 
+template <> e4m3_t softfloat_sqrt(const e4m3_t &a) {
+    return e4m3_sqrt(a);
+}
+
+template <> bfloat16_t softfloat_sqrt(const bfloat16_t &a) {
+    return bf16_sqrt(a);
+}
+
 template <> float16_t softfloat_sqrt(const float16_t &a) {
     return f16_sqrt(a);
 }
@@ -959,6 +1499,14 @@ template <> bool softfloat_eq(const float8_t &a, const float8_t &b) {
     return f8_eq_signaling(a,b);
 }
 
+template <> bool softfloat_eq(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_eq_signaling(a,b);
+}
+
+template <> bool softfloat_eq(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_eq_signaling(a,b);
+}
+
 template <> bool softfloat_eq(const float16_t &a, const float16_t &b) {
     return f16_eq_signaling(a,b);
 }
@@ -990,6 +1538,14 @@ template <> bool softfloat_le(const float8_t &a, const float8_t &b) {
     return f8_le(a,b);
 }
 
+template <> bool softfloat_le(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_le(a,b);
+}
+
+template <> bool softfloat_le(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_le(a,b);
+}
+
 template <> bool softfloat_le(const float16_t &a, const float16_t &b) {
     return f16_le(a,b);
 }
@@ -1021,6 +1577,14 @@ template <> bool softfloat_lt(const float8_t &a, const float8_t &b) {
     return f8_lt(a,b);
 }
 
+template <> bool softfloat_lt(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_lt(a,b);
+}
+
+template <> bool softfloat_lt(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_lt(a,b);
+}
+
 template <> bool softfloat_lt(const float16_t &a, const float16_t &b) {
     return f16_lt(a,b);
 }
@@ -1038,7 +1602,7 @@ template <> bool softfloat_lt(const extFloat80_t &a, const extFloat80_t &b) {
 }
 
 template <> bool softfloat_lt(const float128_t &a, const float128_t &b) {
-     return f128M_le(&a,&b);
+     return f128M_lt(&a,&b);
 }
 
 /*----------------------------------------------------------------------------
@@ -1051,6 +1615,14 @@ template <> bool softfloat_isSignalingNaN(const float8_t &a) {
     return f8_isSignalingNaN(a);
 }
 
+template <> bool softfloat_isSignalingNaN(const e4m3_t &a) {
+    return e4m3_isSignalingNaN(a);
+}
+
+template <> bool softfloat_isSignalingNaN(const bfloat16_t &a) {
+    return bf16_isSignalingNaN(a);
+}
+
 template <> bool softfloat_isSignalingNaN(const float16_t &a) {
     return f16_isSignalingNaN(a);
 }
@@ -1072,6 +1644,411 @@ template <> bool softfloat_isSignalingNaN(const float128_t &a) {
 }
 
 
+/*----------------------------------------------------------------------------
+|  __                     _
+| (_  o  _ __     _ __   |_) o _|_ _
+| __) | (_|| |   (_)| |  |_) |  |_ _>
+|        _|
+| Sign operations and classification only touch the bit pattern: they never
+| round and never raise exception flags.
+*----------------------------------------------------------------------------*/
+template <> float8_t softfloat_neg(const float8_t &a) {
+    return f8_neg(a);
+}
+
+template <> e4m3_t softfloat_neg(const e4m3_t &a) {
+    return e4m3_neg(a);
+}
+
+template <> bfloat16_t softfloat_neg(const bfloat16_t &a) {
+    return bf16_neg(a);
+}
+
+template <> float16_t softfloat_neg(const float16_t &a) {
+    return f16_neg(a);
+}
+
+template <> float32_t softfloat_neg(const float32_t &a) {
+    return f32_neg(a);
+}
+
+template <> float64_t softfloat_neg(const float64_t &a) {
+    return f64_neg(a);
+}
+
+template <> extFloat80_t softfloat_neg(const extFloat80_t &a) {
+    return extF80_neg(a);
+}
+
+template <> float128_t softfloat_neg(const float128_t &a) {
+    return f128_neg(a);
+}
+
+template <> float8_t softfloat_abs(const float8_t &a) {
+    return f8_abs(a);
+}
+
+template <> e4m3_t softfloat_abs(const e4m3_t &a) {
+    return e4m3_abs(a);
+}
+
+template <> bfloat16_t softfloat_abs(const bfloat16_t &a) {
+    return bf16_abs(a);
+}
+
+template <> float16_t softfloat_abs(const float16_t &a) {
+    return f16_abs(a);
+}
+
+template <> float32_t softfloat_abs(const float32_t &a) {
+    return f32_abs(a);
+}
+
+template <> float64_t softfloat_abs(const float64_t &a) {
+    return f64_abs(a);
+}
+
+template <> extFloat80_t softfloat_abs(const extFloat80_t &a) {
+    return extF80_abs(a);
+}
+
+template <> float128_t softfloat_abs(const float128_t &a) {
+    return f128_abs(a);
+}
+
+template <> float8_t softfloat_copySign(const float8_t &a, const float8_t &b) {
+    return f8_copySign(a,b);
+}
+
+template <> e4m3_t softfloat_copySign(const e4m3_t &a, const e4m3_t &b) {
+    return e4m3_copySign(a,b);
+}
+
+template <> bfloat16_t softfloat_copySign(const bfloat16_t &a, const bfloat16_t &b) {
+    return bf16_copySign(a,b);
+}
+
+template <> float16_t softfloat_copySign(const float16_t &a, const float16_t &b) {
+    return f16_copySign(a,b);
+}
+
+template <> float32_t softfloat_copySign(const float32_t &a, const float32_t &b) {
+    return f32_copySign(a,b);
+}
+
+template <> float64_t softfloat_copySign(const float64_t &a, const float64_t &b) {
+    return f64_copySign(a,b);
+}
+
+template <> extFloat80_t softfloat_copySign(const extFloat80_t &a, const extFloat80_t &b) {
+    return extF80_copySign(a,b);
+}
+
+template <> float128_t softfloat_copySign(const float128_t &a, const float128_t &b) {
+    return f128_copySign(a,b);
+}
+
+template <> bool softfloat_signbit(const float8_t &a) {
+    return f8_signbit(a);
+}
+
+template <> bool softfloat_signbit(const e4m3_t &a) {
+    return e4m3_signbit(a);
+}
+
+template <> bool softfloat_signbit(const bfloat16_t &a) {
+    return bf16_signbit(a);
+}
+
+template <> bool softfloat_signbit(const float16_t &a) {
+    return f16_signbit(a);
+}
+
+template <> bool softfloat_signbit(const float32_t &a) {
+    return f32_signbit(a);
+}
+
+template <> bool softfloat_signbit(const float64_t &a) {
+    return f64_signbit(a);
+}
+
+template <> bool softfloat_signbit(const extFloat80_t &a) {
+    return extF80_signbit(a);
+}
+
+template <> bool softfloat_signbit(const float128_t &a) {
+    return f128_signbit(a);
+}
+
+template <> bool softfloat_isNaN(const float8_t &a) {
+    return f8_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const e4m3_t &a) {
+    return e4m3_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const bfloat16_t &a) {
+    return bf16_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const float16_t &a) {
+    return f16_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const float32_t &a) {
+    return f32_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const float64_t &a) {
+    return f64_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const extFloat80_t &a) {
+    return extF80_isNaN(a);
+}
+
+template <> bool softfloat_isNaN(const float128_t &a) {
+    return f128_isNaN(a);
+}
+
+template <> bool softfloat_isInf(const float8_t &a) {
+    return f8_isInf(a);
+}
+
+template <> bool softfloat_isInf(const e4m3_t &a) {
+    return e4m3_isInf(a);
+}
+
+template <> bool softfloat_isInf(const bfloat16_t &a) {
+    return bf16_isInf(a);
+}
+
+template <> bool softfloat_isInf(const float16_t &a) {
+    return f16_isInf(a);
+}
+
+template <> bool softfloat_isInf(const float32_t &a) {
+    return f32_isInf(a);
+}
+
+template <> bool softfloat_isInf(const float64_t &a) {
+    return f64_isInf(a);
+}
+
+template <> bool softfloat_isInf(const extFloat80_t &a) {
+    return extF80_isInf(a);
+}
+
+template <> bool softfloat_isInf(const float128_t &a) {
+    return f128_isInf(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const float8_t &a) {
+    return f8_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const e4m3_t &a) {
+    return e4m3_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const bfloat16_t &a) {
+    return bf16_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const float16_t &a) {
+    return f16_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const float32_t &a) {
+    return f32_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const float64_t &a) {
+    return f64_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const extFloat80_t &a) {
+    return extF80_classify(a);
+}
+
+template <> uint_fast16_t softfloat_classify(const float128_t &a) {
+    return f128_classify(a);
+}
+
+
+/*----------------------------------------------------------------------------
+|  __         __    __
+| |_  _ __   |_ ._ |_  _  ._ ._ _  _._|_ _
+| |__(/_| |  |  |  |  (_) |  | | |(_| |__>
+|
+| ieee_format<E, F> from ieee_format.hpp plugs into softfloat<T> like the
+| built-in formats: arithmetic and classification are found by overloading,
+| conversions through partial specializations of softfloat_converter (the
+| fallback of softfloat_cast), and softfloat_format makes it take part in
+| mixed-format promotion.
+*----------------------------------------------------------------------------*/
+template <int E, int F,
+          int Rank = (E <= 5 && F <= 10) ? 0 : (E <= 8 && F <= 23) ? 1
+                   : (E <= 11 && F <= 52) ? 2 : 3>
+struct softfloat_ieee_wider { typedef extFloat80_t type; };
+
+template <int E, int F> struct softfloat_ieee_wider<E, F, 0> { typedef float16_t type; };
+template <int E, int F> struct softfloat_ieee_wider<E, F, 1> { typedef float32_t type; };
+template <int E, int F> struct softfloat_ieee_wider<E, F, 2> { typedef float64_t type; };
+
+template <int E, int F> struct softfloat_format<ieee_format<E, F> > {
+    enum { expBits = E, sigBits = F + 1 };
+    typedef typename ieee_format<E, F>::storage storage;
+    typedef typename softfloat_ieee_wider<E, F>::type wider;
+};
+
+// Integers, native types and SoftFloat formats -> ieee_format
+template <typename From, int E, int F>
+struct softfloat_converter<From, ieee_format<E, F> > {
+    static inline ieee_format<E, F> cast(const From &v) { return ieee_format<E, F>::from(v); }
+};
+
+template <int E, int F>
+struct softfloat_converter<ieee_format<E, F>, ieee_format<E, F> > {
+    static inline ieee_format<E, F> cast(const ieee_format<E, F> &v) { return v; }
+};
+
+template <int E1, int F1, int E2, int F2>
+struct softfloat_converter<ieee_format<E1, F1>, ieee_format<E2, F2> > {
+    static inline ieee_format<E2, F2> cast(const ieee_format<E1, F1> &v) {
+        return ieee_format<E2, F2>::from(v);
+    }
+};
+
+// ieee_format -> SoftFloat formats
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, float8_t> {
+    static inline float8_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toF8(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, e4m3_t> {
+    static inline e4m3_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toE4M3(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, bfloat16_t> {
+    static inline bfloat16_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toBF16(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, float16_t> {
+    static inline float16_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toF16(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, float32_t> {
+    static inline float32_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toF32(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, float64_t> {
+    static inline float64_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toF64(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, extFloat80_t> {
+    static inline extFloat80_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toExtF80(v); }
+};
+
+template <int E, int F> struct softfloat_converter<ieee_format<E, F>, float128_t> {
+    static inline float128_t cast(const ieee_format<E, F> &v) { return ieee_format<E, F>::toF128(v); }
+};
+
+// Arithmetic
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_roundToInt(const ieee_format<E, F> &v) {
+    return ieee_format<E, F>::roundToInt(v, softfloat_roundingMode, true);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_add(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::add(a, b);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_sub(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::sub(a, b);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_mul(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::mul(a, b);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_mulAdd(const ieee_format<E, F> &a, const ieee_format<E, F> &b,
+                                                 const ieee_format<E, F> &c) {
+    return ieee_format<E, F>::mulAdd(a, b, c);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_div(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::div(a, b);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_sqrt(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::sqrt(a);
+}
+
+// Relational
+template <int E, int F>
+static inline bool softfloat_eq(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::eq_signaling(a, b);
+}
+
+template <int E, int F>
+static inline bool softfloat_le(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::le(a, b);
+}
+
+template <int E, int F>
+static inline bool softfloat_lt(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::lt(a, b);
+}
+
+template <int E, int F>
+static inline bool softfloat_isSignalingNaN(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::isSignalingNaN(a);
+}
+
+// Sign operations and classification
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_neg(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::neg(a);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_abs(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::abs(a);
+}
+
+template <int E, int F>
+static inline ieee_format<E, F> softfloat_copySign(const ieee_format<E, F> &a, const ieee_format<E, F> &b) {
+    return ieee_format<E, F>::copySign(a, b);
+}
+
+template <int E, int F>
+static inline bool softfloat_signbit(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::signbit(a);
+}
+
+template <int E, int F>
+static inline bool softfloat_isNaN(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::isNaN(a);
+}
+
+template <int E, int F>
+static inline bool softfloat_isInf(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::isInf(a);
+}
+
+template <int E, int F>
+static inline uint_fast16_t softfloat_classify(const ieee_format<E, F> &a) {
+    return ieee_format<E, F>::classify(a);
+}
+
+
 /*----------------------------------------------------------------------------
 |   _____ _                 _____        __ _       _ _   _
 |  / ____| |               |  __ \      / _(_)     (_) | (_)
@@ -1142,10 +2119,10 @@ public:
     *------------------------------------------------------------------------*/
 
 
-    /* UNARY MINUS (-) */
+    /* UNARY MINUS (-) --> sign flip, exact and without flags */
     inline softfloat operator-() const
     {
-        return softfloat_sub(softfloat_cast<uint32_t,T>(0), v);
+        return softfloat_neg(v);
     }
 
     /* UNARY PLUS (+) */
@@ -1178,6 +2155,40 @@ public:
         return softfloat_div(a.v,b.v);
     }
 
+    /*------------------------------------------------------------------------
+    | Sign operations and classification (found by argument-dependent lookup,
+    | so generic code can call abs(x) etc. on native and softfloat types)
+    *------------------------------------------------------------------------*/
+    friend inline softfloat abs(const softfloat &a)
+    {
+        return softfloat_abs(a.v);
+    }
+
+    friend inline softfloat copysign(const softfloat &a, const softfloat &b)
+    {
+        return softfloat_copySign(a.v,b.v);
+    }
+
+    friend inline bool signbit(const softfloat &a)
+    {
+        return softfloat_signbit(a.v);
+    }
+
+    friend inline bool isnan(const softfloat &a)
+    {
+        return softfloat_isNaN(a.v);
+    }
+
+    friend inline bool isinf(const softfloat &a)
+    {
+        return softfloat_isInf(a.v);
+    }
+
+    friend inline uint_fast16_t classify(const softfloat &a)
+    {
+        return softfloat_classify(a.v);
+    }
+
     /*------------------------------------------------------------------------
     | OPERATOR OVERLOADS: Relational operators
     *------------------------------------------------------------------------*/
@@ -1231,6 +2242,23 @@ public:
         return *this = *this / b;
     }
 
+    // Mixed formats: computed in the promoted format, rounded back into T.
+    template <typename U> inline softfloat &operator+=(const softfloat<U> &b) {
+        return *this = softfloat(*this + b);
+    }
+
+    template <typename U> inline softfloat &operator-=(const softfloat<U> &b) {
+        return *this = softfloat(*this - b);
+    }
+
+    template <typename U> inline softfloat &operator*=(const softfloat<U> &b) {
+        return *this = softfloat(*this * b);
+    }
+
+    template <typename U> inline softfloat &operator/=(const softfloat<U> &b) {
+        return *this = softfloat(*this / b);
+    }
+
     /*------------------------------------------------------------------------
     | OPERATOR OVERLOADS: IO streams operators
     *------------------------------------------------------------------------*/
@@ -1255,9 +2283,120 @@ public:
 *----------------------------------------------------------------------------*/
 
 typedef softfloat<float8_t>     float8;
+typedef softfloat<e4m3_t>       e4m3;
+typedef softfloat<bfloat16_t>   bfloat16;
 typedef softfloat<float16_t>    float16;
 typedef softfloat<float32_t>    float32;
 typedef softfloat<float64_t>    float64;
 typedef softfloat<extFloat80_t> extFloat80;
 typedef softfloat<float128_t>   float128;
 
+
+/*----------------------------------------------------------------------------
+|  __                   __
+| |V|o   _  _|    |_ _  |_  _ __ __  _ _|_ _
+| | ||><(/_(_|    | (_) |  (_)|  |||(_| |__>
+|
+| Operators between different softfloat formats.  Both operands are converted
+| exactly into softfloat_promote<T,U>::type and the operation is performed
+| there, so there is exactly one rounding and no detour through native types.
+| Same-format operations keep using the non-template class operators.
+*----------------------------------------------------------------------------*/
+template <typename T, typename U>
+inline softfloat<typename softfloat_promote<T, U>::type>
+operator+(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_add(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline softfloat<typename softfloat_promote<T, U>::type>
+operator-(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_sub(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline softfloat<typename softfloat_promote<T, U>::type>
+operator*(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_mul(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline softfloat<typename softfloat_promote<T, U>::type>
+operator/(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_div(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline bool operator==(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_eq(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline bool operator!=(const softfloat<T> &a, const softfloat<U> &b)
+{
+    return !(a == b);
+}
+
+template <typename T, typename U>
+inline bool operator<(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_lt(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline bool operator<=(const softfloat<T> &a, const softfloat<U> &b)
+{
+    typedef typename softfloat_promote<T, U>::type P;
+    return softfloat_le(softfloat_cast<T, P>(a), softfloat_cast<U, P>(b));
+}
+
+template <typename T, typename U>
+inline bool operator>(const softfloat<T> &a, const softfloat<U> &b)
+{
+    return b < a;
+}
+
+template <typename T, typename U>
+inline bool operator>=(const softfloat<T> &a, const softfloat<U> &b)
+{
+    return b <= a;
+}
+
+/*----------------------------------------------------------------------------
+|  __                    _
+| |_     _ _|_     |V|  |_)  __  _| | _ _|_ _
+| |__><(_| |_      | |  |  |(_)(_|_|(_  |__>
+|
+| Widening products: the result format is softfloat_product<T>::type, which
+| holds the product of any two T values exactly (f8,f16 -> f32, f32 -> f64,
+| f64 -> f128).  softfloat_mulAddExact() therefore rounds only once, in the
+| final addition, just like a fused multiply-add into a wider accumulator.
+*----------------------------------------------------------------------------*/
+template <typename T>
+inline softfloat<typename softfloat_product<T>::type>
+softfloat_mulExact(const softfloat<T> &a, const softfloat<T> &b)
+{
+    typedef typename softfloat_product<T>::type P;
+    return softfloat_mul(softfloat_cast<T, P>(a), softfloat_cast<T, P>(b));
+}
+
+template <typename T>
+inline softfloat<typename softfloat_product<T>::type>
+softfloat_mulAddExact(const softfloat<T> &a, const softfloat<T> &b,
+                      const softfloat<typename softfloat_product<T>::type> &c)
+{
+    typedef typename softfloat_product<T>::type P;
+    return softfloat_add(
+        softfloat_mul(softfloat_cast<T, P>(a), softfloat_cast<T, P>(b)), P(c));
+}
@@ -53,11 +53,66 @@ Extended for float8 by Stefan Mach, Integrated Systems Institute, ETH Zurich
 | -> Added 8-bit floating point type (smach)
 *----------------------------------------------------------------------------*/
 typedef struct { uint8_t  v; } float8_t;	/* float8_t uses 5exp, 2mant bits*/
+typedef struct { uint16_t v; } bfloat16_t;	/* bfloat16_t uses 8exp, 7mant bits*/
+typedef struct { uint8_t  v; } e4m3_t;	/* OCP FP8 E4M3: 4exp, 3mant bits, no infinities*/
+typedef struct { uint8_t  v; } e3m2_t;	/* OCP FP6 E3M2: 3exp, 2mant bits in bits 0-5, no inf/NaN*/
+typedef struct { uint8_t  v; } e2m3_t;	/* OCP FP6 E2M3: 2exp, 3mant bits in bits 0-5, no inf/NaN*/
+typedef struct { uint8_t  v; } e2m1_t;	/* OCP FP4 E2M1: 2exp, 1mant bit in bits 0-3, no inf/NaN*/
 typedef struct { uint16_t v; } float16_t;
 typedef struct { uint32_t v; } float32_t;
 typedef struct { uint64_t v; } float64_t;
 typedef struct { uint64_t v[2]; } float128_t;
 
+/*----------------------------------------------------------------------------
+| 128-bit integers ('int128_t' in two's complement) for the conversions to and
+| from floating-point.  Where the compiler has a native 128-bit integer type
+| they are aliases of it; otherwise they are structures holding the lower and
+| upper 64 bits in 'v0' and 'v64'.
+*----------------------------------------------------------------------------*/
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#else
+typedef struct { uint64_t v0, v64; } int128_t;
+typedef struct { uint64_t v0, v64; } uint128_t;
+#endif
+
+/*----------------------------------------------------------------------------
+| Posits (two's-complement encodings, 0x80... is NaR) and their quires.  A
+| quire is a two's-complement fixed-point accumulator, least significant word
+| first, that holds any sum of products of posits exactly.
+*----------------------------------------------------------------------------*/
+typedef struct { uint8_t  v; } posit8_t;	/* posit<8,0>*/
+typedef struct { uint16_t v; } posit16_t;	/* posit<16,1>*/
+typedef struct { uint32_t v; } posit32_t;	/* posit<32,2>*/
+typedef struct { uint64_t v[1]; } quire8_t;
+typedef struct { uint64_t v[2]; } quire16_t;
+typedef struct { uint64_t v[8]; } quire32_t;
+
+/*----------------------------------------------------------------------------
+| Multiword floating-point numbers with a run-time precision of 'prec' bits,
+| from BIGF_MIN_PREC to BIGF_MAX_PREC, held entirely in the structure.  The
+| significand is the integer formed by the first BIGF_WORDS( prec ) elements
+| of 'sig' in the platform's normal endian order, with its most-significant
+| bit set and the bits below the precision clear; a normal number is 'sig'
+| times 2^('exp' + 1 - 32 * BIGF_WORDS( prec )), in other words 1.f * 2^'exp'.
+| 'sig' and 'exp' mean nothing for zeros, infinities and NaNs.
+*----------------------------------------------------------------------------*/
+#define BIGF_MIN_PREC 192
+#define BIGF_MAX_PREC 1024
+#define BIGF_WORDS( prec ) (((prec) + 31)>>5)
+#define BIGF_MAX_WORDS BIGF_WORDS( BIGF_MAX_PREC )
+#define BIGF_EXP_MAX 0x1FFFFFFF
+#define BIGF_EXP_MIN (-BIGF_EXP_MAX)
+enum { bigF_zero = 0, bigF_normal, bigF_inf, bigF_nan };
+typedef struct {
+    uint16_t prec;
+    uint8_t  sign;
+    uint8_t  cls;	/* bigF_zero, bigF_normal, bigF_inf or bigF_nan */
+    int32_t  exp;
+    uint32_t sig[BIGF_MAX_WORDS];
+} bigFloat_t;
+
 /*----------------------------------------------------------------------------
 | The format of an 80-bit extended floating-point number in memory.  This
 | structure must contain a 16-bit field named 'signExp' and a 64-bit field
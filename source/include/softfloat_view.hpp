@@ -0,0 +1,280 @@
+/*
+ * Zero-copy views over raw buffers of SoftFloat values.
+ *
+ * softfloat_view<T> reinterprets a buffer of raw encodings (e.g. a
+ * 'const uint16_t *' for float16_t, as read from an mmap'd file or a DMA
+ * dump) as a sequence of softfloat<T> objects without copying it.
+ *
+ * view.as<U>() returns a converting view that yields softfloat<U> values.
+ * Conversion is lazy: random access converts a single element, while
+ * iterating converts the source in chunks of 'Chunk' elements at a time so
+ * that the conversion runs in a tight loop.
+ *
+ *   softfloat_view<float16_t> h(raw, n);
+ *   for (float32 x : h.as<float32_t>())
+ *       acc += x;
+ */
+
+#pragma once
+#include "softfloat.hpp"
+
+#include <cstddef>
+#include <iterator>
+
+/*----------------------------------------------------------------------------
+| Build a value of format T from its raw encoding.
+*----------------------------------------------------------------------------*/
+template <typename T>
+static inline T softfloat_fromBits(const typename softfloat_format<T>::storage &b) {
+    T tmp;
+    tmp.v = b;
+    return tmp;
+}
+
+template <>
+inline extFloat80_t softfloat_fromBits<extFloat80_t>(const extFloat80_t &b) {
+    return b;
+}
+
+template <>
+inline float128_t softfloat_fromBits<float128_t>(const float128_t &b) {
+    return b;
+}
+
+/*----------------------------------------------------------------------------
+| Convert 'n' raw encodings of format From into values of format To.  This is
+| the batch kernel used by the converting view to fill a chunk.
+*----------------------------------------------------------------------------*/
+template <typename From, typename To>
+static inline void softfloat_convertChunk(
+    const typename softfloat_format<From>::storage *src, To *dst, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        dst[i] = softfloat_cast<From, To>(softfloat_fromBits<From>(src[i]));
+}
+
+/*----------------------------------------------------------------------------
+| Pairs with a batch converter in the C library hand the whole chunk to it.
+| A raw encoding has the layout of its value type (e.g. 'float16_t' is a
+| struct holding a 'uint16_t'), so the source is passed as is.
+*----------------------------------------------------------------------------*/
+template <>
+inline void softfloat_convertChunk<bfloat16_t, e4m3_t>(
+    const softfloat_format<bfloat16_t>::storage *src, e4m3_t *dst, size_t n)
+{
+    bf16_to_e4m3_array(reinterpret_cast<const bfloat16_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<e4m3_t, bfloat16_t>(
+    const softfloat_format<e4m3_t>::storage *src, bfloat16_t *dst, size_t n)
+{
+    e4m3_to_bf16_array(reinterpret_cast<const e4m3_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<e4m3_t, float16_t>(
+    const softfloat_format<e4m3_t>::storage *src, float16_t *dst, size_t n)
+{
+    e4m3_to_f16_array(reinterpret_cast<const e4m3_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<e4m3_t, float32_t>(
+    const softfloat_format<e4m3_t>::storage *src, float32_t *dst, size_t n)
+{
+    e4m3_to_f32_array(reinterpret_cast<const e4m3_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<float16_t, e4m3_t>(
+    const softfloat_format<float16_t>::storage *src, e4m3_t *dst, size_t n)
+{
+    f16_to_e4m3_array(reinterpret_cast<const float16_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<float32_t, e4m3_t>(
+    const softfloat_format<float32_t>::storage *src, e4m3_t *dst, size_t n)
+{
+    f32_to_e4m3_array(reinterpret_cast<const float32_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<float32_t, float8_t>(
+    const softfloat_format<float32_t>::storage *src, float8_t *dst, size_t n)
+{
+    f32_to_f8_array(reinterpret_cast<const float32_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<float32_t, float16_t>(
+    const softfloat_format<float32_t>::storage *src, float16_t *dst, size_t n)
+{
+    f32_to_f16_array(reinterpret_cast<const float32_t *>(src), dst, n);
+}
+
+template <>
+inline void softfloat_convertChunk<float32_t, bfloat16_t>(
+    const softfloat_format<float32_t>::storage *src, bfloat16_t *dst, size_t n)
+{
+    f32_to_bf16_array(reinterpret_cast<const float32_t *>(src), dst, n);
+}
+
+template <typename From, typename To, size_t Chunk = 64> class softfloat_convert_view;
+
+/*----------------------------------------------------------------------------
+| View of a raw buffer as softfloat<T> values.
+*----------------------------------------------------------------------------*/
+template <typename T> class softfloat_view {
+public:
+    typedef typename softfloat_format<T>::storage storage_type;
+    typedef softfloat<T> value_type;
+
+    class const_iterator {
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef softfloat<T> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const softfloat<T> *pointer;
+        typedef softfloat<T> reference;
+
+        inline const_iterator() : p(0) {}
+        inline explicit const_iterator(const storage_type *p) : p(p) {}
+
+        inline reference operator*() const { return softfloat_fromBits<T>(*p); }
+        inline reference operator[](difference_type i) const { return softfloat_fromBits<T>(p[i]); }
+
+        inline const_iterator &operator++() { ++p; return *this; }
+        inline const_iterator operator++(int) { const_iterator t(*this); ++p; return t; }
+        inline const_iterator &operator--() { --p; return *this; }
+        inline const_iterator operator--(int) { const_iterator t(*this); --p; return t; }
+        inline const_iterator &operator+=(difference_type i) { p += i; return *this; }
+        inline const_iterator &operator-=(difference_type i) { p -= i; return *this; }
+        inline const_iterator operator+(difference_type i) const { return const_iterator(p + i); }
+        inline const_iterator operator-(difference_type i) const { return const_iterator(p - i); }
+        inline difference_type operator-(const const_iterator &o) const { return p - o.p; }
+
+        inline bool operator==(const const_iterator &o) const { return p == o.p; }
+        inline bool operator!=(const const_iterator &o) const { return p != o.p; }
+        inline bool operator<(const const_iterator &o) const { return p < o.p; }
+        inline bool operator>(const const_iterator &o) const { return p > o.p; }
+        inline bool operator<=(const const_iterator &o) const { return p <= o.p; }
+        inline bool operator>=(const const_iterator &o) const { return p >= o.p; }
+
+    private:
+        const storage_type *p;
+    };
+
+    inline softfloat_view(const storage_type *data, size_t n) : d(data), n(n) {}
+
+    inline size_t size() const { return n; }
+    inline bool empty() const { return n == 0; }
+    inline const storage_type *data() const { return d; }
+
+    inline softfloat<T> operator[](size_t i) const { return softfloat_fromBits<T>(d[i]); }
+
+    inline const_iterator begin() const { return const_iterator(d); }
+    inline const_iterator end() const { return const_iterator(d + n); }
+
+    // Sub-view of 'count' elements starting at 'first'
+    inline softfloat_view subview(size_t first, size_t count) const {
+        return softfloat_view(d + first, count);
+    }
+
+    // Lazily converting view yielding softfloat<U>
+    template <typename U, size_t Chunk = 64>
+    inline softfloat_convert_view<T, U, Chunk> as() const {
+        return softfloat_convert_view<T, U, Chunk>(d, n);
+    }
+
+private:
+    const storage_type *d;
+    size_t n;
+};
+
+/*----------------------------------------------------------------------------
+| View of a raw buffer of format From, converted on access to softfloat<To>.
+*----------------------------------------------------------------------------*/
+template <typename From, typename To, size_t Chunk> class softfloat_convert_view {
+public:
+    typedef typename softfloat_format<From>::storage storage_type;
+    typedef softfloat<To> value_type;
+
+    // Sequential iterator: converts the source one chunk at a time.
+    class const_iterator {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef softfloat<To> value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const softfloat<To> *pointer;
+        typedef softfloat<To> reference;
+
+        inline const_iterator(const storage_type *pos, const storage_type *end)
+            : next(pos), last(end), i(0), filled(0) {}
+
+        inline reference operator*() {
+            if (i == filled)
+                refill();
+            return buf[i];
+        }
+
+        inline const_iterator &operator++() {
+            if (i == filled)
+                refill();
+            ++i;
+            return *this;
+        }
+
+        inline const_iterator operator++(int) {
+            const_iterator t(*this);
+            ++*this;
+            return t;
+        }
+
+        inline bool operator==(const const_iterator &o) const { return position() == o.position(); }
+        inline bool operator!=(const const_iterator &o) const { return position() != o.position(); }
+
+    private:
+        const storage_type *next; // first source element not yet converted
+        const storage_type *last;
+        size_t i, filled;
+        To buf[Chunk];
+
+        inline const storage_type *position() const { return next - (filled - i); }
+
+        inline void refill() {
+            size_t left = last - next;
+            filled = left < Chunk ? left : Chunk;
+            softfloat_convertChunk<From, To>(next, buf, filled);
+            next += filled;
+            i = 0;
+        }
+    };
+
+    inline softfloat_convert_view(const storage_type *data, size_t n) : d(data), n(n) {}
+
+    inline size_t size() const { return n; }
+    inline bool empty() const { return n == 0; }
+
+    // Random access converts a single element.
+    inline softfloat<To> operator[](size_t i) const {
+        return softfloat_cast<From, To>(softfloat_fromBits<From>(d[i]));
+    }
+
+    inline const_iterator begin() const { return const_iterator(d, d + n); }
+    inline const_iterator end() const { return const_iterator(d + n, d + n); }
+
+    // Convert elements [first, first+count) into 'out' in one batch.
+    inline void copy_to(To *out, size_t first = 0, size_t count = size_t(-1)) const {
+        if (first >= n)
+            return;
+        if (count > n - first)
+            count = n - first;
+        softfloat_convertChunk<From, To>(d + first, out, count);
+    }
+
+private:
+    const storage_type *d;
+    size_t n;
+};
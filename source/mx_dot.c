@@ -0,0 +1,93 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+float32_t
+ mx_dot(
+     uint_fast8_t fmtA,
+     const uint8_t *aPtr,
+     uint_fast8_t fmtB,
+     const uint8_t *bPtr,
+     size_t n
+ )
+{
+    size_t count, blockBytesA, blockBytesB, i;
+    uint32_t uiA[MX_BLOCK_SIZE], uiB[MX_BLOCK_SIZE];
+    uint_fast8_t scaleA, scaleB;
+    union ui32_f32 uA, uB;
+    float32_t sum, z;
+
+    blockBytesA = mx_blockBytes( fmtA );
+    blockBytesB = mx_blockBytes( fmtB );
+    z.v = 0;
+    while ( n ) {
+        count = (n < MX_BLOCK_SIZE) ? n : MX_BLOCK_SIZE;
+        scaleA = softfloat_mxUnpackBlock( fmtA, aPtr, uiA );
+        scaleB = softfloat_mxUnpackBlock( fmtB, bPtr, uiB );
+        /*--------------------------------------------------------------------
+        | Products of elements are exact in binary32; the block sum is scaled
+        | by both shared scales with a single rounding, then accumulated.
+        *--------------------------------------------------------------------*/
+        sum.v = 0;
+        for ( i = 0; i < count; ++i ) {
+            uA.ui = uiA[i];
+            uB.ui = uiB[i];
+            sum = f32_mulAdd( uA.f, uB.f, sum );
+        }
+        if ( (scaleA == mx_scaleNaN) || (scaleB == mx_scaleNaN) ) {
+            sum.v = defaultNaNF32UI;
+        } else {
+            sum.v =
+                softfloat_mxScaleF32UI(
+                    sum.v, (int_fast16_t) scaleA + scaleB - 2 * 0x7F );
+        }
+        z = f32_add( z, sum );
+        aPtr += blockBytesA;
+        bPtr += blockBytesB;
+        n -= count;
+    }
+    return z;
+
+}
+
@@ -0,0 +1,72 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "specialize.h"
+#include "softfloat.h"
+
+void
+ mx_to_f32( uint_fast8_t fmt, const uint8_t *aPtr, float32_t *zPtr, size_t n )
+{
+    size_t count, blockBytes, i;
+    uint32_t uiA[MX_BLOCK_SIZE];
+    uint_fast8_t scale;
+    int_fast16_t exp;
+
+    blockBytes = mx_blockBytes( fmt );
+    while ( n ) {
+        count = (n < MX_BLOCK_SIZE) ? n : MX_BLOCK_SIZE;
+        scale = softfloat_mxUnpackBlock( fmt, aPtr, uiA );
+        if ( scale == mx_scaleNaN ) {
+            for ( i = 0; i < count; ++i ) zPtr[i].v = defaultNaNF32UI;
+        } else {
+            exp = (int_fast16_t) scale - 0x7F;
+            for ( i = 0; i < count; ++i ) {
+                zPtr[i].v = softfloat_mxScaleF32UI( uiA[i], exp );
+            }
+        }
+        aPtr += blockBytes;
+        zPtr += count;
+        n -= count;
+    }
+
+}
+
@@ -0,0 +1,163 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void
+ softfloat_addBigF(
+     const bigFloat_t *aPtr,
+     const bigFloat_t *bPtr,
+     bigFloat_t *zPtr,
+     bool negateB
+ )
+{
+    bool signA, signB;
+    uint_fast8_t sizeA_words, sizeB_words, size_words, i;
+    uint32_t sigA[BIGF_MAX_WORDS + 2], sigB[BIGF_MAX_WORDS + 2];
+    int32_t expA, expB;
+    uint32_t *sigXPtr, *sigYPtr;
+    bool signX;
+    int32_t expX, expY;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    signA = aPtr->sign;
+    signB = bPtr->sign ^ negateB;
+    if ( (aPtr->cls == bigF_nan) || (bPtr->cls == bigF_nan) ) {
+        zPtr->cls = bigF_nan;
+        return;
+    }
+    if ( aPtr->cls == bigF_inf ) {
+        if ( (bPtr->cls == bigF_inf) && (signA != signB) ) {
+            softfloat_raiseFlags( softfloat_flag_invalid );
+            zPtr->cls = bigF_nan;
+            return;
+        }
+        zPtr->sign = signA;
+        zPtr->cls = bigF_inf;
+        return;
+    }
+    if ( bPtr->cls == bigF_inf ) {
+        zPtr->sign = signB;
+        zPtr->cls = bigF_inf;
+        return;
+    }
+    if ( (aPtr->cls == bigF_zero) && (bPtr->cls == bigF_zero) ) {
+        zPtr->sign =
+            (signA == signB) ? signA
+                : (softfloat_roundingMode == softfloat_round_min);
+        zPtr->cls = bigF_zero;
+        return;
+    }
+    /*------------------------------------------------------------------------
+    | The significands go one word below the top of a buffer wide enough for
+    | the operands and the result, plus a word of guard bits.  A zero operand
+    | gets a zero significand.
+    *------------------------------------------------------------------------*/
+    sizeA_words = BIGF_WORDS( aPtr->prec );
+    sizeB_words = BIGF_WORDS( bPtr->prec );
+    size_words = BIGF_WORDS( zPtr->prec );
+    if ( size_words < sizeA_words ) size_words = sizeA_words;
+    if ( size_words < sizeB_words ) size_words = sizeB_words;
+    size_words += 2;
+    for ( i = 1; i <= size_words; ++i ) {
+        sigA[indexWord( size_words, size_words - i )] =
+            (2 <= i) && (i <= sizeA_words + 1) && (aPtr->cls == bigF_normal)
+                ? aPtr->sig[indexWord( sizeA_words, sizeA_words + 1 - i )]
+                : 0;
+        sigB[indexWord( size_words, size_words - i )] =
+            (2 <= i) && (i <= sizeB_words + 1) && (bPtr->cls == bigF_normal)
+                ? bPtr->sig[indexWord( sizeB_words, sizeB_words + 1 - i )]
+                : 0;
+    }
+    expA = (aPtr->cls == bigF_zero) ? bPtr->exp : aPtr->exp;
+    expB = (bPtr->cls == bigF_zero) ? aPtr->exp : bPtr->exp;
+    /*------------------------------------------------------------------------
+    | X is the operand of larger magnitude, Y the other one.
+    *------------------------------------------------------------------------*/
+    sigXPtr = sigA;
+    sigYPtr = sigB;
+    signX = signA;
+    expX = expA;
+    expY = expB;
+    if ( expA == expB ) {
+        for ( i = size_words; i--; ) {
+            if (
+                sigA[indexWord( size_words, i )]
+                    != sigB[indexWord( size_words, i )]
+            ) {
+                break;
+            }
+        }
+        if ( i == (uint_fast8_t) -1 ) {
+            if ( signA != signB ) {
+                zPtr->sign =
+                    (softfloat_roundingMode == softfloat_round_min);
+                zPtr->cls = bigF_zero;
+                return;
+            }
+        } else if (
+            sigA[indexWord( size_words, i )]
+                < sigB[indexWord( size_words, i )]
+        ) {
+            goto swap;
+        }
+    } else if ( expA < expB ) {
+ swap:
+        sigXPtr = sigB;
+        sigYPtr = sigA;
+        signX = signB;
+        expX = expB;
+        expY = expA;
+    }
+    if ( expX != expY ) {
+        softfloat_shiftRightJamM( size_words, sigYPtr, expX - expY, sigYPtr );
+    }
+    if ( signA == signB ) {
+        softfloat_addM( size_words, sigXPtr, sigYPtr, sigXPtr );
+    } else {
+        softfloat_subM( size_words, sigXPtr, sigYPtr, sigXPtr );
+    }
+    softfloat_normRoundPackMToBigF(
+        signX, expX + 32, size_words, sigXPtr, zPtr );
+
+}
+
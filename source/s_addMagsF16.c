@@ -133,7 +133,7 @@ float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         }
         sigZ = sig32Z>>16;
         if ( sig32Z & 0xFFFF ) {
-            sigZ |= 1;
+            sigZ = softfloat_shiftRightStochJam64( sig32Z, 16 );
         } else {
             if ( ! (sigZ & 0xF) && (expZ < 0x1E) ) {
                 sigZ >>= 4;
@@ -151,6 +151,24 @@ float16_t softfloat_addMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
     *------------------------------------------------------------------------*/
  addEpsilon:
     roundingMode = softfloat_roundingMode;
+    if ( roundingMode == softfloat_round_stochastic ) {
+        /*--------------------------------------------------------------------
+        | Round away from zero with a probability equal to the smaller
+        | operand over an ulp of the larger one.
+        *--------------------------------------------------------------------*/
+        if ( expDiff < 0 ) {
+            expDiff = -expDiff;
+            expB = expA;
+            sigB = sigA;
+        }
+        roundingMode =
+            (softfloat_stochasticBits()
+                 < (uint_fast64_t) (sigB + (expB ? 0x0400 : sigB))
+                       <<(64 - expDiff))
+                ? (signF16UI( uiZ ) ? softfloat_round_min
+                       : softfloat_round_max)
+                : softfloat_round_minMag;
+    }
     if ( roundingMode != softfloat_round_near_even ) {
         if (
             roundingMode
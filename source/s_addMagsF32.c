@@ -96,7 +96,7 @@ float32_t softfloat_addMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
             }
             expZ = expB;
             sigA += expA ? 0x20000000 : sigA;
-            sigA = softfloat_shiftRightJam32( sigA, -expDiff );
+            sigA = softfloat_shiftRightStochJam64( sigA, -expDiff );
         } else {
             if ( expA == 0xFF ) {
                 if ( sigA ) goto propagateNaN;
@@ -105,7 +105,7 @@ float32_t softfloat_addMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
             }
             expZ = expA;
             sigB += expB ? 0x20000000 : sigB;
-            sigB = softfloat_shiftRightJam32( sigB, expDiff );
+            sigB = softfloat_shiftRightStochJam64( sigB, expDiff );
         }
         sigZ = 0x20000000 + sigA + sigB;
         if ( sigZ < 0x40000000 ) {
@@ -94,7 +94,7 @@ float64_t
             } else {
                 sigA <<= 1;
             }
-            sigA = softfloat_shiftRightJam64( sigA, -expDiff );
+            sigA = softfloat_shiftRightStochJam64( sigA, -expDiff );
         } else {
             if ( expA == 0x7FF ) {
                 if ( sigA ) goto propagateNaN;
@@ -107,7 +107,7 @@ float64_t
             } else {
                 sigB <<= 1;
             }
-            sigB = softfloat_shiftRightJam64( sigB, expDiff );
+            sigB = softfloat_shiftRightStochJam64( sigB, expDiff );
         }
         sigZ = UINT64_C( 0x2000000000000000 ) + sigA + sigB;
         if ( sigZ < UINT64_C( 0x4000000000000000 ) ) {
@@ -141,7 +141,7 @@ float8_t softfloat_addMagsF8( uint_fast8_t uiA, uint_fast8_t uiB )
         }
         sigZ = sig16Z>>8; /* shift back into place so that 4 round bits rem */
         if ( sig16Z & 0xFF ) { /* detect need for sticky bit */
-            sigZ |= 1;
+            sigZ = softfloat_shiftRightStochJam64( sig16Z, 8 );
         } else { /* only round bits to worry about */
             if ( ! (sigZ & 0xF) && (expZ < 0x1E) ) { /* exact result, < inf */
                 sigZ >>= 4; /* cut round bits */
@@ -159,6 +159,21 @@ float8_t softfloat_addMagsF8( uint_fast8_t uiA, uint_fast8_t uiB )
     *------------------------------------------------------------------------*/
  addEpsilon: /* add something to the round bits to signify inexact op */
     roundingMode = softfloat_roundingMode;
+    if ( roundingMode == softfloat_round_stochastic ) {
+        /* round up with probability (smaller op) / (ulp of the larger op) */
+        if ( expDiff < 0 ) { /* smaller op is A */
+            expDiff = -expDiff;
+            expB = expA;
+            sigB = sigA;
+        }
+        roundingMode = /* decide the direction here, then round directed */
+            (softfloat_stochasticBits()
+                 < (uint_fast64_t) (sigB + (expB ? 0x04 : sigB))
+                       <<(64 - expDiff))
+                ? (signF8UI( uiZ ) ? softfloat_round_min
+                       : softfloat_round_max)
+                : softfloat_round_minMag;
+    }
     if ( roundingMode != softfloat_round_near_even ) {
         if (
             roundingMode
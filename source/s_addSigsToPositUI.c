@@ -0,0 +1,86 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast32_t
+ softfloat_addSigsToPositUI(
+     uint_fast8_t n,
+     uint_fast8_t es,
+     bool signA,
+     int_fast32_t expA,
+     uint_fast64_t sigA,
+     bool signB,
+     int_fast32_t expB,
+     uint_fast64_t sigB
+ )
+{
+    bool sign;
+    int_fast32_t exp;
+    uint_fast64_t sig;
+
+    /*------------------------------------------------------------------------
+    | Both significands have their leading bit at bit 61 and at least two
+    | zero bits below them, so a jammed alignment never reaches a rounding
+    | boundary, even when it is subtracted.
+    *------------------------------------------------------------------------*/
+    if ( (expA < expB) || ((expA == expB) && (sigA < sigB)) ) {
+        sign = signA;
+        signA = signB;
+        signB = sign;
+        exp = expA;
+        expA = expB;
+        expB = exp;
+        sig = sigA;
+        sigA = sigB;
+        sigB = sig;
+    }
+    if ( expA != expB ) sigB = softfloat_shiftRightJam64( sigB, expA - expB );
+    if ( signA == signB ) {
+        sig = sigA + sigB;
+    } else {
+        sig = sigA - sigB;
+        if ( ! sig ) return 0;
+    }
+    return softfloat_normRoundPackToPositUI( n, es, signA, expA, sig );
+
+}
+
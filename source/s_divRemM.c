@@ -0,0 +1,107 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_divRemM
+
+void
+ softfloat_divRemM(
+     uint_fast8_t sizeA_words,
+     uint32_t *remPtr,
+     uint_fast8_t sizeB_words,
+     const uint32_t *bPtr,
+     uint32_t *qPtr
+ )
+{
+    uint_fast8_t sizeQ_words, i;
+    uint32_t wordB, wordR;
+    int j;
+    uint64_t dwordRem, dwordProd, dwordZ;
+    uint32_t q;
+    uint_fast8_t carry;
+
+    sizeQ_words = sizeA_words - sizeB_words;
+    wordB = bPtr[indexWordHi( sizeB_words )];
+    for ( j = sizeQ_words - 1; 0 <= j; --j ) {
+        /*--------------------------------------------------------------------
+        | The estimate from the top two words of the partial remainder is at
+        | most two too large (Knuth, algorithm D).
+        *--------------------------------------------------------------------*/
+        wordR = remPtr[indexWord( sizeA_words, j + sizeB_words )];
+        if ( wordB <= wordR ) {
+            q = 0xFFFFFFFF;
+        } else {
+            dwordRem =
+                (uint64_t) wordR<<32
+                    | remPtr[indexWord( sizeA_words, j + sizeB_words - 1 )];
+            q = dwordRem / wordB;
+        }
+        dwordProd = 0;
+        dwordZ = 0;
+        for ( i = 0; i < sizeB_words; ++i ) {
+            dwordProd =
+                (uint64_t) bPtr[indexWord( sizeB_words, i )] * q
+                    + (dwordProd>>32);
+            dwordZ =
+                (uint64_t) remPtr[indexWord( sizeA_words, j + i )]
+                    - (uint32_t) dwordProd - (uint32_t) (dwordZ>>63);
+            remPtr[indexWord( sizeA_words, j + i )] = dwordZ;
+        }
+        wordR -= (uint32_t) (dwordProd>>32) + (uint32_t) (dwordZ>>63);
+        while ( wordR & 0x80000000 ) {
+            --q;
+            carry = 0;
+            for ( i = 0; i < sizeB_words; ++i ) {
+                dwordZ =
+                    (uint64_t) remPtr[indexWord( sizeA_words, j + i )]
+                        + bPtr[indexWord( sizeB_words, i )] + carry;
+                remPtr[indexWord( sizeA_words, j + i )] = dwordZ;
+                carry = dwordZ>>32;
+            }
+            wordR += carry;
+        }
+        remPtr[indexWord( sizeA_words, j + sizeB_words )] = wordR;
+        qPtr[indexWord( sizeQ_words, j )] = q;
+    }
+
+}
+
+#endif
+
@@ -0,0 +1,166 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Largest magnitude of each fixed-point type, for positive and for negative
+| values.
+*----------------------------------------------------------------------------*/
+static const uint32_t maxPos[] = { 0x7F, 0xFF, 0x7FFF, 0x7FFFFFFF };
+static const uint32_t maxNeg[] = { 0x80, 0, 0x8000, 0x80000000 };
+
+void
+ softfloat_f64ToFixed(
+     uint_fast8_t type,
+     int_fast8_t fracBits,
+     float64_t a,
+     void *zPtr,
+     size_t i
+ )
+{
+    union ui64_f64 uA;
+    uint_fast64_t uiA, sig, z, rem;
+    bool sign;
+    int_fast16_t exp, shiftDist;
+    uint_fast8_t roundingMode;
+    uint_fast32_t max;
+    int_fast64_t value;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    sign = signF64UI( uiA );
+    exp  = expF64UI( uiA );
+    sig  = fracF64UI( uiA );
+    max = sign ? maxNeg[type] : maxPos[type];
+    if ( exp == 0x7FF ) {
+        if ( sig ) {
+            softfloat_raiseFlags( softfloat_flag_invalid );
+            value = 0;
+            goto store;
+        }
+        goto saturate;
+    }
+    if ( exp ) {
+        sig |= UINT64_C( 0x0010000000000000 );
+    } else {
+        exp = 1;
+    }
+    /*------------------------------------------------------------------------
+    | The scaled value is 'sig' * 2^-'shiftDist'.
+    *------------------------------------------------------------------------*/
+    shiftDist = 0x433 - fracBits - exp;
+    if ( shiftDist <= 0 ) {
+        if ( ! sig ) {
+            value = 0;
+            goto store;
+        }
+        if ( shiftDist < -10 ) goto saturate;
+        z = sig<<-shiftDist;
+        if ( max < z ) goto saturate;
+        value = sign ? -(int_fast64_t) z : (int_fast64_t) z;
+        goto store;
+    }
+    if ( shiftDist < 64 ) {
+        z = sig>>shiftDist;
+        rem = sig<<(64 - shiftDist);
+    } else {
+        z = 0;
+        rem =
+            (shiftDist < 128)
+                ? softfloat_shiftRightJam64( sig, shiftDist - 64 )
+                : (sig != 0);
+    }
+    /*------------------------------------------------------------------------
+    | 'rem' is the discarded fraction of a unit, in units of 2^-64.
+    *------------------------------------------------------------------------*/
+    if ( rem ) {
+        roundingMode = softfloat_roundingMode;
+        if ( roundingMode == softfloat_round_near_even ) {
+            if (
+                (rem > UINT64_C( 0x8000000000000000 ))
+                    || ((rem == UINT64_C( 0x8000000000000000 )) && (z & 1))
+            ) {
+                ++z;
+            }
+        } else if ( roundingMode == softfloat_round_near_maxMag ) {
+            if ( rem >= UINT64_C( 0x8000000000000000 ) ) ++z;
+        } else if (
+            roundingMode == (sign ? softfloat_round_min : softfloat_round_max)
+        ) {
+            ++z;
+        } else if ( roundingMode == softfloat_round_stochastic ) {
+            if ( softfloat_stochasticBits() < rem ) ++z;
+#ifdef SOFTFLOAT_ROUND_ODD
+        } else if ( roundingMode == softfloat_round_odd ) {
+            z |= 1;
+#endif
+        }
+    }
+    if ( max < z ) goto saturate;
+    if ( rem ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+    value = sign ? -(int_fast64_t) z : (int_fast64_t) z;
+    goto store;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ saturate:
+    softfloat_raiseFlags( softfloat_flag_invalid );
+    value = sign ? -(int_fast64_t) max : (int_fast64_t) max;
+ store:
+    switch ( type ) {
+     case fixed_i8:
+        ((int8_t *) zPtr)[i] = value;
+        break;
+     case fixed_ui8:
+        ((uint8_t *) zPtr)[i] = value;
+        break;
+     case fixed_i16:
+        ((int16_t *) zPtr)[i] = value;
+        break;
+     default:
+        ((int32_t *) zPtr)[i] = value;
+        break;
+    }
+
+}
+
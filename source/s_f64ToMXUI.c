@@ -0,0 +1,189 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Grid of the FP6, FP4 and INT8 elements: 'sigBits' significant bits, normal
+| exponents 'expMin' to 'expMax', and magnitudes counted in units of the
+| smallest subnormal 2^'unitExp' up to 'maxMag'.  INT8 is a fixed-point grid
+| (every value is a multiple of 2^-6), so it never raises underflow.
+*----------------------------------------------------------------------------*/
+static const struct {
+    uint8_t bits, sigBits;
+    int8_t expMin, expMax, unitExp;
+    uint16_t maxMag;
+} grids[] = {
+    { 6, 3, -2, 4, -4, 448 },   /* mx_e3m2: 28 */
+    { 6, 4,  0, 2, -3,  60 },   /* mx_e2m3: 7.5 */
+    { 4, 2,  0, 2, -1,  12 },   /* mx_e2m1: 6 */
+    { 8, 8,  1, 0, -6, 127 }    /* mx_int8: 127/64 */
+};
+
+/*----------------------------------------------------------------------------
+| Rounds 'sig' * 2^-'dist' to an integer in the current rounding mode.
+*----------------------------------------------------------------------------*/
+static uint_fast64_t
+ roundToUnit( bool sign, uint_fast64_t sig, int_fast16_t dist, bool *inexactPtr )
+{
+    uint_fast64_t z, rem;
+    uint_fast8_t roundingMode;
+
+    if ( dist < 64 ) {
+        z = sig>>dist;
+        rem = sig<<(64 - dist);
+    } else {
+        z = 0;
+        rem = (dist == 64) ? sig : (sig != 0);
+    }
+    *inexactPtr = (rem != 0);
+    if ( ! rem ) return z;
+    roundingMode = softfloat_roundingMode;
+    if ( roundingMode == softfloat_round_near_even ) {
+        if (
+            (rem > UINT64_C( 0x8000000000000000 ))
+                || ((rem == UINT64_C( 0x8000000000000000 )) && (z & 1))
+        ) {
+            ++z;
+        }
+    } else if ( roundingMode == softfloat_round_near_maxMag ) {
+        if ( rem >= UINT64_C( 0x8000000000000000 ) ) ++z;
+    } else if (
+        roundingMode == (sign ? softfloat_round_min : softfloat_round_max)
+    ) {
+        ++z;
+#ifdef SOFTFLOAT_ROUND_ODD
+    } else if ( roundingMode == softfloat_round_odd ) {
+        z |= 1;
+#endif
+    }
+    return z;
+
+}
+
+uint_fast8_t softfloat_f64ToMXUI( uint_fast8_t fmt, float64_t a )
+{
+    uint_fast8_t savedMode, uiZ;
+    union ui64_f64 uA;
+    uint_fast64_t uiA, sig, mag;
+    bool sign, inexact, tiny;
+    int_fast16_t exp, unitExp;
+    int_fast8_t expZ;
+    struct exp16_sig64 normExpSig;
+
+    /*------------------------------------------------------------------------
+    | FP8 elements round as the standalone formats do, except that they
+    | saturate instead of overflowing to infinity or NaN.
+    *------------------------------------------------------------------------*/
+    if ( fmt == mx_e5m2 ) {
+        uiZ = f64_to_f8( a ).v;
+        if ( (uiZ & 0x7F) == 0x7C ) --uiZ;
+        return uiZ;
+    }
+    if ( fmt == mx_e4m3 ) {
+        savedMode = e4m3_overflowMode;
+        e4m3_overflowMode = e4m3_overflow_saturate;
+        uiZ = f64_to_e4m3( a ).v;
+        e4m3_overflowMode = savedMode;
+        return uiZ;
+    }
+    fmt -= mx_e3m2;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    uA.f = a;
+    uiA = uA.ui;
+    sign = signF64UI( uiA );
+    exp  = expF64UI( uiA );
+    sig  = fracF64UI( uiA );
+    if ( ! exp ) {
+        if ( ! sig ) {
+            mag = 0;
+            goto pack;
+        }
+        normExpSig = softfloat_normSubnormalF64Sig( sig );
+        exp = normExpSig.exp;
+        sig = normExpSig.sig;
+    }
+    sig = (sig | UINT64_C( 0x0010000000000000 ))<<10;
+    exp -= 0x3FF;
+    /*------------------------------------------------------------------------
+    | 'sig' * 2^('exp' - 62) is rounded onto the grid: the unit is 2^'unitExp'
+    | below the normal range and 'sigBits' significant bits within it.
+    *------------------------------------------------------------------------*/
+    if ( grids[fmt].expMax + 1 < exp ) goto overflow;
+    unitExp = exp - (grids[fmt].sigBits - 1);
+    if ( unitExp < grids[fmt].unitExp ) unitExp = grids[fmt].unitExp;
+    mag = roundToUnit( sign, sig, 62 - exp + unitExp, &inexact )
+              <<(unitExp - grids[fmt].unitExp);
+    if ( grids[fmt].maxMag < mag ) goto overflow;
+    if ( inexact ) {
+        softfloat_exceptionFlags |= softfloat_flag_inexact;
+        if ( (fmt + mx_e3m2 != mx_int8) && (exp < grids[fmt].expMin) ) {
+            tiny = true;
+            if (
+                (softfloat_detectTininess == softfloat_tininess_afterRounding)
+                    && (exp == grids[fmt].expMin - 1)
+            ) {
+                tiny =
+                    roundToUnit(
+                        sign, sig, 63 - grids[fmt].sigBits, &inexact )
+                        < (UINT64_C( 1 )<<grids[fmt].sigBits);
+            }
+            if ( tiny ) softfloat_raiseFlags( softfloat_flag_underflow );
+        }
+    }
+    goto pack;
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ overflow:
+    softfloat_raiseFlags( softfloat_flag_overflow | softfloat_flag_inexact );
+    mag = grids[fmt].maxMag;
+ pack:
+    if ( fmt + mx_e3m2 == mx_int8 ) return (uint8_t) (sign ? -mag : mag);
+    uiZ = (uint_fast8_t) sign<<(grids[fmt].bits - 1);
+    if ( mag < (1U<<(grids[fmt].sigBits - 1)) ) return uiZ | mag;
+    expZ = 32 - softfloat_countLeadingZeros32( mag ) - grids[fmt].sigBits + 1;
+    return
+        uiZ | expZ<<(grids[fmt].sigBits - 1)
+            | ((mag>>(expZ - 1)) & ((1U<<(grids[fmt].sigBits - 1)) - 1));
+
+}
+
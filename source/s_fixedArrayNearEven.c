@@ -0,0 +1,536 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+#define SOFTFLOAT_HAVE_AVX2
+#include <immintrin.h>
+#endif
+
+/*----------------------------------------------------------------------------
+| Elements are converted in chunks.  A chunk in which every element takes the
+| common path (finite, in range, normal result) is stored as computed by the
+| kernels below; any other chunk is converted again element by element with
+| 'softfloat_f64ToFixed' or 'f64_to_f32'/'f64_to_f16', so that saturation,
+| NaNs and subnormal results keep their exact flags.  In round-to-nearest-even
+| both give the same results, and neither consumes stochastic bits.
+*----------------------------------------------------------------------------*/
+#define FIXED_CHUNK 256
+
+enum {
+    fixedStatus_inexact = 1,
+    fixedStatus_slow    = 2
+};
+
+/*----------------------------------------------------------------------------
+| Largest magnitude of each fixed-point type, for positive and for negative
+| values, as signed 32-bit integers ('fixed_i32' leaves -2^31 to the scalar
+| path).
+*----------------------------------------------------------------------------*/
+static const int32_t maxPos[] = { 0x7F, 0xFF, 0x7FFF, 0x7FFFFFFF };
+static const int32_t maxNeg[] = { 0x80, 0, 0x8000, 0x7FFFFFFF };
+
+/*----------------------------------------------------------------------------
+| Format of the floating-point elements: 'sigBits' is 23 for float32_t and 10
+| for float16_t.
+*----------------------------------------------------------------------------*/
+struct fixedFormat {
+    int_fast8_t sigBits, signPos;
+    int_fast16_t bias;
+    uint32_t expMax;
+};
+
+static struct fixedFormat fixedFormat( uint_fast8_t sigBits )
+{
+    struct fixedFormat f;
+
+    f.sigBits = sigBits;
+    if ( sigBits == 23 ) {
+        f.signPos = 31;
+        f.bias = 0x7F;
+        f.expMax = 0xFF;
+    } else {
+        f.signPos = 15;
+        f.bias = 0xF;
+        f.expMax = 0x1F;
+    }
+    return f;
+
+}
+
+/*----------------------------------------------------------------------------
+| Rounds 'uiA'[0..'n') times 2^'fracBits' to integers in 'z'.  The scaled
+| value of an element is 'sig' * 2^-'shiftDist'.  A distance above 31 is
+| clamped, which still rounds a significand below 2^24 to 0 and leaves it
+| inexact; a distance from -7 to 0 shifts it left exactly, below 2^31.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t
+ toFixedScalar(
+     const uint32_t *uiA,
+     size_t n,
+     struct fixedFormat f,
+     int_fast8_t fracBits,
+     int32_t maxP,
+     int32_t maxN,
+     int32_t *z
+ )
+{
+    const int32_t base = f.bias + f.sigBits - fracBits;
+    uint32_t inexact = 0, slow = 0;
+    size_t j;
+
+    for ( j = 0; j < n; ++j ) {
+        uint32_t sign = uiA[j]>>f.signPos & 1;
+        uint32_t exp = uiA[j]>>f.sigBits & f.expMax;
+        uint32_t sig = uiA[j] & (((uint32_t) 1<<f.sigBits) - 1);
+        int32_t shiftDist, dist;
+        uint32_t q, rem, half, left;
+
+        slow |= (exp == f.expMax);
+        sig |= (uint32_t) (exp != 0)<<f.sigBits;
+        exp += (exp == 0);
+        shiftDist = base - (int32_t) exp;
+        dist = (shiftDist < 1) ? 1 : (shiftDist > 31) ? 31 : shiftDist;
+        q = sig>>dist;
+        rem = sig & (((uint32_t) 1<<dist) - 1);
+        half = (uint32_t) 1<<(dist - 1);
+        q += (rem > half) | ((rem == half) & q);
+        left = -(uint32_t) (shiftDist < 1);
+        q = (q & ~left) | ((sig<<(-shiftDist & 7)) & left);
+        rem &= ~left;
+        slow |=
+            (shiftDist < -7)
+                | ((int32_t) q > (maxP ^ ((maxP ^ maxN) & -(int32_t) sign)));
+        inexact |= rem;
+        z[j] = (int32_t) ((q ^ -sign) + sign);
+    }
+    return (inexact ? fixedStatus_inexact : 0) | (slow ? fixedStatus_slow : 0);
+
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the integers 'a'[0..'n') times 2^-'fracBits' to the format 'f' in
+| 'uiZ'.  A nonzero magnitude is normalized to [2^31, 2^32) and rounded to
+| 'f.sigBits' + 1 bits; results outside the normal range are left to the
+| scalar path.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t
+ fromFixedScalar(
+     const int32_t *a,
+     size_t n,
+     struct fixedFormat f,
+     int_fast8_t fracBits,
+     uint32_t *uiZ
+ )
+{
+    const int_fast8_t dist = 31 - f.sigBits;
+    const uint32_t half = (uint32_t) 1<<(dist - 1);
+    uint32_t inexact = 0, slow = 0;
+    size_t j;
+
+    for ( j = 0; j < n; ++j ) {
+        uint32_t sign = (uint32_t) a[j]>>31;
+        uint32_t nonzero = -(uint32_t) (a[j] != 0);
+        uint32_t sig = ((uint32_t) a[j] ^ -sign) + sign;
+        uint32_t s, q, rem, uiZj;
+        int32_t exp = f.bias + 30 - fracBits;
+
+        s = (sig < 0x10000)<<4; sig <<= s; exp -= (int32_t) s;
+        s = (sig < 0x1000000)<<3; sig <<= s; exp -= (int32_t) s;
+        s = (sig < 0x10000000)<<2; sig <<= s; exp -= (int32_t) s;
+        s = (sig < 0x40000000)<<1; sig <<= s; exp -= (int32_t) s;
+        s = (sig < 0x80000000); sig <<= s; exp -= (int32_t) s;
+        q = sig>>dist;
+        rem = sig & ((half<<1) - 1);
+        q += (rem > half) | ((rem == half) & q);
+        uiZj = ((uint32_t) exp<<f.sigBits) + q;
+        slow |= nonzero & ((exp < 0) | ((uiZj>>f.sigBits) >= f.expMax));
+        inexact |= rem;
+        uiZ[j] = nonzero & (sign<<f.signPos | uiZj);
+    }
+    return (inexact ? fixedStatus_inexact : 0) | (slow ? fixedStatus_slow : 0);
+
+}
+
+#ifdef SOFTFLOAT_HAVE_AVX2
+
+/*----------------------------------------------------------------------------
+| Eight lanes of 'toFixedScalar'.
+*----------------------------------------------------------------------------*/
+__attribute__((target("avx2")))
+static uint_fast8_t
+ toFixedAVX2(
+     const uint32_t *uiA,
+     size_t n,
+     struct fixedFormat f,
+     int_fast8_t fracBits,
+     int32_t maxP,
+     int32_t maxN,
+     int32_t *z
+ )
+{
+    const __m128i vSigBits = _mm_cvtsi32_si128( f.sigBits );
+    const __m128i vSignPos = _mm_cvtsi32_si128( f.signPos );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32( 1 );
+    const __m256i v31 = _mm256_set1_epi32( 31 );
+    const __m256i v7 = _mm256_set1_epi32( 7 );
+    const __m256i minus7 = _mm256_set1_epi32( -7 );
+    const __m256i vExpMax = _mm256_set1_epi32( f.expMax );
+    const __m256i fracMask =
+        _mm256_set1_epi32( ((uint32_t) 1<<f.sigBits) - 1 );
+    const __m256i implicit = _mm256_set1_epi32( (uint32_t) 1<<f.sigBits );
+    const __m256i base = _mm256_set1_epi32( f.bias + f.sigBits - fracBits );
+    const __m256i vMaxP = _mm256_set1_epi32( maxP );
+    const __m256i vMaxN = _mm256_set1_epi32( maxN );
+    __m256i inexact = zero, slow = zero;
+    uint_fast8_t status;
+    size_t j;
+
+    for ( j = 0; j + 8 <= n; j += 8 ) {
+        __m256i a = _mm256_loadu_si256( (const __m256i *) &uiA[j] );
+        __m256i sign =
+            _mm256_cmpeq_epi32(
+                _mm256_and_si256( _mm256_srl_epi32( a, vSignPos ), one ),
+                one );
+        __m256i exp =
+            _mm256_and_si256( _mm256_srl_epi32( a, vSigBits ), vExpMax );
+        __m256i expZero = _mm256_cmpeq_epi32( exp, zero );
+        __m256i sig =
+            _mm256_or_si256(
+                _mm256_and_si256( a, fracMask ),
+                _mm256_andnot_si256( expZero, implicit ) );
+        __m256i shiftDist, dist, q, rem, half, up, left;
+
+        slow = _mm256_or_si256( slow, _mm256_cmpeq_epi32( exp, vExpMax ) );
+        exp = _mm256_sub_epi32( exp, expZero );
+        shiftDist = _mm256_sub_epi32( base, exp );
+        dist = _mm256_min_epi32( _mm256_max_epi32( shiftDist, one ), v31 );
+        q = _mm256_srlv_epi32( sig, dist );
+        rem =
+            _mm256_and_si256(
+                sig, _mm256_sub_epi32( _mm256_sllv_epi32( one, dist ), one ) );
+        half = _mm256_sllv_epi32( one, _mm256_sub_epi32( dist, one ) );
+        up =
+            _mm256_or_si256(
+                _mm256_cmpgt_epi32( rem, half ),
+                _mm256_and_si256(
+                    _mm256_cmpeq_epi32( rem, half ),
+                    _mm256_cmpeq_epi32( _mm256_and_si256( q, one ), one ) ) );
+        q = _mm256_sub_epi32( q, up );
+        left = _mm256_cmpgt_epi32( one, shiftDist );
+        q =
+            _mm256_blendv_epi8(
+                q,
+                _mm256_sllv_epi32(
+                    sig,
+                    _mm256_and_si256(
+                        _mm256_sub_epi32( zero, shiftDist ), v7 ) ),
+                left );
+        rem = _mm256_andnot_si256( left, rem );
+        slow =
+            _mm256_or_si256(
+                slow,
+                _mm256_or_si256(
+                    _mm256_cmpgt_epi32( minus7, shiftDist ),
+                    _mm256_cmpgt_epi32(
+                        q, _mm256_blendv_epi8( vMaxP, vMaxN, sign ) ) ) );
+        inexact = _mm256_or_si256( inexact, rem );
+        _mm256_storeu_si256(
+            (__m256i *) &z[j],
+            _mm256_sub_epi32( _mm256_xor_si256( q, sign ), sign ) );
+    }
+    status =
+        toFixedScalar( uiA + j, n - j, f, fracBits, maxP, maxN, z + j );
+    if ( ! _mm256_testz_si256( inexact, inexact ) ) {
+        status |= fixedStatus_inexact;
+    }
+    if ( ! _mm256_testz_si256( slow, slow ) ) status |= fixedStatus_slow;
+    return status;
+
+}
+
+/*----------------------------------------------------------------------------
+| Eight lanes of 'fromFixedScalar'.
+*----------------------------------------------------------------------------*/
+__attribute__((target("avx2")))
+static uint_fast8_t
+ fromFixedAVX2(
+     const int32_t *a,
+     size_t n,
+     struct fixedFormat f,
+     int_fast8_t fracBits,
+     uint32_t *uiZ
+ )
+{
+    const __m128i vSigBits = _mm_cvtsi32_si128( f.sigBits );
+    const __m128i vSignPos = _mm_cvtsi32_si128( f.signPos );
+    const __m128i vDist = _mm_cvtsi32_si128( 31 - f.sigBits );
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32( 1 );
+    const __m256i half =
+        _mm256_set1_epi32( (uint32_t) 1<<(30 - f.sigBits) );
+    const __m256i remMask =
+        _mm256_set1_epi32( ((uint32_t) 1<<(31 - f.sigBits)) - 1 );
+    const __m256i vExpMax = _mm256_set1_epi32( f.expMax );
+    const __m256i exp0 = _mm256_set1_epi32( f.bias + 30 - fracBits );
+    __m256i inexact = zero, slow = zero;
+    uint_fast8_t status;
+    size_t j;
+
+    for ( j = 0; j + 8 <= n; j += 8 ) {
+        __m256i aj = _mm256_loadu_si256( (const __m256i *) &a[j] );
+        __m256i nonzero =
+            _mm256_xor_si256(
+                _mm256_cmpeq_epi32( aj, zero ), _mm256_set1_epi32( -1 ) );
+        __m256i sig = _mm256_abs_epi32( aj );
+        __m256i exp = exp0;
+        __m256i s, q, rem, up, uiZj;
+
+#define NORMALIZE( bits, dist )                                      \
+        s =                                                          \
+            _mm256_and_si256(                                        \
+                _mm256_cmpeq_epi32(                                  \
+                    _mm256_srli_epi32( sig, bits ), zero ),          \
+                _mm256_set1_epi32( dist ) );                         \
+        sig = _mm256_sllv_epi32( sig, s );                           \
+        exp = _mm256_sub_epi32( exp, s );
+        NORMALIZE( 16, 16 )
+        NORMALIZE( 24, 8 )
+        NORMALIZE( 28, 4 )
+        NORMALIZE( 30, 2 )
+        NORMALIZE( 31, 1 )
+#undef NORMALIZE
+        q = _mm256_srl_epi32( sig, vDist );
+        rem = _mm256_and_si256( sig, remMask );
+        up =
+            _mm256_or_si256(
+                _mm256_cmpgt_epi32( rem, half ),
+                _mm256_and_si256(
+                    _mm256_cmpeq_epi32( rem, half ),
+                    _mm256_cmpeq_epi32( _mm256_and_si256( q, one ), one ) ) );
+        q = _mm256_sub_epi32( q, up );
+        uiZj = _mm256_add_epi32( _mm256_sll_epi32( exp, vSigBits ), q );
+        slow =
+            _mm256_or_si256(
+                slow,
+                _mm256_and_si256(
+                    nonzero,
+                    _mm256_or_si256(
+                        _mm256_cmpgt_epi32( zero, exp ),
+                        _mm256_cmpgt_epi32(
+                            _mm256_srl_epi32( uiZj, vSigBits ),
+                            _mm256_sub_epi32( vExpMax, one ) ) ) ) );
+        inexact = _mm256_or_si256( inexact, rem );
+        uiZj =
+            _mm256_or_si256(
+                uiZj,
+                _mm256_sll_epi32(
+                    _mm256_srli_epi32( aj, 31 ), vSignPos ) );
+        _mm256_storeu_si256(
+            (__m256i *) &uiZ[j], _mm256_and_si256( uiZj, nonzero ) );
+    }
+    status = fromFixedScalar( a + j, n - j, f, fracBits, uiZ + j );
+    if ( ! _mm256_testz_si256( inexact, inexact ) ) {
+        status |= fixedStatus_inexact;
+    }
+    if ( ! _mm256_testz_si256( slow, slow ) ) status |= fixedStatus_slow;
+    return status;
+
+}
+
+#endif
+
+typedef uint_fast8_t
+ (*toFixedFn)(
+     const uint32_t *, size_t, struct fixedFormat, int_fast8_t, int32_t,
+     int32_t, int32_t * );
+typedef uint_fast8_t
+ (*fromFixedFn)(
+     const int32_t *, size_t, struct fixedFormat, int_fast8_t, uint32_t * );
+
+static toFixedFn toFixedSelect( void )
+{
+#ifdef SOFTFLOAT_HAVE_AVX2
+    if ( __builtin_cpu_supports( "avx2" ) ) return toFixedAVX2;
+#endif
+    return toFixedScalar;
+
+}
+
+static fromFixedFn fromFixedSelect( void )
+{
+#ifdef SOFTFLOAT_HAVE_AVX2
+    if ( __builtin_cpu_supports( "avx2" ) ) return fromFixedAVX2;
+#endif
+    return fromFixedScalar;
+
+}
+
+void
+ softfloat_toFixedNearEven(
+     uint_fast8_t type,
+     int_fast8_t fracBits,
+     uint_fast8_t sigBits,
+     const void *aPtr,
+     void *zPtr,
+     size_t n
+ )
+{
+    const struct fixedFormat f = fixedFormat( sigBits );
+    const toFixedFn kernel = toFixedSelect();
+    uint32_t uiA[FIXED_CHUNK];
+    int32_t z[FIXED_CHUNK];
+    size_t i, j, m;
+    uint_fast8_t status;
+
+    for ( i = 0; i < n; i += m ) {
+        m = (n - i < FIXED_CHUNK) ? n - i : FIXED_CHUNK;
+        for ( j = 0; j < m; ++j ) {
+            uiA[j] =
+                (sigBits == 23) ? ((const float32_t *) aPtr)[i + j].v
+                    : ((const float16_t *) aPtr)[i + j].v;
+        }
+        status =
+            kernel( uiA, m, f, fracBits, maxPos[type], maxNeg[type], z );
+        if ( status & fixedStatus_slow ) {
+            for ( j = i; j < i + m; ++j ) {
+                softfloat_f64ToFixed(
+                    type,
+                    fracBits,
+                    (sigBits == 23)
+                        ? f32_to_f64( ((const float32_t *) aPtr)[j] )
+                        : f16_to_f64( ((const float16_t *) aPtr)[j] ),
+                    zPtr,
+                    j
+                );
+            }
+            continue;
+        }
+        switch ( type ) {
+         case fixed_i8:
+            for ( j = 0; j < m; ++j ) ((int8_t *) zPtr)[i + j] = z[j];
+            break;
+         case fixed_ui8:
+            for ( j = 0; j < m; ++j ) ((uint8_t *) zPtr)[i + j] = z[j];
+            break;
+         case fixed_i16:
+            for ( j = 0; j < m; ++j ) ((int16_t *) zPtr)[i + j] = z[j];
+            break;
+         default:
+            for ( j = 0; j < m; ++j ) ((int32_t *) zPtr)[i + j] = z[j];
+            break;
+        }
+        if ( status & fixedStatus_inexact ) {
+            softfloat_exceptionFlags |= softfloat_flag_inexact;
+        }
+    }
+
+}
+
+void
+ softfloat_fromFixedNearEven(
+     uint_fast8_t type,
+     int_fast8_t fracBits,
+     const void *aPtr,
+     uint_fast8_t sigBits,
+     void *zPtr,
+     size_t n
+ )
+{
+    const struct fixedFormat f = fixedFormat( sigBits );
+    const fromFixedFn kernel = fromFixedSelect();
+    int32_t a[FIXED_CHUNK];
+    uint32_t uiZ[FIXED_CHUNK];
+    size_t i, j, m;
+    uint_fast8_t status;
+
+    for ( i = 0; i < n; i += m ) {
+        m = (n - i < FIXED_CHUNK) ? n - i : FIXED_CHUNK;
+        switch ( type ) {
+         case fixed_i8:
+            for ( j = 0; j < m; ++j ) a[j] = ((const int8_t *) aPtr)[i + j];
+            break;
+         case fixed_ui8:
+            for ( j = 0; j < m; ++j ) a[j] = ((const uint8_t *) aPtr)[i + j];
+            break;
+         case fixed_i16:
+            for ( j = 0; j < m; ++j ) a[j] = ((const int16_t *) aPtr)[i + j];
+            break;
+         default:
+            for ( j = 0; j < m; ++j ) a[j] = ((const int32_t *) aPtr)[i + j];
+            break;
+        }
+        status = kernel( a, m, f, fracBits, uiZ );
+        if ( sigBits == 23 ) {
+            float32_t *z = (float32_t *) zPtr + i;
+            if ( status & fixedStatus_slow ) {
+                for ( j = 0; j < m; ++j ) {
+                    z[j] =
+                        f64_to_f32(
+                            softfloat_fixedToF64(
+                                type, fracBits, aPtr, i + j ) );
+                }
+                continue;
+            }
+            for ( j = 0; j < m; ++j ) z[j].v = uiZ[j];
+        } else {
+            float16_t *z = (float16_t *) zPtr + i;
+            if ( status & fixedStatus_slow ) {
+                for ( j = 0; j < m; ++j ) {
+                    z[j] =
+                        f64_to_f16(
+                            softfloat_fixedToF64(
+                                type, fracBits, aPtr, i + j ) );
+                }
+                continue;
+            }
+            for ( j = 0; j < m; ++j ) z[j].v = uiZ[j];
+        }
+        if ( status & fixedStatus_inexact ) {
+            softfloat_exceptionFlags |= softfloat_flag_inexact;
+        }
+    }
+
+}
+
@@ -0,0 +1,77 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+float64_t
+ softfloat_fixedToF64(
+     uint_fast8_t type, int_fast8_t fracBits, const void *aPtr, size_t i )
+{
+    int_fast32_t a;
+    union ui64_f64 uZ;
+
+    switch ( type ) {
+     case fixed_i8:
+        a = ((const int8_t *) aPtr)[i];
+        break;
+     case fixed_ui8:
+        a = ((const uint8_t *) aPtr)[i];
+        break;
+     case fixed_i16:
+        a = ((const int16_t *) aPtr)[i];
+        break;
+     default:
+        a = ((const int32_t *) aPtr)[i];
+        break;
+    }
+    /*------------------------------------------------------------------------
+    | A nonzero integer is at least 1 and below 2^31, so scaling it by
+    | 2^-'fracBits' stays well within the normal range of binary64.
+    *------------------------------------------------------------------------*/
+    uZ.f = i32_to_f64( a );
+    if ( a ) {
+        uZ.ui -=
+            (uint64_t) ((int_fast64_t) fracBits * INT64_C( 0x10000000000000 ));
+    }
+    return uZ.f;
+
+}
+
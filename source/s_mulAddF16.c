@@ -127,7 +127,7 @@ float16_t
     if ( ! expC ) {
         if ( ! sigC ) {
             expZ = expProd - 1;
-            sigZ = sigProd>>15 | ((sigProd & 0x7FFF) != 0);
+            sigZ = softfloat_shiftRightStochJam64( sigProd, 15 );
             goto roundPack;
         }
         normExpSig = softfloat_normSubnormalF16Sig( sigC );
@@ -143,14 +143,15 @@ float16_t
         *--------------------------------------------------------------------*/
         if ( expDiff <= 0 ) {
             expZ = expC;
-            sigZ = sigC + softfloat_shiftRightJam32( sigProd, 16 - expDiff );
+            sigZ =
+                sigC + softfloat_shiftRightStochJam64( sigProd, 16 - expDiff );
         } else {
             expZ = expProd;
             sig32Z =
                 sigProd
                     + softfloat_shiftRightJam32(
                           (uint_fast32_t) sigC<<16, expDiff );
-            sigZ = sig32Z>>16 | ((sig32Z & 0xFFFF) != 0 );
+            sigZ = softfloat_shiftRightStochJam64( sig32Z, 16 );
         }
         if ( sigZ < 0x4000 ) {
             --expZ;
@@ -180,9 +181,7 @@ float16_t
         expZ -= shiftDist;
         shiftDist -= 16;
         if ( shiftDist < 0 ) {
-            sigZ =
-                sig32Z>>(-shiftDist)
-                    | ((uint32_t) (sig32Z<<(shiftDist & 31)) != 0);
+            sigZ = softfloat_shiftRightStochJam64( sig32Z, -shiftDist );
         } else {
             sigZ = (uint_fast16_t) sig32Z<<shiftDist;
         }
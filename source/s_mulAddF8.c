@@ -134,7 +134,7 @@ float8_t
     if ( ! expC ) { /* denormal c */
         if ( ! sigC ) { /* c==0 */
             expZ = expProd - 1; /* adjust exponent as we pack with int bit */
-            sigZ = sigProd>>7 | ((sigProd & 0x7F) != 0); /* sticky bit */
+            sigZ = softfloat_shiftRightStochJam64( sigProd, 7 ); /* sticky */
             goto roundPack; /* we're done */
         }
         normExpSig = softfloat_normSubnormalF8Sig( sigC );
@@ -153,14 +153,15 @@ float8_t
         if ( expDiff <= 0 ) { /* Prod <= C */
             expZ = expC;
             /* shift the (smaller) product right to align, with sticky */
-            sigZ = sigC + softfloat_shiftRightJam32( sigProd, 8 - expDiff );
+            sigZ =
+                sigC + softfloat_shiftRightStochJam64( sigProd, 8 - expDiff );
         } else { /* Prod > C */
             expZ = expProd;
             sig16Z = /* sigz = prod + (C>>diff with sticky) */
                 sigProd
                     + (uint_fast16_t) softfloat_shiftRightJam32(
                           (uint_fast16_t) sigC<<8, expDiff ); 
-            sigZ = sig16Z>>8 | ((sig16Z & 0xFF) != 0 ); /* shift and sticky */
+            sigZ = softfloat_shiftRightStochJam64( sig16Z, 8 ); /* sticky */
         }
         if ( sigZ < 0x40 ) { /* normalize denormal sig */
             --expZ;
@@ -193,10 +194,8 @@ float8_t
         expZ -= shiftDist;
         shiftDist -= 8; /* we're shifted by a byte and need to go back */
         if ( shiftDist < 0 ) { /* need to care for shifted out sticky */
-            sigZ =
-                sig16Z>>(-shiftDist) /* shift by 8 - leading zeros */
-                        /* check for sticky in the shifted out bits */
-                    | ((uint16_t) (sig16Z<<(shiftDist & 15)) != 0);
+            sigZ = /* shift by 8 - leading zeros, sticky for shifted out */
+                softfloat_shiftRightStochJam64( sig16Z, -shiftDist );
         } else {
             sigZ = (uint_fast8_t) sig16Z<<shiftDist; /* just shift it left */
         }
@@ -0,0 +1,96 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast32_t
+ softfloat_mulAddPositUI(
+     uint_fast8_t n,
+     uint_fast8_t es,
+     uint_fast32_t uiA,
+     uint_fast32_t uiB,
+     uint_fast32_t uiC
+ )
+{
+    uint_fast32_t uiNaR, mask;
+    bool signA, signB, signC;
+    struct exp16_sig32 a, b, c;
+    int_fast32_t expProd;
+    uint_fast64_t sigProd;
+
+    uiNaR = softfloat_positNaRUI( n );
+    mask = softfloat_positMaskUI( n );
+    if ( (uiA == uiNaR) || (uiB == uiNaR) || (uiC == uiNaR) ) return uiNaR;
+    if ( ! uiA || ! uiB ) return uiC;
+    signA = uiA>>(n - 1);
+    signB = uiB>>(n - 1);
+    a = softfloat_unpackPositUI( n, es, signA ? -uiA & mask : uiA );
+    b = softfloat_unpackPositUI( n, es, signB ? -uiB & mask : uiB );
+    /*------------------------------------------------------------------------
+    | The product is exact (at most 56 significant bits).
+    *------------------------------------------------------------------------*/
+    expProd = (int_fast32_t) a.exp + b.exp - 60;
+    sigProd = (uint_fast64_t) a.sig * b.sig;
+    if ( ! uiC ) {
+        return
+            softfloat_normRoundPackToPositUI(
+                n, es, signA ^ signB, expProd, sigProd );
+    }
+    if ( sigProd < UINT64_C( 0x2000000000000000 ) ) {
+        sigProd <<= 1;
+        --expProd;
+    }
+    signC = uiC>>(n - 1);
+    c = softfloat_unpackPositUI( n, es, signC ? -uiC & mask : uiC );
+    return
+        softfloat_addSigsToPositUI(
+            n,
+            es,
+            signA ^ signB,
+            expProd,
+            sigProd,
+            signC,
+            c.exp - 61,
+            (uint_fast64_t) c.sig<<31
+        );
+
+}
+
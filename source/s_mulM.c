@@ -0,0 +1,203 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_mulM
+
+#define softfloat_mulM softfloat_mulM
+#include "primitives.h"
+
+/*----------------------------------------------------------------------------
+| Operands of at least this many words are split in halves (Karatsuba); the
+| schoolbook product is faster below it.
+*----------------------------------------------------------------------------*/
+#define karatsubaMinWords 24
+
+/*----------------------------------------------------------------------------
+| Adds the 'size_words'-long integer at 'aPtr' to the integer of 'total' words
+| at 'zPtr', starting at word 'dist' and carrying into the words above.
+*----------------------------------------------------------------------------*/
+static
+void
+ addShiftedM(
+     uint_fast8_t total,
+     uint32_t *zPtr,
+     uint_fast8_t dist,
+     uint_fast8_t size_words,
+     const uint32_t *aPtr
+ )
+{
+    uint_fast8_t carry, i;
+    uint32_t *ptr;
+
+    ptr = zPtr + indexMultiword( total, dist + size_words - 1, dist );
+    carry = softfloat_addCarryM( size_words, ptr, aPtr, 0, ptr );
+    for ( i = dist + size_words; carry && (i < total); ++i ) {
+        carry = ! ++zPtr[indexWord( total, i )];
+    }
+
+}
+
+/*----------------------------------------------------------------------------
+| Subtracts the 'size_words'-long integer at 'aPtr' from the integer of
+| 'total' words at 'zPtr', borrowing from the words above.
+*----------------------------------------------------------------------------*/
+static
+void
+ subM(
+     uint_fast8_t total,
+     uint32_t *zPtr,
+     uint_fast8_t size_words,
+     const uint32_t *aPtr
+ )
+{
+    uint_fast8_t borrow, i;
+    uint32_t *ptr;
+
+    ptr = zPtr + indexMultiwordLo( total, size_words );
+    borrow = ! softfloat_addComplCarryM( size_words, ptr, aPtr, 1, ptr );
+    for ( i = size_words; borrow && (i < total); ++i ) {
+        borrow = ! zPtr[indexWord( total, i )]--;
+    }
+
+}
+
+void
+ softfloat_mulM(
+     uint_fast8_t size_words,
+     const uint32_t *aPtr,
+     const uint32_t *bPtr,
+     uint32_t *zPtr
+ )
+{
+    uint_fast8_t sizeZ_words, i, j;
+    uint32_t wordA;
+    uint64_t dwordProd;
+    uint_fast8_t sizeLo_words, sizeHi_words;
+    const uint32_t *aHiPtr, *bHiPtr;
+    uint32_t sumA[32], sumB[32], mid[65];
+    uint_fast8_t carryA, carryB;
+
+    sizeZ_words = 2 * size_words;
+    if ( size_words < karatsubaMinWords ) {
+        /*--------------------------------------------------------------------
+        *--------------------------------------------------------------------*/
+        for ( i = 0; i < sizeZ_words; ++i ) zPtr[i] = 0;
+        for ( i = 0; i < size_words; ++i ) {
+            wordA = aPtr[indexWord( size_words, i )];
+            if ( ! wordA ) continue;
+            dwordProd = 0;
+            for ( j = 0; j < size_words; ++j ) {
+                dwordProd =
+                    (uint64_t) wordA * bPtr[indexWord( size_words, j )]
+                        + zPtr[indexWord( sizeZ_words, i + j )]
+                        + (dwordProd>>32);
+                zPtr[indexWord( sizeZ_words, i + j )] = dwordProd;
+            }
+            zPtr[indexWord( sizeZ_words, i + size_words )] = dwordProd>>32;
+        }
+        return;
+    }
+    /*------------------------------------------------------------------------
+    | With B = 2^(32 * sizeLo_words), A = A1 * B + A0 and likewise for the
+    | other operand: A0 * B0 goes to the low words of the product and A1 * B1
+    | to the high words, then (A0 + A1) * (B0 + B1) - A0 * B0 - A1 * B1 is
+    | added in the middle.
+    *------------------------------------------------------------------------*/
+    sizeLo_words = size_words>>1;
+    sizeHi_words = size_words - sizeLo_words;
+    aHiPtr = aPtr + indexMultiwordHi( size_words, sizeHi_words );
+    bHiPtr = bPtr + indexMultiwordHi( size_words, sizeHi_words );
+    aPtr += indexMultiwordLo( size_words, sizeLo_words );
+    bPtr += indexMultiwordLo( size_words, sizeLo_words );
+    softfloat_mulM(
+        sizeLo_words,
+        aPtr,
+        bPtr,
+        zPtr + indexMultiwordLo( sizeZ_words, 2 * sizeLo_words )
+    );
+    softfloat_mulM(
+        sizeHi_words,
+        aHiPtr,
+        bHiPtr,
+        zPtr + indexMultiwordHi( sizeZ_words, 2 * sizeHi_words )
+    );
+    for ( i = 0; i < sizeHi_words; ++i ) {
+        sumA[indexWord( sizeHi_words, i )] =
+            (i < sizeLo_words) ? aPtr[indexWord( sizeLo_words, i )] : 0;
+        sumB[indexWord( sizeHi_words, i )] =
+            (i < sizeLo_words) ? bPtr[indexWord( sizeLo_words, i )] : 0;
+    }
+    carryA = softfloat_addCarryM( sizeHi_words, sumA, aHiPtr, 0, sumA );
+    carryB = softfloat_addCarryM( sizeHi_words, sumB, bHiPtr, 0, sumB );
+    softfloat_mulM(
+        sizeHi_words,
+        sumA,
+        sumB,
+        mid + indexMultiwordLo( 2 * sizeHi_words + 1, 2 * sizeHi_words )
+    );
+    mid[indexWordHi( 2 * sizeHi_words + 1 )] = carryA & carryB;
+    if ( carryA ) {
+        addShiftedM(
+            2 * sizeHi_words + 1, mid, sizeHi_words, sizeHi_words, sumB );
+    }
+    if ( carryB ) {
+        addShiftedM(
+            2 * sizeHi_words + 1, mid, sizeHi_words, sizeHi_words, sumA );
+    }
+    subM(
+        2 * sizeHi_words + 1,
+        mid,
+        2 * sizeLo_words,
+        zPtr + indexMultiwordLo( sizeZ_words, 2 * sizeLo_words )
+    );
+    subM(
+        2 * sizeHi_words + 1,
+        mid,
+        2 * sizeHi_words,
+        zPtr + indexMultiwordHi( sizeZ_words, 2 * sizeHi_words )
+    );
+    addShiftedM(
+        sizeZ_words, zPtr, sizeLo_words, 2 * sizeHi_words + 1, mid );
+
+}
+
+#endif
+
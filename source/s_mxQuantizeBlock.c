@@ -0,0 +1,118 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+/*----------------------------------------------------------------------------
+| Exponent of the largest normal element of each format.
+*----------------------------------------------------------------------------*/
+static const int_fast8_t expMaxElement[] = { 15, 8, 4, 2, 2, 0 };
+
+void
+ softfloat_mxQuantizeBlock(
+     uint_fast8_t fmt, const uint32_t *aPtr, size_t count, uint8_t *zPtr )
+{
+    uint_fast32_t max, mag, bits;
+    size_t i;
+    int_fast16_t exp, scaleExp;
+    uint8_t elements[MX_BLOCK_SIZE];
+    union ui32_f32 uA;
+    union ui64_f64 uT;
+
+    max = 0;
+    for ( i = 0; i < count; ++i ) {
+        mag = aPtr[i] & 0x7FFFFFFF;
+        if ( max < mag ) max = mag;
+    }
+    for ( i = 0; i < MX_BLOCK_SIZE; ++i ) elements[i] = 0;
+    /*------------------------------------------------------------------------
+    | The shared scale is floor(log2(max)) minus the largest element exponent,
+    | so that the largest magnitude lands in the top binade of the elements.
+    *------------------------------------------------------------------------*/
+    if ( 0x7F800000 <= max ) {
+        *zPtr = mx_scaleNaN;
+    } else {
+        scaleExp = -0x7F;
+        if ( max ) {
+            exp = expF32UI( max );
+            exp = exp ? exp - 0x7F : -0x76 - softfloat_countLeadingZeros32( max );
+            scaleExp = exp - expMaxElement[fmt];
+            if ( scaleExp < -0x7F ) scaleExp = -0x7F;
+        }
+        *zPtr = scaleExp + 0x7F;
+        for ( i = 0; i < count; ++i ) {
+            uA.ui = aPtr[i];
+            uT.f = f32_to_f64( uA.f );
+            if ( uT.ui & UINT64_C( 0x7FFFFFFFFFFFFFFF ) ) {
+                uT.ui -= (uint64_t) ((int_fast64_t) scaleExp * INT64_C( 0x10000000000000 ));
+            }
+            elements[i] = softfloat_f64ToMXUI( fmt, uT.f );
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    ++zPtr;
+    switch ( fmt ) {
+     case mx_e3m2:
+     case mx_e2m3:
+        for ( i = 0; i < MX_BLOCK_SIZE; i += 4 ) {
+            bits =
+                elements[i] | (uint_fast32_t) elements[i + 1]<<6
+                    | (uint_fast32_t) elements[i + 2]<<12
+                    | (uint_fast32_t) elements[i + 3]<<18;
+            zPtr[0] = bits;
+            zPtr[1] = bits>>8;
+            zPtr[2] = bits>>16;
+            zPtr += 3;
+        }
+        break;
+     case mx_e2m1:
+        for ( i = 0; i < MX_BLOCK_SIZE; i += 2 ) {
+            *zPtr++ = elements[i] | elements[i + 1]<<4;
+        }
+        break;
+     default:
+        for ( i = 0; i < MX_BLOCK_SIZE; ++i ) zPtr[i] = elements[i];
+        break;
+    }
+
+}
+
@@ -0,0 +1,69 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast32_t softfloat_mxToF32UI( uint_fast8_t fmt, uint_fast8_t uiA )
+{
+    union ui8_f8 uA;
+
+    switch ( fmt ) {
+     case mx_e5m2:
+        uA.ui = uiA;
+        return f8_to_f32( uA.f ).v;
+     case mx_e4m3:
+        return softfloat_e4m3ToF32UI[uiA];
+     case mx_e3m2:
+        return softfloat_e3m2ToF32UI[uiA & 0x3F];
+     case mx_e2m3:
+        return softfloat_e2m3ToF32UI[uiA & 0x3F];
+     case mx_e2m1:
+        return softfloat_e2m1ToF32UI[uiA & 0x0F];
+     default:
+        if ( ! uiA ) return 0;
+        /*--------------------------------------------------------------------
+        | INT8 elements are the integer times 2^-6 (never subnormal).
+        *--------------------------------------------------------------------*/
+        return i32_to_f32( (int8_t) uiA ).v - ((uint_fast32_t) 6<<23);
+    }
+
+}
+
@@ -0,0 +1,82 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ softfloat_mxUnpackBlock( uint_fast8_t fmt, const uint8_t *aPtr, uint32_t *zPtr )
+{
+    uint_fast8_t scale;
+    uint_fast32_t bits;
+    size_t i;
+
+    scale = *aPtr++;
+    switch ( fmt ) {
+     case mx_e3m2:
+     case mx_e2m3:
+        for ( i = 0; i < MX_BLOCK_SIZE; i += 4 ) {
+            bits =
+                aPtr[0] | (uint_fast32_t) aPtr[1]<<8
+                    | (uint_fast32_t) aPtr[2]<<16;
+            zPtr[i]     = softfloat_mxToF32UI( fmt, bits & 0x3F );
+            zPtr[i + 1] = softfloat_mxToF32UI( fmt, (bits>>6) & 0x3F );
+            zPtr[i + 2] = softfloat_mxToF32UI( fmt, (bits>>12) & 0x3F );
+            zPtr[i + 3] = softfloat_mxToF32UI( fmt, bits>>18 );
+            aPtr += 3;
+        }
+        break;
+     case mx_e2m1:
+        for ( i = 0; i < MX_BLOCK_SIZE; i += 2 ) {
+            zPtr[i]     = softfloat_mxToF32UI( fmt, *aPtr & 0x0F );
+            zPtr[i + 1] = softfloat_mxToF32UI( fmt, *aPtr>>4 );
+            ++aPtr;
+        }
+        break;
+     default:
+        for ( i = 0; i < MX_BLOCK_SIZE; ++i ) {
+            zPtr[i] = softfloat_mxToF32UI( fmt, aPtr[i] );
+        }
+        break;
+    }
+    return scale;
+
+}
+
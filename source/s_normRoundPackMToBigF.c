@@ -0,0 +1,201 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void
+ softfloat_normRoundPackMToBigF(
+     bool sign,
+     int32_t exp,
+     uint_fast8_t size_words,
+     uint32_t *sigPtr,
+     bigFloat_t *zPtr
+ )
+{
+    uint_fast8_t sizeZ_words, i;
+    uint32_t shiftDist, wordSig;
+    int32_t cut;
+    uint_fast8_t roundingMode;
+    uint32_t index, mask, *ptr;
+    bool roundBit, sticky, lsb, doIncrement;
+
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    zPtr->sign = sign;
+    shiftDist = 0;
+    wordSig = 0;
+    for ( i = size_words; i--; ) {
+        wordSig = sigPtr[indexWord( size_words, i )];
+        if ( wordSig ) break;
+        shiftDist += 32;
+    }
+    if ( shiftDist == (uint32_t) size_words * 32 ) {
+        zPtr->cls = bigF_zero;
+        return;
+    }
+    shiftDist += softfloat_countLeadingZeros32( wordSig );
+    if ( shiftDist ) {
+        softfloat_shiftLeftM( size_words, sigPtr, shiftDist, sigPtr );
+        exp -= shiftDist;
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    roundingMode = softfloat_roundingMode;
+    cut = (int32_t) size_words * 32 - zPtr->prec;
+    if ( 0 < cut ) {
+        index = (cut - 1)>>5;
+        mask = (uint32_t) 1<<((cut - 1) & 31);
+        ptr = &sigPtr[indexWord( size_words, index )];
+        roundBit = *ptr & mask;
+        sticky = *ptr & (mask - 1);
+        *ptr &= ~(mask | (mask - 1));
+        for ( i = 0; i < index; ++i ) {
+            sticky |= (sigPtr[indexWord( size_words, i )] != 0);
+            sigPtr[indexWord( size_words, i )] = 0;
+        }
+        if ( roundBit || sticky ) {
+            softfloat_exceptionFlags |= softfloat_flag_inexact;
+            index = cut>>5;
+            mask = (uint32_t) 1<<(cut & 31);
+            lsb = sigPtr[indexWord( size_words, index )] & mask;
+            doIncrement = false;
+            switch ( roundingMode ) {
+             case softfloat_round_near_even:
+                doIncrement = roundBit && (sticky || lsb);
+                break;
+             case softfloat_round_near_maxMag:
+                doIncrement = roundBit;
+                break;
+             case softfloat_round_min:
+                doIncrement = sign;
+                break;
+             case softfloat_round_max:
+                doIncrement = ! sign;
+                break;
+#ifdef SOFTFLOAT_ROUND_ODD
+             case softfloat_round_odd:
+                sigPtr[indexWord( size_words, index )] |= mask;
+                break;
+#endif
+            }
+            if ( doIncrement ) {
+                for ( i = index; i < size_words; ++i ) {
+                    ptr = &sigPtr[indexWord( size_words, i )];
+                    *ptr += mask;
+                    if ( *ptr ) break;
+                    mask = 1;
+                }
+                if ( i == size_words ) {
+                    sigPtr[indexWordHi( size_words )] = 0x80000000;
+                    ++exp;
+                }
+            }
+        }
+    }
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+    zPtr->cls = bigF_normal;
+    sizeZ_words = BIGF_WORDS( zPtr->prec );
+    if ( BIGF_EXP_MAX < exp ) {
+        softfloat_raiseFlags(
+            softfloat_flag_overflow | softfloat_flag_inexact );
+        if (
+            (roundingMode == softfloat_round_near_even)
+                || (roundingMode == softfloat_round_near_maxMag)
+                || (roundingMode
+                        == (sign ? softfloat_round_min : softfloat_round_max))
+        ) {
+            zPtr->cls = bigF_inf;
+            return;
+        }
+        exp = BIGF_EXP_MAX;
+        for ( i = 0; i < sizeZ_words; ++i ) {
+            zPtr->sig[i] = 0xFFFFFFFF;
+        }
+        zPtr->sig[indexWordLo( sizeZ_words )] =
+            0xFFFFFFFF<<(sizeZ_words * 32 - zPtr->prec);
+    } else if ( exp < BIGF_EXP_MIN ) {
+        /*--------------------------------------------------------------------
+        | No subnormals: a tiny result becomes zero or the smallest normal
+        | number, whichever the rounding direction selects.
+        *--------------------------------------------------------------------*/
+        softfloat_raiseFlags(
+            softfloat_flag_underflow | softfloat_flag_inexact );
+        doIncrement =
+            (roundingMode
+                 == (sign ? softfloat_round_min : softfloat_round_max));
+#ifdef SOFTFLOAT_ROUND_ODD
+        doIncrement |= (roundingMode == softfloat_round_odd);
+#endif
+        if (
+            (exp == BIGF_EXP_MIN - 1)
+                && ((roundingMode == softfloat_round_near_even)
+                        || (roundingMode == softfloat_round_near_maxMag))
+        ) {
+            doIncrement = (roundingMode == softfloat_round_near_maxMag);
+            for ( i = 0; i < size_words; ++i ) {
+                if (
+                    sigPtr[indexWord( size_words, i )]
+                        != ((i == size_words - 1) ? 0x80000000 : 0)
+                ) {
+                    doIncrement = true;
+                }
+            }
+        }
+        if ( ! doIncrement ) {
+            zPtr->cls = bigF_zero;
+            return;
+        }
+        exp = BIGF_EXP_MIN;
+        for ( i = 0; i < sizeZ_words; ++i ) zPtr->sig[i] = 0;
+        zPtr->sig[indexWordHi( sizeZ_words )] = 0x80000000;
+    } else {
+        for ( i = 0; i < sizeZ_words; ++i ) {
+            zPtr->sig[indexWord( sizeZ_words, sizeZ_words - 1 - i )] =
+                (i < size_words)
+                    ? sigPtr[indexWord( size_words, size_words - 1 - i )]
+                    : 0;
+        }
+    }
+    zPtr->exp = exp;
+
+}
+
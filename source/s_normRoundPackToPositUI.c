@@ -0,0 +1,108 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast32_t
+ softfloat_normRoundPackToPositUI(
+     uint_fast8_t n,
+     uint_fast8_t es,
+     bool sign,
+     int_fast32_t exp,
+     uint_fast64_t sig
+ )
+{
+    int_fast8_t shiftDist;
+    int_fast32_t scale, maxScale, k;
+    uint_fast8_t regimeLen;
+    uint64_t word, tail;
+    uint_fast32_t uiZ;
+
+    /*------------------------------------------------------------------------
+    | The value is 'sig' * 2^'exp', with 'sig' nonzero; its lowest bit may be
+    | a sticky bit.
+    *------------------------------------------------------------------------*/
+    shiftDist = softfloat_countLeadingZeros64( sig );
+    sig <<= shiftDist;
+    scale = exp + 63 - shiftDist;
+    maxScale = (int_fast32_t) (n - 2)<<es;
+    if ( maxScale <= scale ) {
+        uiZ = softfloat_positNaRUI( n ) - 1;
+        goto uiZ;
+    }
+    if ( scale < -maxScale ) {
+        uiZ = 1;
+        goto uiZ;
+    }
+    /*------------------------------------------------------------------------
+    | Builds the encoding after the sign bit with unbounded precision (the
+    | regime, 'es' exponent bits and the fraction), then rounds it to nearest
+    | even at n - 1 bits.  The regime always ends within those bits, so the
+    | result can be neither zero nor NaR.
+    *------------------------------------------------------------------------*/
+    k = (0 <= scale) ? scale>>es : -((-scale + ((1<<es) - 1))>>es);
+    if ( 0 <= k ) {
+        regimeLen = k + 2;
+        word = ~(UINT64_C( 0xFFFFFFFFFFFFFFFF )>>(k + 1));
+    } else {
+        regimeLen = 1 - k;
+        word = (uint64_t) 1<<(64 - regimeLen);
+    }
+    tail = sig<<1;
+    if ( es ) {
+        tail =
+            (uint64_t) (scale - k * (1<<es))<<(64 - es)
+                | softfloat_shiftRightJam64( tail, es );
+    }
+    word |= softfloat_shiftRightJam64( tail, regimeLen );
+    uiZ = word>>(65 - n);
+    if (
+        (word>>(64 - n) & 1)
+            && ((uiZ & 1) || (word & (((uint64_t) 1<<(64 - n)) - 1)))
+    ) {
+        ++uiZ;
+    }
+ uiZ:
+    if ( sign ) uiZ = -uiZ & softfloat_positMaskUI( n );
+    return uiZ;
+
+}
+
@@ -0,0 +1,105 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+e4m3_t
+ softfloat_opToE4M3(
+     uint_fast8_t op, uint_fast8_t uiA, uint_fast8_t uiB, uint_fast8_t uiC )
+{
+    union ui32_f32 uA, uB, uC, uZ;
+    uint_fast8_t roundingMode, exceptionFlags, flags;
+    union ui8_e4m3 uZ8;
+
+    /*------------------------------------------------------------------------
+    | As for bfloat16: the operands widen exactly to binary32, the binary32
+    | operation is rounded to odd, and the result is rounded once to E4M3.
+    | Binary32 cannot overflow here; an infinite result comes from a
+    | division by zero.
+    *------------------------------------------------------------------------*/
+    uA.ui = softfloat_e4m3ToF32UI[uiA];
+    uB.ui = softfloat_e4m3ToF32UI[uiB];
+    uC.ui = softfloat_e4m3ToF32UI[uiC];
+    roundingMode = softfloat_roundingMode;
+    exceptionFlags = softfloat_exceptionFlags;
+    softfloat_roundingMode = softfloat_round_minMag;
+ compute:
+    softfloat_exceptionFlags = 0;
+    switch ( op ) {
+     case softfloat_opE4M3_add:
+        uZ.f = f32_add( uA.f, uB.f );
+        break;
+     case softfloat_opE4M3_sub:
+        uZ.f = f32_sub( uA.f, uB.f );
+        break;
+     case softfloat_opE4M3_mul:
+        uZ.f = f32_mul( uA.f, uB.f );
+        break;
+     case softfloat_opE4M3_div:
+        uZ.f = f32_div( uA.f, uB.f );
+        break;
+     case softfloat_opE4M3_mulAdd:
+        uZ.f = f32_mulAdd( uA.f, uB.f, uC.f );
+        break;
+     default:
+        uZ.f = f32_sqrt( uA.f );
+        break;
+    }
+    flags = softfloat_exceptionFlags;
+    if ( flags & softfloat_flag_inexact ) {
+        uZ.ui |= 1;
+    } else if (
+        ! (uZ.ui & 0x7FFFFFFF) && (softfloat_roundingMode != roundingMode)
+    ) {
+        softfloat_roundingMode = roundingMode;
+        goto compute;
+    }
+    softfloat_roundingMode = roundingMode;
+    softfloat_exceptionFlags =
+        exceptionFlags
+            | (flags & (softfloat_flag_invalid | softfloat_flag_infinite));
+    if ( (uZ.ui & 0x7FFFFFFF) == 0x7F800000 ) {
+        uZ8.ui = softfloat_infToE4M3UI( signF32UI( uZ.ui ) );
+        return uZ8.f;
+    }
+    return f32_to_e4m3( uZ.f );
+
+}
+
@@ -0,0 +1,116 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast8_t
+ softfloat_opToMXUI(
+     uint_fast8_t fmt,
+     uint_fast8_t op,
+     uint_fast8_t uiA,
+     uint_fast8_t uiB,
+     uint_fast8_t uiC
+ )
+{
+    uint_fast8_t signMask, savedFlags, roundingMode;
+    union ui32_f32 uT;
+    float64_t a, b, c, z;
+    bool signA, signB;
+
+    signMask = (fmt == mx_e2m1) ? 0x08 : 0x20;
+    signA = uiA & signMask;
+    signB = uiB & signMask;
+    /*------------------------------------------------------------------------
+    | There are no infinities or NaNs: division by zero saturates and the
+    | invalid operations (0/0, square root of a negative) return +0.
+    *------------------------------------------------------------------------*/
+    if ( (op == softfloat_opMX_div) && ! (uiB & (signMask - 1)) ) {
+        if ( ! (uiA & (signMask - 1)) ) goto invalid;
+        softfloat_raiseFlags( softfloat_flag_infinite );
+        return (signA != signB ? signMask : 0) | (signMask - 1);
+    }
+    if ( (op == softfloat_opMX_sqrt) && signA && (uiA & (signMask - 1)) ) {
+        goto invalid;
+    }
+    /*------------------------------------------------------------------------
+    | Operands are exact in binary64.  Sums and products are exact as well;
+    | quotients and square roots are rounded to odd, which leaves enough
+    | bits for the single rounding to the element format.
+    *------------------------------------------------------------------------*/
+    uT.ui = softfloat_mxToF32UI( fmt, uiA );
+    a = f32_to_f64( uT.f );
+    uT.ui = softfloat_mxToF32UI( fmt, uiB );
+    b = f32_to_f64( uT.f );
+    uT.ui = softfloat_mxToF32UI( fmt, uiC );
+    c = f32_to_f64( uT.f );
+    savedFlags = softfloat_exceptionFlags;
+    switch ( op ) {
+     case softfloat_opMX_add:
+        z = f64_add( a, b );
+        break;
+     case softfloat_opMX_sub:
+        z = f64_sub( a, b );
+        break;
+     case softfloat_opMX_mul:
+        z = f64_mul( a, b );
+        break;
+     case softfloat_opMX_mulAdd:
+        z = f64_mulAdd( a, b, c );
+        break;
+     default:
+        roundingMode = softfloat_roundingMode;
+        softfloat_roundingMode = softfloat_round_minMag;
+        softfloat_exceptionFlags = 0;
+        z = (op == softfloat_opMX_div) ? f64_div( a, b ) : f64_sqrt( a );
+        if ( softfloat_exceptionFlags & softfloat_flag_inexact ) z.v |= 1;
+        softfloat_roundingMode = roundingMode;
+        break;
+    }
+    softfloat_exceptionFlags = savedFlags;
+    return softfloat_f64ToMXUI( fmt, z );
+    /*------------------------------------------------------------------------
+    *------------------------------------------------------------------------*/
+ invalid:
+    softfloat_raiseFlags( softfloat_flag_invalid );
+    return 0;
+
+}
+
@@ -0,0 +1,107 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+float32_t
+ softfloat_opToTF32(
+     uint_fast8_t op, uint_fast32_t uiA, uint_fast32_t uiB, uint_fast32_t uiC )
+{
+    union ui32_f32 uA, uB, uC, uZ;
+    uint_fast8_t roundingMode, exceptionFlags, flags;
+
+    /*------------------------------------------------------------------------
+    | The binary32 operation is rounded to odd: toward zero, then the last bit
+    | is set if the result is inexact.  Binary32 has 13 more bits than TF32,
+    | so rounding that value to TF32 gives the correctly rounded result in
+    | every rounding mode, with the flags of a single rounding.  A binary32
+    | overflow is kept: the value is then beyond TF32's range too.
+    *------------------------------------------------------------------------*/
+    uA.ui = uiA;
+    uB.ui = uiB;
+    uC.ui = uiC;
+    roundingMode = softfloat_roundingMode;
+    exceptionFlags = softfloat_exceptionFlags;
+    softfloat_roundingMode = softfloat_round_minMag;
+ compute:
+    softfloat_exceptionFlags = 0;
+    switch ( op ) {
+     case softfloat_opTF32_add:
+        uZ.f = f32_add( uA.f, uB.f );
+        break;
+     case softfloat_opTF32_sub:
+        uZ.f = f32_sub( uA.f, uB.f );
+        break;
+     case softfloat_opTF32_mul:
+        uZ.f = f32_mul( uA.f, uB.f );
+        break;
+     case softfloat_opTF32_mulAdd:
+        uZ.f = f32_mulAdd( uA.f, uB.f, uC.f );
+        break;
+     case softfloat_opTF32_div:
+        uZ.f = f32_div( uA.f, uB.f );
+        break;
+     default:
+        uZ.f = f32_sqrt( uA.f );
+        break;
+    }
+    flags = softfloat_exceptionFlags;
+    if ( flags & softfloat_flag_inexact ) {
+        uZ.ui |= 1;
+    } else if (
+        ! (uZ.ui & 0x7FFFFFFF) && (softfloat_roundingMode != roundingMode)
+    ) {
+        /*--------------------------------------------------------------------
+        | The sign of an exact zero sum depends on the rounding mode.
+        *--------------------------------------------------------------------*/
+        softfloat_roundingMode = roundingMode;
+        goto compute;
+    }
+    softfloat_roundingMode = roundingMode;
+    softfloat_exceptionFlags =
+        exceptionFlags
+            | (flags
+                   & (softfloat_flag_invalid | softfloat_flag_infinite
+                          | softfloat_flag_overflow));
+    return f32_roundToTF32( uZ.f );
+
+}
+
@@ -0,0 +1,112 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+void
+ softfloat_quireFdp(
+     uint_fast8_t n,
+     uint_fast8_t es,
+     uint64_t *qPtr,
+     uint_fast8_t words,
+     uint_fast32_t uiA,
+     uint_fast32_t uiB,
+     bool subtract
+ )
+{
+    uint_fast32_t uiNaR, mask;
+    uint_fast8_t i;
+    bool signA, signB;
+    struct exp16_sig32 a, b;
+    int_fast32_t pos;
+    uint64_t sig, lo, hi, word, carry;
+
+    uiNaR = softfloat_positNaRUI( n );
+    mask = softfloat_positMaskUI( n );
+    if ( qPtr[words - 1] == UINT64_C( 0x8000000000000000 ) ) {
+        for ( i = 0; i < words - 1; ++i ) {
+            if ( qPtr[i] ) break;
+        }
+        if ( i == words - 1 ) return;
+    }
+    if ( (uiA == uiNaR) || (uiB == uiNaR) ) {
+        for ( i = 0; i < words - 1; ++i ) qPtr[i] = 0;
+        qPtr[words - 1] = UINT64_C( 0x8000000000000000 );
+        return;
+    }
+    if ( ! uiA || ! uiB ) return;
+    signA = uiA>>(n - 1);
+    signB = uiB>>(n - 1);
+    a = softfloat_unpackPositUI( n, es, signA ? -uiA & mask : uiA );
+    b = softfloat_unpackPositUI( n, es, signB ? -uiB & mask : uiB );
+    /*------------------------------------------------------------------------
+    | Every posit is a multiple of minpos, so the exact product is a multiple
+    | of minpos^2, the weight of the last quire bit: when its last bit falls
+    | below the quire, the bits shifted out are zero.
+    *------------------------------------------------------------------------*/
+    sig = (uint64_t) a.sig * b.sig;
+    pos = (int_fast32_t) a.exp + b.exp - 60 + ((int_fast32_t) 2 * (n - 2)<<es);
+    if ( pos < 0 ) {
+        sig >>= -pos;
+        pos = 0;
+    }
+    i = pos>>6;
+    lo = sig<<(pos & 63);
+    hi = (pos & 63) ? sig>>(64 - (pos & 63)) : 0;
+    subtract ^= signA ^ signB;
+    carry = 0;
+    for ( ; i < words; ++i ) {
+        word = qPtr[i];
+        if ( subtract ) {
+            qPtr[i] = word - lo - carry;
+            carry = (word < lo) || (word - lo < carry);
+        } else {
+            word += lo;
+            qPtr[i] = word + carry;
+            carry = (word < lo) || (word + carry < carry);
+        }
+        lo = hi;
+        hi = 0;
+        if ( ! lo && ! carry ) break;
+    }
+
+}
+
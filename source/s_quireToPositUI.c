@@ -0,0 +1,88 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast32_t
+ softfloat_quireToPositUI(
+     uint_fast8_t n,
+     uint_fast8_t es,
+     const uint64_t *qPtr,
+     uint_fast8_t words
+ )
+{
+    uint64_t mag[8];
+    bool sign;
+    uint_fast8_t i, carry;
+    int_fast8_t top;
+    uint_fast8_t shiftDist;
+    uint64_t sig;
+    int_fast32_t exp;
+
+    sign = qPtr[words - 1]>>63;
+    carry = 1;
+    for ( i = 0; i < words; ++i ) {
+        mag[i] = sign ? ~qPtr[i] + carry : qPtr[i];
+        carry = carry && ! mag[i];
+    }
+    top = words - 1;
+    while ( (0 <= top) && ! mag[top] ) --top;
+    if ( top < 0 ) return 0;
+    /*------------------------------------------------------------------------
+    | Only NaR is its own negation among the nonzero quires.
+    *------------------------------------------------------------------------*/
+    if ( sign && (mag[words - 1]>>63) ) return softfloat_positNaRUI( n );
+    shiftDist = softfloat_countLeadingZeros64( mag[top] );
+    sig = mag[top]<<shiftDist;
+    if ( top ) {
+        if ( shiftDist ) sig |= mag[top - 1]>>(64 - shiftDist);
+        if ( mag[top - 1]<<shiftDist ) sig |= 1;
+        for ( i = 0; i < top - 1; ++i ) {
+            if ( mag[i] ) sig |= 1;
+        }
+    }
+    exp =
+        (int_fast32_t) 64 * top - shiftDist
+            - ((int_fast32_t) 2 * (n - 2)<<es);
+    return softfloat_normRoundPackToPositUI( n, es, sign, exp, sig );
+
+}
+
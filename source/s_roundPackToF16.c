@@ -61,6 +61,9 @@ float16_t
                  == (sign ? softfloat_round_min : softfloat_round_max))
                 ? 0xF
                 : 0;
+        if ( roundingMode == softfloat_round_stochastic ) {
+            roundIncrement = softfloat_stochasticBits() & 0xF;
+        }
     }
     roundBits = sig & 0xF;
     /*------------------------------------------------------------------------
@@ -72,7 +75,7 @@ float16_t
             isTiny =
                 (softfloat_detectTininess == softfloat_tininess_beforeRounding)
                     || (exp < -1) || (sig + roundIncrement < 0x8000);
-            sig = softfloat_shiftRightJam32( sig, -exp );
+            sig = softfloat_shiftRightStochJam64( sig, -exp );
             exp = 0;
             roundBits = sig & 0xF;
             if ( isTiny && roundBits ) {
@@ -83,7 +86,10 @@ float16_t
             *----------------------------------------------------------------*/
             softfloat_raiseFlags(
                 softfloat_flag_overflow | softfloat_flag_inexact );
-            uiZ = packToF16UI( sign, 0x1F, 0 ) - ! roundIncrement;
+            uiZ =
+                packToF16UI( sign, 0x1F, 0 )
+                    - (! roundIncrement
+                           && (roundingMode != softfloat_round_stochastic));
             goto uiZ;
         }
     }
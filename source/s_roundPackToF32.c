@@ -61,6 +61,9 @@ float32_t
                  == (sign ? softfloat_round_min : softfloat_round_max))
                 ? 0x7F
                 : 0;
+        if ( roundingMode == softfloat_round_stochastic ) {
+            roundIncrement = softfloat_stochasticBits() & 0x7F;
+        }
     }
     roundBits = sig & 0x7F;
     /*------------------------------------------------------------------------
@@ -72,7 +75,7 @@ float32_t
             isTiny =
                 (softfloat_detectTininess == softfloat_tininess_beforeRounding)
                     || (exp < -1) || (sig + roundIncrement < 0x80000000);
-            sig = softfloat_shiftRightJam32( sig, -exp );
+            sig = softfloat_shiftRightStochJam64( sig, -exp );
             exp = 0;
             roundBits = sig & 0x7F;
             if ( isTiny && roundBits ) {
@@ -83,7 +86,10 @@ float32_t
             *----------------------------------------------------------------*/
             softfloat_raiseFlags(
                 softfloat_flag_overflow | softfloat_flag_inexact );
-            uiZ = packToF32UI( sign, 0xFF, 0 ) - ! roundIncrement;
+            uiZ =
+                packToF32UI( sign, 0xFF, 0 )
+                    - (! roundIncrement
+                           && (roundingMode != softfloat_round_stochastic));
             goto uiZ;
         }
     }
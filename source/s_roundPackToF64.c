@@ -61,6 +61,9 @@ float64_t
                  == (sign ? softfloat_round_min : softfloat_round_max))
                 ? 0x3FF
                 : 0;
+        if ( roundingMode == softfloat_round_stochastic ) {
+            roundIncrement = softfloat_stochasticBits() & 0x3FF;
+        }
     }
     roundBits = sig & 0x3FF;
     /*------------------------------------------------------------------------
@@ -73,7 +76,7 @@ float64_t
                 (softfloat_detectTininess == softfloat_tininess_beforeRounding)
                     || (exp < -1)
                     || (sig + roundIncrement < UINT64_C( 0x8000000000000000 ));
-            sig = softfloat_shiftRightJam64( sig, -exp );
+            sig = softfloat_shiftRightStochJam64( sig, -exp );
             exp = 0;
             roundBits = sig & 0x3FF;
             if ( isTiny && roundBits ) {
@@ -87,7 +90,10 @@ float64_t
             *----------------------------------------------------------------*/
             softfloat_raiseFlags(
                 softfloat_flag_overflow | softfloat_flag_inexact );
-            uiZ = packToF64UI( sign, 0x7FF, 0 ) - ! roundIncrement;
+            uiZ =
+                packToF64UI( sign, 0x7FF, 0 )
+                    - (! roundIncrement
+                           && (roundingMode != softfloat_round_stochastic));
             goto uiZ;
         }
     }
@@ -65,6 +65,9 @@ float8_t
                  == (sign ? softfloat_round_min : softfloat_round_max))
                 ? 0xF /* if rounding towards same sign infinity */
                 : 0; /* rounding increment otherwise */
+        if ( roundingMode == softfloat_round_stochastic ) {
+            roundIncrement = softfloat_stochasticBits() & 0xF;
+        }
     }
     roundBits = sig & 0xF; /* 4 round bits */
     /*------------------------------------------------------------------------
@@ -78,7 +81,7 @@ float8_t
             isTiny = /* all the tininess conditions (before round) */
                 (softfloat_detectTininess == softfloat_tininess_beforeRounding)
                     || (exp < -1) || (sig + roundIncrement < 0x80);
-            sig = softfloat_shiftRightJam32( sig, -exp ); /* shift to exp=0 */
+            sig = softfloat_shiftRightStochJam64( sig, -exp ); /* to exp=0 */
             exp = 0;
             roundBits = sig & 0xF; /* get new round bits */
             if ( isTiny && roundBits ) {
@@ -90,7 +93,10 @@ float8_t
             *----------------------------------------------------------------*/
             softfloat_raiseFlags(
                 softfloat_flag_overflow | softfloat_flag_inexact );
-            uiZ = packToF8UI( sign, 0x1F, 0 ) - ! roundIncrement; /* round */
+            uiZ = /* round */
+                packToF8UI( sign, 0x1F, 0 )
+                    - (! roundIncrement
+                           && (roundingMode != softfloat_round_stochastic));
             goto uiZ;
         }
     }
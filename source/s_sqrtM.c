@@ -0,0 +1,136 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "primitiveTypes.h"
+
+#ifndef softfloat_sqrtM
+
+#define softfloat_sqrtM softfloat_sqrtM
+#include "primitives.h"
+
+bool
+ softfloat_sqrtM(
+     uint_fast8_t size_words, const uint32_t *aPtr, uint32_t *zPtr )
+{
+    uint_fast8_t sizeA_words, i;
+    uint64_t sig64, rem64, root64;
+    uint32_t rem[129], q[65], sum[65];
+    bool done, inexact;
+
+    sizeA_words = 2 * size_words;
+    /*------------------------------------------------------------------------
+    | Starting point: one more than the square root of the top 64 bits, which
+    | is at least the root sought (or all ones, which is too).
+    *------------------------------------------------------------------------*/
+    sig64 =
+        (uint64_t) aPtr[indexWordHi( sizeA_words )]<<32
+            | aPtr[indexWord( sizeA_words, sizeA_words - 2 )];
+    rem64 = 0;
+    root64 = 0;
+    for ( i = 0; i < 32; ++i ) {
+        rem64 = rem64<<2 | sig64>>62;
+        sig64 <<= 2;
+        root64 <<= 1;
+        if ( (root64<<1 | 1) <= rem64 ) {
+            rem64 -= root64<<1 | 1;
+            root64 |= 1;
+        }
+    }
+    for ( i = 0; i < size_words; ++i ) zPtr[i] = 0xFFFFFFFF;
+    if ( root64 < 0xFFFFFFFF ) {
+        for ( i = 0; i < size_words - 1; ++i ) {
+            zPtr[indexWord( size_words, i )] = 0;
+        }
+        zPtr[indexWordHi( size_words )] = root64 + 1;
+    }
+    /*------------------------------------------------------------------------
+    | Newton's iteration Z' = (Z + A / Z) / 2 in integers decreases until it
+    | reaches the truncated root.
+    *------------------------------------------------------------------------*/
+    for (;;) {
+        for ( i = 0; i < sizeA_words; ++i ) {
+            rem[indexWord( sizeA_words + 1, i )] =
+                aPtr[indexWord( sizeA_words, i )];
+        }
+        rem[indexWordHi( sizeA_words + 1 )] = 0;
+        softfloat_divRemM( sizeA_words + 1, rem, size_words, zPtr, q );
+        for ( i = 0; i < size_words; ++i ) {
+            sum[indexWord( size_words + 1, i )] =
+                zPtr[indexWord( size_words, i )];
+        }
+        sum[indexWordHi( size_words + 1 )] = 0;
+        softfloat_addM( size_words + 1, sum, q, sum );
+        softfloat_shortShiftRightM( size_words + 1, sum, 1, sum );
+        done = true;
+        if ( ! sum[indexWordHi( size_words + 1 )] ) {
+            for ( i = size_words; i--; ) {
+                if (
+                    sum[indexWord( size_words + 1, i )]
+                        != zPtr[indexWord( size_words, i )]
+                ) {
+                    done =
+                        (sum[indexWord( size_words + 1, i )]
+                             > zPtr[indexWord( size_words, i )]);
+                    break;
+                }
+            }
+        }
+        if ( done ) break;
+        for ( i = 0; i < size_words; ++i ) {
+            zPtr[indexWord( size_words, i )] =
+                sum[indexWord( size_words + 1, i )];
+        }
+    }
+    /*------------------------------------------------------------------------
+    | A - Z^2 = (Q - Z) * Z + R, where Q >= Z here.
+    *------------------------------------------------------------------------*/
+    inexact = (q[indexWordHi( size_words + 1 )] != 0);
+    for ( i = 0; i < size_words; ++i ) {
+        inexact |=
+            (q[indexWord( size_words + 1, i )]
+                 != zPtr[indexWord( size_words, i )])
+                | (rem[indexWord( sizeA_words + 1, i )] != 0);
+    }
+    return inexact;
+
+}
+
+#endif
+
@@ -0,0 +1,80 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+uint_fast32_t
+ softfloat_sqrtPositUI( uint_fast8_t n, uint_fast8_t es, uint_fast32_t uiA )
+{
+    uint_fast32_t uiNaR;
+    struct exp16_sig32 a;
+    bool oddExp;
+    uint_fast64_t rem;
+    uint_fast32_t bit, root;
+    uint_fast64_t trial;
+
+    uiNaR = softfloat_positNaRUI( n );
+    if ( uiA & uiNaR ) return uiNaR;
+    if ( ! uiA ) return 0;
+    a = softfloat_unpackPositUI( n, es, uiA );
+    /*------------------------------------------------------------------------
+    | The significand is widened to 63 or 64 bits so that the exponent of its
+    | last bit is even; its integer square root has 32 bits.
+    *------------------------------------------------------------------------*/
+    oddExp = a.exp & 1;
+    rem = (uint_fast64_t) a.sig<<(32 + oddExp);
+    root = 0;
+    for ( bit = 0x80000000; bit; bit >>= 1 ) {
+        trial = (uint_fast64_t) (root | bit) * (root | bit);
+        if ( trial <= rem ) root |= bit;
+    }
+    rem -= (uint_fast64_t) root * root;
+    return
+        softfloat_normRoundPackToPositUI(
+            n,
+            es,
+            0,
+            ((int_fast32_t) a.exp - 62 - oddExp) / 2 - 1,
+            (uint_fast64_t) root<<1 | (rem != 0)
+        );
+
+}
+
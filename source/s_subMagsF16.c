@@ -140,7 +140,7 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
         expZ -= shiftDist;
         sigZ = sig32Z>>16;
         if ( sig32Z & 0xFFFF ) {
-            sigZ |= 1;
+            sigZ = softfloat_shiftRightStochJam64( sig32Z, 16 );
         } else {
             if ( ! (sigZ & 0xF) && ((unsigned int) expZ < 0x1E) ) {
                 sigZ >>= 4;
@@ -158,6 +158,24 @@ float16_t softfloat_subMagsF16( uint_fast16_t uiA, uint_fast16_t uiB )
     *------------------------------------------------------------------------*/
  subEpsilon:
     roundingMode = softfloat_roundingMode;
+    if ( roundingMode == softfloat_round_stochastic ) {
+        /*--------------------------------------------------------------------
+        | Round toward zero with a probability equal to the smaller operand
+        | over the ulp below the larger one, which is halved when the larger
+        | one is a power of 2.
+        *--------------------------------------------------------------------*/
+        if ( expDiff < 0 ) {
+            expDiff = -expDiff;
+            expB = expA;
+            sigB = sigA;
+        }
+        roundingMode =
+            (softfloat_stochasticBits()
+                 < (uint_fast64_t) (sigB + (expB ? 0x0400 : sigB))
+                       <<(64 - expDiff + ! fracF16UI( uiZ )))
+                ? softfloat_round_minMag
+                : softfloat_round_near_maxMag;
+    }
     if ( roundingMode != softfloat_round_near_even ) {
         if (
             (roundingMode == softfloat_round_minMag)
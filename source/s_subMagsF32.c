@@ -128,7 +128,9 @@ float32_t softfloat_subMagsF32( uint_fast32_t uiA, uint_fast32_t uiB )
         }
         return
             softfloat_normRoundPackToF32(
-                signZ, expZ, sigX - softfloat_shiftRightJam32( sigY, expDiff )
+                signZ,
+                expZ,
+                sigX - softfloat_shiftRightStochJam64( sigY, expDiff )
             );
     }
     /*------------------------------------------------------------------------
@@ -109,7 +109,7 @@ float64_t
                 goto uiZ;
             }
             sigA += expA ? UINT64_C( 0x4000000000000000 ) : sigA;
-            sigA = softfloat_shiftRightJam64( sigA, -expDiff );
+            sigA = softfloat_shiftRightStochJam64( sigA, -expDiff );
             sigB |= UINT64_C( 0x4000000000000000 );
             expZ = expB;
             sigZ = sigB - sigA;
@@ -122,7 +122,7 @@ float64_t
                 goto uiZ;
             }
             sigB += expB ? UINT64_C( 0x4000000000000000 ) : sigB;
-            sigB = softfloat_shiftRightJam64( sigB, expDiff );
+            sigB = softfloat_shiftRightStochJam64( sigB, expDiff );
             sigA |= UINT64_C( 0x4000000000000000 );
             expZ = expA;
             sigZ = sigA - sigB;
@@ -148,7 +148,7 @@ float8_t softfloat_subMagsF8( uint_fast8_t uiA, uint_fast8_t uiB )
         expZ -= shiftDist; /* take the exp back down */
         sigZ = sig16Z>>8; /* put back into the lower byte with 4 round bits*/
         if ( sig16Z & 0xFF ) { /* if we truncated (lost) bits */
-            sigZ |= 1; /* set sticky */
+            sigZ = softfloat_shiftRightStochJam64( sig16Z, 8 ); /* sticky */
         } else { /* only round bits to care about */
             /* if we don't have round bits and no overflow */
             if ( ! (sigZ & 0xF) && ((unsigned int) expZ < 0x1E) ) {
@@ -167,6 +167,21 @@ float8_t softfloat_subMagsF8( uint_fast8_t uiA, uint_fast8_t uiB )
     *------------------------------------------------------------------------*/
  subEpsilon: /* sub something to the round bits to signify inexact op */
     roundingMode = softfloat_roundingMode;
+    if ( roundingMode == softfloat_round_stochastic ) {
+        /* round down with probability (smaller op) / (ulp below larger op),
+           that ulp being halved when the larger op is a power of 2 */
+        if ( expDiff < 0 ) { /* smaller op is A */
+            expDiff = -expDiff;
+            expB = expA;
+            sigB = sigA;
+        }
+        roundingMode = /* decide the direction here, then round directed */
+            (softfloat_stochasticBits()
+                 < (uint_fast64_t) (sigB + (expB ? 0x04 : sigB))
+                       <<(64 - expDiff + ! fracF8UI( uiZ )))
+                ? softfloat_round_minMag
+                : softfloat_round_near_maxMag;
+    }
     if ( roundingMode != softfloat_round_near_even ) {
         if ( /* all the modes that round Z towards zero */
             (roundingMode == softfloat_round_minMag)
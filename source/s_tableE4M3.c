@@ -0,0 +1,129 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef __ATOMIC_ACQUIRE
+#define softfloat_loadTable( p ) __atomic_load_n( (p), __ATOMIC_ACQUIRE )
+#define softfloat_publishTable( p, table ) \
+    __atomic_compare_exchange_n( \
+        (p), &(const uint16_t *) { 0 }, (table), false, \
+        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+#else
+#define softfloat_loadTable( p ) (*(p))
+#define softfloat_publishTable( p, table ) (*(p) = (table), true)
+#endif
+
+static const uint16_t *softfloat_tablesE4M3[2][softfloat_opE4M3_tables];
+
+/*----------------------------------------------------------------------------
+| Computes entry 'index' of table 'op' in the current modes.
+*----------------------------------------------------------------------------*/
+static uint_fast8_t softfloat_computeE4M3UI( uint_fast8_t op, uint_fast16_t index )
+{
+    union ui16_f16 uA16;
+    union ui16_bf16 uABF16;
+    union ui8_e4m3 uZ;
+
+    switch ( op ) {
+     case softfloat_opE4M3_fromF16:
+        uA16.ui = index;
+        uZ.f = f32_to_e4m3( f16_to_f32( uA16.f ) );
+        break;
+     case softfloat_opE4M3_fromBF16:
+        uABF16.ui = index;
+        uZ.f = f32_to_e4m3( bf16_to_f32( uABF16.f ) );
+        break;
+     default:
+        uZ.f = softfloat_opToE4M3( op, index>>8, index & 0xFF, 0 );
+        break;
+    }
+    return uZ.ui;
+
+}
+
+/*----------------------------------------------------------------------------
+| Each entry holds the round-to-nearest-even result with saturation in its
+| low byte, the exception flags in the next five bits, and bit 15 set when
+| the result without saturation is NaN instead (see softfloat_entryToE4M3UI).
+| The tables are built on first use, one set per tininess mode.
+*----------------------------------------------------------------------------*/
+const uint16_t *softfloat_tableE4M3( uint_fast8_t op )
+{
+    const uint16_t **tablePtr;
+    const uint16_t *table;
+    uint16_t *entries;
+    uint_fast8_t roundingMode, exceptionFlags, overflowMode;
+    uint_fast32_t index;
+    uint_fast8_t uiSat, uiNaN;
+
+    tablePtr =
+        &softfloat_tablesE4M3
+            [softfloat_detectTininess == softfloat_tininess_afterRounding][op];
+    table = softfloat_loadTable( tablePtr );
+    if ( table ) return table;
+    entries = (uint16_t *) malloc( 0x10000 * sizeof (uint16_t) );
+    if ( ! entries ) return 0;
+    roundingMode = softfloat_roundingMode;
+    exceptionFlags = softfloat_exceptionFlags;
+    overflowMode = e4m3_overflowMode;
+    softfloat_roundingMode = softfloat_round_near_even;
+    for ( index = 0; index < 0x10000; ++index ) {
+        e4m3_overflowMode = e4m3_overflow_nan;
+        uiNaN = softfloat_computeE4M3UI( op, index );
+        e4m3_overflowMode = e4m3_overflow_saturate;
+        softfloat_exceptionFlags = 0;
+        uiSat = softfloat_computeE4M3UI( op, index );
+        entries[index] =
+            uiSat | (uint_fast16_t) softfloat_exceptionFlags<<8
+                | (uint_fast16_t) (uiNaN != uiSat)<<15;
+    }
+    softfloat_roundingMode = roundingMode;
+    softfloat_exceptionFlags = exceptionFlags;
+    e4m3_overflowMode = overflowMode;
+    if ( ! softfloat_publishTable( tablePtr, entries ) ) {
+        free( entries );
+        entries = (uint16_t *) softfloat_loadTable( tablePtr );
+    }
+    return entries;
+
+}
+
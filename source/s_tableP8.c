@@ -0,0 +1,101 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+#ifdef __ATOMIC_ACQUIRE
+#define softfloat_loadTable( p ) __atomic_load_n( (p), __ATOMIC_ACQUIRE )
+#define softfloat_publishTable( p, table ) \
+    __atomic_compare_exchange_n( \
+        (p), &(const uint8_t *) { 0 }, (table), false, \
+        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )
+#else
+#define softfloat_loadTable( p ) (*(p))
+#define softfloat_publishTable( p, table ) (*(p) = (table), true)
+#endif
+
+static const uint8_t *softfloat_tablesP8[softfloat_opP8_sqrt + 1];
+
+/*----------------------------------------------------------------------------
+| Posits have a single rounding rule and no flags, so one table per operation
+| serves every mode.  The tables are built on first use.
+*----------------------------------------------------------------------------*/
+const uint8_t *softfloat_tableP8( uint_fast8_t op )
+{
+    const uint8_t **tablePtr;
+    const uint8_t *table;
+    uint8_t *entries;
+    uint_fast32_t size, index;
+
+    tablePtr = &softfloat_tablesP8[op];
+    table = softfloat_loadTable( tablePtr );
+    if ( table ) return table;
+    size = (op == softfloat_opP8_sqrt) ? 0x100 : 0x10000;
+    entries = (uint8_t *) malloc( size );
+    if ( ! entries ) return 0;
+    for ( index = 0; index < size; ++index ) {
+        switch ( op ) {
+         case softfloat_opP8_add:
+            entries[index] =
+                softfloat_addPositUI( 8, 0, index>>8, index & 0xFF );
+            break;
+         case softfloat_opP8_mul:
+            entries[index] =
+                softfloat_mulPositUI( 8, 0, index>>8, index & 0xFF );
+            break;
+         case softfloat_opP8_div:
+            entries[index] =
+                softfloat_divPositUI( 8, 0, index>>8, index & 0xFF );
+            break;
+         default:
+            entries[index] = softfloat_sqrtPositUI( 8, 0, index );
+            break;
+        }
+    }
+    if ( ! softfloat_publishTable( tablePtr, entries ) ) {
+        free( entries );
+        entries = (uint8_t *) softfloat_loadTable( tablePtr );
+    }
+    return entries;
+
+}
+
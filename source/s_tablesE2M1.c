@@ -0,0 +1,206 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Results of the FP4 E2M1 operations in round-to-nearest-even, for every pair of
+| encodings: binary operations are indexed by (a<<4 | b), square root by a.
+| Each entry holds the result encoding in bits 0-7 and the exception flags in
+| bits 8-12; bit 13 marks an underflow that is only signaled when tininess is
+| detected before rounding (see softfloat_entryToMXUI).
+*----------------------------------------------------------------------------*/
+const uint16_t softfloat_addE2M1[256] = {
+    /* a = 0x00 */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0000, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    /* a = 0x01 */
+    0x0001, 0x0002, 0x0003, 0x0004, 0x0104, 0x0106, 0x0106, 0x0107,
+    0x0001, 0x0000, 0x0009, 0x000A, 0x000B, 0x010C, 0x010E, 0x010F,
+    /* a = 0x02 */
+    0x0002, 0x0003, 0x0004, 0x0104, 0x0005, 0x0006, 0x0106, 0x0507,
+    0x0002, 0x0001, 0x0000, 0x0009, 0x000A, 0x000C, 0x000D, 0x010E,
+    /* a = 0x03 */
+    0x0003, 0x0004, 0x0104, 0x0005, 0x0106, 0x0106, 0x0107, 0x0507,
+    0x0003, 0x0002, 0x0001, 0x0000, 0x0009, 0x000B, 0x010C, 0x010E,
+    /* a = 0x04 */
+    0x0004, 0x0104, 0x0005, 0x0106, 0x0006, 0x0106, 0x0007, 0x0507,
+    0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x000A, 0x000C, 0x000E,
+    /* a = 0x05 */
+    0x0005, 0x0106, 0x0006, 0x0106, 0x0106, 0x0007, 0x0507, 0x0507,
+    0x0005, 0x0104, 0x0004, 0x0003, 0x0002, 0x0000, 0x000A, 0x000D,
+    /* a = 0x06 */
+    0x0006, 0x0106, 0x0106, 0x0107, 0x0007, 0x0507, 0x0507, 0x0507,
+    0x0006, 0x0106, 0x0005, 0x0104, 0x0004, 0x0002, 0x0000, 0x000C,
+    /* a = 0x07 */
+    0x0007, 0x0107, 0x0507, 0x0507, 0x0507, 0x0507, 0x0507, 0x0507,
+    0x0007, 0x0107, 0x0106, 0x0106, 0x0006, 0x0005, 0x0004, 0x0000,
+    /* a = 0x08 */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    /* a = 0x09 */
+    0x0009, 0x0000, 0x0001, 0x0002, 0x0003, 0x0104, 0x0106, 0x0107,
+    0x0009, 0x000A, 0x000B, 0x000C, 0x010C, 0x010E, 0x010E, 0x010F,
+    /* a = 0x0A */
+    0x000A, 0x0009, 0x0000, 0x0001, 0x0002, 0x0004, 0x0005, 0x0106,
+    0x000A, 0x000B, 0x000C, 0x010C, 0x000D, 0x000E, 0x010E, 0x050F,
+    /* a = 0x0B */
+    0x000B, 0x000A, 0x0009, 0x0000, 0x0001, 0x0003, 0x0104, 0x0106,
+    0x000B, 0x000C, 0x010C, 0x000D, 0x010E, 0x010E, 0x010F, 0x050F,
+    /* a = 0x0C */
+    0x000C, 0x000B, 0x000A, 0x0009, 0x0000, 0x0002, 0x0004, 0x0006,
+    0x000C, 0x010C, 0x000D, 0x010E, 0x000E, 0x010E, 0x000F, 0x050F,
+    /* a = 0x0D */
+    0x000D, 0x010C, 0x000C, 0x000B, 0x000A, 0x0000, 0x0002, 0x0005,
+    0x000D, 0x010E, 0x000E, 0x010E, 0x010E, 0x000F, 0x050F, 0x050F,
+    /* a = 0x0E */
+    0x000E, 0x010E, 0x000D, 0x010C, 0x000C, 0x000A, 0x0000, 0x0004,
+    0x000E, 0x010E, 0x010E, 0x010F, 0x000F, 0x050F, 0x050F, 0x050F,
+    /* a = 0x0F */
+    0x000F, 0x010F, 0x010E, 0x010E, 0x000E, 0x000D, 0x000C, 0x0000,
+    0x000F, 0x010F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F
+};
+
+const uint16_t softfloat_mulE2M1[256] = {
+    /* a = 0x00 */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    /* a = 0x01 */
+    0x0000, 0x0300, 0x0001, 0x0302, 0x0002, 0x0003, 0x0004, 0x0005,
+    0x0008, 0x0308, 0x0009, 0x030A, 0x000A, 0x000B, 0x000C, 0x000D,
+    /* a = 0x02 */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    /* a = 0x03 */
+    0x0000, 0x0302, 0x0003, 0x0104, 0x0005, 0x0106, 0x0007, 0x0507,
+    0x0008, 0x030A, 0x000B, 0x010C, 0x000D, 0x010E, 0x000F, 0x050F,
+    /* a = 0x04 */
+    0x0000, 0x0002, 0x0004, 0x0005, 0x0006, 0x0007, 0x0507, 0x0507,
+    0x0008, 0x000A, 0x000C, 0x000D, 0x000E, 0x000F, 0x050F, 0x050F,
+    /* a = 0x05 */
+    0x0000, 0x0003, 0x0005, 0x0106, 0x0007, 0x0507, 0x0507, 0x0507,
+    0x0008, 0x000B, 0x000D, 0x010E, 0x000F, 0x050F, 0x050F, 0x050F,
+    /* a = 0x06 */
+    0x0000, 0x0004, 0x0006, 0x0007, 0x0507, 0x0507, 0x0507, 0x0507,
+    0x0008, 0x000C, 0x000E, 0x000F, 0x050F, 0x050F, 0x050F, 0x050F,
+    /* a = 0x07 */
+    0x0000, 0x0005, 0x0007, 0x0507, 0x0507, 0x0507, 0x0507, 0x0507,
+    0x0008, 0x000D, 0x000F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F,
+    /* a = 0x08 */
+    0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /* a = 0x09 */
+    0x0008, 0x0308, 0x0009, 0x030A, 0x000A, 0x000B, 0x000C, 0x000D,
+    0x0000, 0x0300, 0x0001, 0x0302, 0x0002, 0x0003, 0x0004, 0x0005,
+    /* a = 0x0A */
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    /* a = 0x0B */
+    0x0008, 0x030A, 0x000B, 0x010C, 0x000D, 0x010E, 0x000F, 0x050F,
+    0x0000, 0x0302, 0x0003, 0x0104, 0x0005, 0x0106, 0x0007, 0x0507,
+    /* a = 0x0C */
+    0x0008, 0x000A, 0x000C, 0x000D, 0x000E, 0x000F, 0x050F, 0x050F,
+    0x0000, 0x0002, 0x0004, 0x0005, 0x0006, 0x0007, 0x0507, 0x0507,
+    /* a = 0x0D */
+    0x0008, 0x000B, 0x000D, 0x010E, 0x000F, 0x050F, 0x050F, 0x050F,
+    0x0000, 0x0003, 0x0005, 0x0106, 0x0007, 0x0507, 0x0507, 0x0507,
+    /* a = 0x0E */
+    0x0008, 0x000C, 0x000E, 0x000F, 0x050F, 0x050F, 0x050F, 0x050F,
+    0x0000, 0x0004, 0x0006, 0x0007, 0x0507, 0x0507, 0x0507, 0x0507,
+    /* a = 0x0F */
+    0x0008, 0x000D, 0x000F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F,
+    0x0000, 0x0005, 0x0007, 0x0507, 0x0507, 0x0507, 0x0507, 0x0507
+};
+
+const uint16_t softfloat_divE2M1[256] = {
+    /* a = 0x00 */
+    0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1000, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    /* a = 0x01 */
+    0x0807, 0x0002, 0x0001, 0x0301, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x080F, 0x000A, 0x0009, 0x0309, 0x0308, 0x0308, 0x0308, 0x0308,
+    /* a = 0x02 */
+    0x0807, 0x0004, 0x0002, 0x0301, 0x0001, 0x0301, 0x0300, 0x0300,
+    0x080F, 0x000C, 0x000A, 0x0309, 0x0009, 0x0309, 0x0308, 0x0308,
+    /* a = 0x03 */
+    0x0807, 0x0005, 0x0003, 0x0002, 0x0302, 0x0001, 0x0301, 0x0300,
+    0x080F, 0x000D, 0x000B, 0x000A, 0x030A, 0x0009, 0x0309, 0x0308,
+    /* a = 0x04 */
+    0x0807, 0x0006, 0x0004, 0x0103, 0x0002, 0x0301, 0x0001, 0x0301,
+    0x080F, 0x000E, 0x000C, 0x010B, 0x000A, 0x0309, 0x0009, 0x0309,
+    /* a = 0x05 */
+    0x0807, 0x0007, 0x0005, 0x0004, 0x0003, 0x0002, 0x0302, 0x0001,
+    0x080F, 0x000F, 0x000D, 0x000C, 0x000B, 0x000A, 0x030A, 0x0009,
+    /* a = 0x06 */
+    0x0807, 0x0507, 0x0006, 0x0105, 0x0004, 0x0103, 0x0002, 0x0301,
+    0x080F, 0x050F, 0x000E, 0x010D, 0x000C, 0x010B, 0x000A, 0x0309,
+    /* a = 0x07 */
+    0x0807, 0x0507, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002,
+    0x080F, 0x050F, 0x000F, 0x000E, 0x000D, 0x000C, 0x000B, 0x000A,
+    /* a = 0x08 */
+    0x1000, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
+    0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /* a = 0x09 */
+    0x080F, 0x000A, 0x0009, 0x0309, 0x0308, 0x0308, 0x0308, 0x0308,
+    0x0807, 0x0002, 0x0001, 0x0301, 0x0300, 0x0300, 0x0300, 0x0300,
+    /* a = 0x0A */
+    0x080F, 0x000C, 0x000A, 0x0309, 0x0009, 0x0309, 0x0308, 0x0308,
+    0x0807, 0x0004, 0x0002, 0x0301, 0x0001, 0x0301, 0x0300, 0x0300,
+    /* a = 0x0B */
+    0x080F, 0x000D, 0x000B, 0x000A, 0x030A, 0x0009, 0x0309, 0x0308,
+    0x0807, 0x0005, 0x0003, 0x0002, 0x0302, 0x0001, 0x0301, 0x0300,
+    /* a = 0x0C */
+    0x080F, 0x000E, 0x000C, 0x010B, 0x000A, 0x0309, 0x0009, 0x0309,
+    0x0807, 0x0006, 0x0004, 0x0103, 0x0002, 0x0301, 0x0001, 0x0301,
+    /* a = 0x0D */
+    0x080F, 0x000F, 0x000D, 0x000C, 0x000B, 0x000A, 0x030A, 0x0009,
+    0x0807, 0x0007, 0x0005, 0x0004, 0x0003, 0x0002, 0x0302, 0x0001,
+    /* a = 0x0E */
+    0x080F, 0x050F, 0x000E, 0x010D, 0x000C, 0x010B, 0x000A, 0x0309,
+    0x0807, 0x0507, 0x0006, 0x0105, 0x0004, 0x0103, 0x0002, 0x0301,
+    /* a = 0x0F */
+    0x080F, 0x050F, 0x000F, 0x000E, 0x000D, 0x000C, 0x000B, 0x000A,
+    0x0807, 0x0507, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002
+};
+
+const uint16_t softfloat_sqrtE2M1[16] = {
+    0x0000, 0x0301, 0x0002, 0x0102, 0x0103, 0x0103, 0x0004, 0x0104,
+    0x0008, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000
+};
+
@@ -0,0 +1,1796 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+
+/*----------------------------------------------------------------------------
+| Results of the FP6 E2M3 operations in round-to-nearest-even, for every pair of
+| encodings: binary operations are indexed by (a<<6 | b), square root by a.
+| Each entry holds the result encoding in bits 0-7 and the exception flags in
+| bits 8-12; bit 13 marks an underflow that is only signaled when tininess is
+| detected before rounding (see softfloat_entryToMXUI).
+*----------------------------------------------------------------------------*/
+const uint16_t softfloat_addE2M3[4096] = {
+    /* a = 0x00 */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    /* a = 0x01 */
+    0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008,
+    0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010,
+    0x0110, 0x0112, 0x0112, 0x0114, 0x0114, 0x0116, 0x0116, 0x0118,
+    0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F,
+    0x0001, 0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026,
+    0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E,
+    0x002F, 0x0130, 0x0132, 0x0132, 0x0134, 0x0134, 0x0136, 0x0136,
+    0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F,
+    /* a = 0x02 */
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009,
+    0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0110,
+    0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018,
+    0x0118, 0x011A, 0x011A, 0x011C, 0x011C, 0x011E, 0x011E, 0x051F,
+    0x0002, 0x0001, 0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+    0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D,
+    0x002E, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+    0x0037, 0x0138, 0x013A, 0x013A, 0x013C, 0x013C, 0x013E, 0x013E,
+    /* a = 0x03 */
+    0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A,
+    0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0110, 0x0011,
+    0x0112, 0x0112, 0x0114, 0x0114, 0x0116, 0x0116, 0x0118, 0x0118,
+    0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x051F,
+    0x0003, 0x0002, 0x0001, 0x0000, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C,
+    0x002D, 0x002F, 0x0130, 0x0132, 0x0132, 0x0134, 0x0134, 0x0136,
+    0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+    /* a = 0x04 */
+    0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+    0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0110, 0x0011, 0x0112,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0118,
+    0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x051F,
+    0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x0021, 0x0022, 0x0023,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+    0x002C, 0x002E, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035,
+    0x0036, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E,
+    /* a = 0x05 */
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C,
+    0x000D, 0x000E, 0x000F, 0x0010, 0x0110, 0x0011, 0x0112, 0x0012,
+    0x0112, 0x0114, 0x0114, 0x0116, 0x0116, 0x0118, 0x0118, 0x0119,
+    0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x051F,
+    0x0005, 0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x0021, 0x0022,
+    0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A,
+    0x002B, 0x002D, 0x002F, 0x0130, 0x0132, 0x0132, 0x0134, 0x0134,
+    0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+    /* a = 0x06 */
+    0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D,
+    0x000E, 0x000F, 0x0010, 0x0110, 0x0011, 0x0112, 0x0012, 0x0112,
+    0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0118, 0x0019,
+    0x011A, 0x011A, 0x011C, 0x011C, 0x011E, 0x011E, 0x051F, 0x051F,
+    0x0006, 0x0005, 0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
+    0x002A, 0x002C, 0x002E, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0037, 0x0138, 0x013A, 0x013A, 0x013C, 0x013C, 0x013E,
+    /* a = 0x07 */
+    0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E,
+    0x000F, 0x0010, 0x0110, 0x0011, 0x0112, 0x0012, 0x0112, 0x0013,
+    0x0114, 0x0114, 0x0116, 0x0116, 0x0118, 0x0118, 0x0119, 0x0119,
+    0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002, 0x0001, 0x0000,
+    0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028,
+    0x0029, 0x002B, 0x002D, 0x002F, 0x0130, 0x0132, 0x0132, 0x0134,
+    0x0134, 0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D,
+    /* a = 0x08 */
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0110, 0x0011, 0x0112, 0x0012, 0x0112, 0x0013, 0x0114,
+    0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0118, 0x0019, 0x011A,
+    0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x051F, 0x051F,
+    0x0008, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002, 0x0001,
+    0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x002A, 0x002C, 0x002E, 0x0030, 0x0031, 0x0032, 0x0033,
+    0x0034, 0x0036, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D,
+    /* a = 0x09 */
+    0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010,
+    0x0110, 0x0011, 0x0112, 0x0012, 0x0112, 0x0013, 0x0114, 0x0014,
+    0x0114, 0x0116, 0x0116, 0x0118, 0x0118, 0x0119, 0x0119, 0x011A,
+    0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x0009, 0x0008, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002,
+    0x0001, 0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026,
+    0x0027, 0x0029, 0x002B, 0x002D, 0x002F, 0x0130, 0x0132, 0x0132,
+    0x0134, 0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D,
+    /* a = 0x0A */
+    0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0110,
+    0x0011, 0x0112, 0x0012, 0x0112, 0x0013, 0x0114, 0x0014, 0x0114,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0118, 0x0019, 0x011A, 0x001A,
+    0x011A, 0x011C, 0x011C, 0x011E, 0x011E, 0x051F, 0x051F, 0x051F,
+    0x000A, 0x0009, 0x0008, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003,
+    0x0002, 0x0001, 0x0000, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+    0x0026, 0x0028, 0x002A, 0x002C, 0x002E, 0x0030, 0x0031, 0x0032,
+    0x0033, 0x0035, 0x0037, 0x0138, 0x013A, 0x013A, 0x013C, 0x013C,
+    /* a = 0x0B */
+    0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0110, 0x0011,
+    0x0112, 0x0012, 0x0112, 0x0013, 0x0114, 0x0014, 0x0114, 0x0015,
+    0x0116, 0x0116, 0x0118, 0x0118, 0x0119, 0x0119, 0x011A, 0x011A,
+    0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F,
+    0x000B, 0x000A, 0x0009, 0x0008, 0x0007, 0x0006, 0x0005, 0x0004,
+    0x0003, 0x0002, 0x0001, 0x0000, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0027, 0x0029, 0x002B, 0x002D, 0x002F, 0x0130, 0x0132,
+    0x0132, 0x0134, 0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C,
+    /* a = 0x0C */
+    0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0110, 0x0011, 0x0112,
+    0x0012, 0x0112, 0x0013, 0x0114, 0x0014, 0x0114, 0x0015, 0x0116,
+    0x0016, 0x0017, 0x0018, 0x0118, 0x0019, 0x011A, 0x001A, 0x011A,
+    0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x000C, 0x000B, 0x000A, 0x0009, 0x0008, 0x0007, 0x0006, 0x0005,
+    0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x0021, 0x0022, 0x0023,
+    0x0024, 0x0026, 0x0028, 0x002A, 0x002C, 0x002E, 0x0030, 0x0031,
+    0x0032, 0x0034, 0x0036, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C,
+    /* a = 0x0D */
+    0x000D, 0x000E, 0x000F, 0x0010, 0x0110, 0x0011, 0x0112, 0x0012,
+    0x0112, 0x0013, 0x0114, 0x0014, 0x0114, 0x0015, 0x0116, 0x0016,
+    0x0116, 0x0118, 0x0118, 0x0119, 0x0119, 0x011A, 0x011A, 0x011B,
+    0x011B, 0x011C, 0x011D, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F,
+    0x000D, 0x000C, 0x000B, 0x000A, 0x0009, 0x0008, 0x0007, 0x0006,
+    0x0005, 0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x0021, 0x0022,
+    0x0023, 0x0025, 0x0027, 0x0029, 0x002B, 0x002D, 0x002F, 0x0130,
+    0x0132, 0x0134, 0x0136, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C,
+    /* a = 0x0E */
+    0x000E, 0x000F, 0x0010, 0x0110, 0x0011, 0x0112, 0x0012, 0x0112,
+    0x0013, 0x0114, 0x0014, 0x0114, 0x0015, 0x0116, 0x0016, 0x0116,
+    0x0017, 0x0018, 0x0118, 0x0019, 0x011A, 0x001A, 0x011A, 0x001B,
+    0x011C, 0x011C, 0x011E, 0x011E, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x000E, 0x000D, 0x000C, 0x000B, 0x000A, 0x0009, 0x0008, 0x0007,
+    0x0006, 0x0005, 0x0004, 0x0003, 0x0002, 0x0001, 0x0000, 0x0021,
+    0x0022, 0x0024, 0x0026, 0x0028, 0x002A, 0x002C, 0x002E, 0x0030,
+    0x0031, 0x0033, 0x0035, 0x0037, 0x0138, 0x013A, 0x013A, 0x013C,
+    /* a = 0x0F */
+    0x000F, 0x0010, 0x0110, 0x0011, 0x0112, 0x0012, 0x0112, 0x0013,
+    0x0114, 0x0014, 0x0114, 0x0015, 0x0116, 0x0016, 0x0116, 0x0017,
+    0x0118, 0x0118, 0x0119, 0x0119, 0x011A, 0x011A, 0x011B, 0x011B,
+    0x011C, 0x011D, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x000F, 0x000E, 0x000D, 0x000C, 0x000B, 0x000A, 0x0009, 0x0008,
+    0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002, 0x0001, 0x0000,
+    0x0021, 0x0023, 0x0025, 0x0027, 0x0029, 0x002B, 0x002D, 0x002F,
+    0x0130, 0x0132, 0x0134, 0x0136, 0x0138, 0x0139, 0x013A, 0x013B,
+    /* a = 0x10 */
+    0x0010, 0x0110, 0x0011, 0x0112, 0x0012, 0x0112, 0x0013, 0x0114,
+    0x0014, 0x0114, 0x0015, 0x0116, 0x0016, 0x0116, 0x0017, 0x0118,
+    0x0018, 0x0118, 0x0019, 0x011A, 0x001A, 0x011A, 0x001B, 0x011C,
+    0x001C, 0x001D, 0x001E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0010, 0x000F, 0x000E, 0x000D, 0x000C, 0x000B, 0x000A, 0x0009,
+    0x0008, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003, 0x0002, 0x0001,
+    0x0000, 0x0022, 0x0024, 0x0026, 0x0028, 0x002A, 0x002C, 0x002E,
+    0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x0039, 0x003A, 0x003B,
+    /* a = 0x11 */
+    0x0011, 0x0112, 0x0012, 0x0112, 0x0013, 0x0114, 0x0014, 0x0114,
+    0x0015, 0x0116, 0x0016, 0x0116, 0x0017, 0x0118, 0x0018, 0x0118,
+    0x0118, 0x0019, 0x011A, 0x001A, 0x011A, 0x001B, 0x011C, 0x001C,
+    0x011C, 0x011E, 0x011E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0011, 0x0110, 0x0010, 0x000F, 0x000E, 0x000D, 0x000C, 0x000B,
+    0x000A, 0x0009, 0x0008, 0x0007, 0x0006, 0x0005, 0x0004, 0x0003,
+    0x0002, 0x0000, 0x0022, 0x0024, 0x0026, 0x0028, 0x002A, 0x002C,
+    0x002E, 0x0031, 0x0033, 0x0035, 0x0037, 0x0138, 0x013A, 0x013A,
+    /* a = 0x12 */
+    0x0012, 0x0112, 0x0013, 0x0114, 0x0014, 0x0114, 0x0015, 0x0116,
+    0x0016, 0x0116, 0x0017, 0x0118, 0x0018, 0x0118, 0x0118, 0x0119,
+    0x0019, 0x011A, 0x001A, 0x011A, 0x001B, 0x011C, 0x001C, 0x011C,
+    0x001D, 0x001E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0012, 0x0112, 0x0011, 0x0110, 0x0010, 0x000F, 0x000E, 0x000D,
+    0x000C, 0x000B, 0x000A, 0x0009, 0x0008, 0x0007, 0x0006, 0x0005,
+    0x0004, 0x0002, 0x0000, 0x0022, 0x0024, 0x0026, 0x0028, 0x002A,
+    0x002C, 0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x0039, 0x003A,
+    /* a = 0x13 */
+    0x0013, 0x0114, 0x0014, 0x0114, 0x0015, 0x0116, 0x0016, 0x0116,
+    0x0017, 0x0118, 0x0018, 0x0118, 0x0118, 0x0119, 0x0019, 0x0119,
+    0x011A, 0x001A, 0x011A, 0x001B, 0x011C, 0x001C, 0x011C, 0x001D,
+    0x011E, 0x011E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0013, 0x0112, 0x0012, 0x0112, 0x0011, 0x0110, 0x0010, 0x000F,
+    0x000E, 0x000D, 0x000C, 0x000B, 0x000A, 0x0009, 0x0008, 0x0007,
+    0x0006, 0x0004, 0x0002, 0x0000, 0x0022, 0x0024, 0x0026, 0x0028,
+    0x002A, 0x002E, 0x0031, 0x0033, 0x0035, 0x0037, 0x0138, 0x013A,
+    /* a = 0x14 */
+    0x0014, 0x0114, 0x0015, 0x0116, 0x0016, 0x0116, 0x0017, 0x0118,
+    0x0018, 0x0118, 0x0118, 0x0119, 0x0019, 0x0119, 0x011A, 0x011A,
+    0x001A, 0x011A, 0x001B, 0x011C, 0x001C, 0x011C, 0x001D, 0x011E,
+    0x001E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0014, 0x0114, 0x0013, 0x0112, 0x0012, 0x0112, 0x0011, 0x0110,
+    0x0010, 0x000F, 0x000E, 0x000D, 0x000C, 0x000B, 0x000A, 0x0009,
+    0x0008, 0x0006, 0x0004, 0x0002, 0x0000, 0x0022, 0x0024, 0x0026,
+    0x0028, 0x002C, 0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x0039,
+    /* a = 0x15 */
+    0x0015, 0x0116, 0x0016, 0x0116, 0x0017, 0x0118, 0x0018, 0x0118,
+    0x0118, 0x0119, 0x0019, 0x0119, 0x011A, 0x011A, 0x001A, 0x011A,
+    0x011A, 0x001B, 0x011C, 0x001C, 0x011C, 0x001D, 0x011E, 0x001E,
+    0x011E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0015, 0x0114, 0x0014, 0x0114, 0x0013, 0x0112, 0x0012, 0x0112,
+    0x0011, 0x0110, 0x0010, 0x000F, 0x000E, 0x000D, 0x000C, 0x000B,
+    0x000A, 0x0008, 0x0006, 0x0004, 0x0002, 0x0000, 0x0022, 0x0024,
+    0x0026, 0x002A, 0x002E, 0x0031, 0x0033, 0x0035, 0x0037, 0x0138,
+    /* a = 0x16 */
+    0x0016, 0x0116, 0x0017, 0x0118, 0x0018, 0x0118, 0x0118, 0x0119,
+    0x0019, 0x0119, 0x011A, 0x011A, 0x001A, 0x011A, 0x011A, 0x011B,
+    0x001B, 0x011C, 0x001C, 0x011C, 0x001D, 0x011E, 0x001E, 0x011E,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0016, 0x0116, 0x0015, 0x0114, 0x0014, 0x0114, 0x0013, 0x0112,
+    0x0012, 0x0112, 0x0011, 0x0110, 0x0010, 0x000F, 0x000E, 0x000D,
+    0x000C, 0x000A, 0x0008, 0x0006, 0x0004, 0x0002, 0x0000, 0x0022,
+    0x0024, 0x0028, 0x002C, 0x0030, 0x0032, 0x0034, 0x0036, 0x0038,
+    /* a = 0x17 */
+    0x0017, 0x0118, 0x0018, 0x0118, 0x0118, 0x0119, 0x0019, 0x0119,
+    0x011A, 0x011A, 0x001A, 0x011A, 0x011A, 0x011B, 0x001B, 0x011B,
+    0x011C, 0x001C, 0x011C, 0x001D, 0x011E, 0x001E, 0x011E, 0x001F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0017, 0x0116, 0x0016, 0x0116, 0x0015, 0x0114, 0x0014, 0x0114,
+    0x0013, 0x0112, 0x0012, 0x0112, 0x0011, 0x0110, 0x0010, 0x000F,
+    0x000E, 0x000C, 0x000A, 0x0008, 0x0006, 0x0004, 0x0002, 0x0000,
+    0x0022, 0x0026, 0x002A, 0x002E, 0x0031, 0x0033, 0x0035, 0x0037,
+    /* a = 0x18 */
+    0x0018, 0x0118, 0x0118, 0x0119, 0x0019, 0x0119, 0x011A, 0x011A,
+    0x001A, 0x011A, 0x011A, 0x011B, 0x001B, 0x011B, 0x011C, 0x011C,
+    0x001C, 0x011C, 0x001D, 0x011E, 0x001E, 0x011E, 0x001F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0018, 0x0118, 0x0017, 0x0116, 0x0016, 0x0116, 0x0015, 0x0114,
+    0x0014, 0x0114, 0x0013, 0x0112, 0x0012, 0x0112, 0x0011, 0x0110,
+    0x0010, 0x000E, 0x000C, 0x000A, 0x0008, 0x0006, 0x0004, 0x0002,
+    0x0000, 0x0024, 0x0028, 0x002C, 0x0030, 0x0032, 0x0034, 0x0036,
+    /* a = 0x19 */
+    0x0019, 0x0119, 0x011A, 0x011A, 0x001A, 0x011A, 0x011A, 0x011B,
+    0x001B, 0x011B, 0x011C, 0x011C, 0x001C, 0x011C, 0x011C, 0x011D,
+    0x001D, 0x011E, 0x001E, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0019, 0x0119, 0x0118, 0x0118, 0x0018, 0x0118, 0x0017, 0x0116,
+    0x0016, 0x0116, 0x0015, 0x0114, 0x0014, 0x0114, 0x0013, 0x0112,
+    0x0012, 0x0011, 0x0010, 0x000E, 0x000C, 0x000A, 0x0008, 0x0006,
+    0x0004, 0x0000, 0x0024, 0x0028, 0x002C, 0x0030, 0x0032, 0x0034,
+    /* a = 0x1A */
+    0x001A, 0x011A, 0x011A, 0x011B, 0x001B, 0x011B, 0x011C, 0x011C,
+    0x001C, 0x011C, 0x011C, 0x011D, 0x001D, 0x011D, 0x011E, 0x011E,
+    0x001E, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001A, 0x011A, 0x011A, 0x0119, 0x0019, 0x0119, 0x0118, 0x0118,
+    0x0018, 0x0118, 0x0017, 0x0116, 0x0016, 0x0116, 0x0015, 0x0114,
+    0x0014, 0x0013, 0x0012, 0x0011, 0x0010, 0x000E, 0x000C, 0x000A,
+    0x0008, 0x0004, 0x0000, 0x0024, 0x0028, 0x002C, 0x0030, 0x0032,
+    /* a = 0x1B */
+    0x001B, 0x011B, 0x011C, 0x011C, 0x001C, 0x011C, 0x011C, 0x011D,
+    0x001D, 0x011D, 0x011E, 0x011E, 0x001E, 0x011E, 0x011E, 0x011F,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001B, 0x011B, 0x011A, 0x011A, 0x001A, 0x011A, 0x011A, 0x0119,
+    0x0019, 0x0119, 0x0118, 0x0118, 0x0018, 0x0118, 0x0017, 0x0116,
+    0x0016, 0x0015, 0x0014, 0x0013, 0x0012, 0x0011, 0x0010, 0x000E,
+    0x000C, 0x0008, 0x0004, 0x0000, 0x0024, 0x0028, 0x002C, 0x0030,
+    /* a = 0x1C */
+    0x001C, 0x011C, 0x011C, 0x011D, 0x001D, 0x011D, 0x011E, 0x011E,
+    0x001E, 0x011E, 0x011E, 0x011F, 0x001F, 0x011F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001C, 0x011C, 0x011C, 0x011B, 0x001B, 0x011B, 0x011A, 0x011A,
+    0x001A, 0x011A, 0x011A, 0x0119, 0x0019, 0x0119, 0x0118, 0x0118,
+    0x0018, 0x0017, 0x0016, 0x0015, 0x0014, 0x0013, 0x0012, 0x0011,
+    0x0010, 0x000C, 0x0008, 0x0004, 0x0000, 0x0024, 0x0028, 0x002C,
+    /* a = 0x1D */
+    0x001D, 0x011D, 0x011E, 0x011E, 0x001E, 0x011E, 0x011E, 0x011F,
+    0x001F, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001D, 0x011D, 0x011C, 0x011C, 0x001C, 0x011C, 0x011C, 0x011B,
+    0x001B, 0x011B, 0x011A, 0x011A, 0x001A, 0x011A, 0x011A, 0x0119,
+    0x0019, 0x0118, 0x0018, 0x0017, 0x0016, 0x0015, 0x0014, 0x0013,
+    0x0012, 0x0010, 0x000C, 0x0008, 0x0004, 0x0000, 0x0024, 0x0028,
+    /* a = 0x1E */
+    0x001E, 0x011E, 0x011E, 0x011F, 0x001F, 0x011F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001E, 0x011E, 0x011E, 0x011D, 0x001D, 0x011D, 0x011C, 0x011C,
+    0x001C, 0x011C, 0x011C, 0x011B, 0x001B, 0x011B, 0x011A, 0x011A,
+    0x001A, 0x011A, 0x0019, 0x0118, 0x0018, 0x0017, 0x0016, 0x0015,
+    0x0014, 0x0012, 0x0010, 0x000C, 0x0008, 0x0004, 0x0000, 0x0024,
+    /* a = 0x1F */
+    0x001F, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001F, 0x011F, 0x011E, 0x011E, 0x001E, 0x011E, 0x011E, 0x011D,
+    0x001D, 0x011D, 0x011C, 0x011C, 0x001C, 0x011C, 0x011C, 0x011B,
+    0x001B, 0x011A, 0x001A, 0x011A, 0x0019, 0x0118, 0x0018, 0x0017,
+    0x0016, 0x0014, 0x0012, 0x0010, 0x000C, 0x0008, 0x0004, 0x0000,
+    /* a = 0x20 */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    /* a = 0x21 */
+    0x0021, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006,
+    0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E,
+    0x000F, 0x0110, 0x0112, 0x0112, 0x0114, 0x0114, 0x0116, 0x0116,
+    0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E, 0x011F,
+    0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028,
+    0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030,
+    0x0130, 0x0132, 0x0132, 0x0134, 0x0134, 0x0136, 0x0136, 0x0138,
+    0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F,
+    /* a = 0x22 */
+    0x0022, 0x0021, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005,
+    0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D,
+    0x000E, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016,
+    0x0017, 0x0118, 0x011A, 0x011A, 0x011C, 0x011C, 0x011E, 0x011E,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029,
+    0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0130,
+    0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+    0x0138, 0x013A, 0x013A, 0x013C, 0x013C, 0x013E, 0x013E, 0x053F,
+    /* a = 0x23 */
+    0x0023, 0x0022, 0x0021, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C,
+    0x000D, 0x000F, 0x0110, 0x0112, 0x0112, 0x0114, 0x0114, 0x0116,
+    0x0116, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+    0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A,
+    0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0130, 0x0031,
+    0x0132, 0x0132, 0x0134, 0x0134, 0x0136, 0x0136, 0x0138, 0x0138,
+    0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x053F,
+    /* a = 0x24 */
+    0x0024, 0x0023, 0x0022, 0x0021, 0x0000, 0x0001, 0x0002, 0x0003,
+    0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B,
+    0x000C, 0x000E, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015,
+    0x0016, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E,
+    0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B,
+    0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0130, 0x0031, 0x0132,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0138,
+    0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x053F,
+    /* a = 0x25 */
+    0x0025, 0x0024, 0x0023, 0x0022, 0x0021, 0x0000, 0x0001, 0x0002,
+    0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A,
+    0x000B, 0x000D, 0x000F, 0x0110, 0x0112, 0x0112, 0x0114, 0x0114,
+    0x0116, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C,
+    0x002D, 0x002E, 0x002F, 0x0030, 0x0130, 0x0031, 0x0132, 0x0032,
+    0x0132, 0x0134, 0x0134, 0x0136, 0x0136, 0x0138, 0x0138, 0x0139,
+    0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x053F,
+    /* a = 0x26 */
+    0x0026, 0x0025, 0x0024, 0x0023, 0x0022, 0x0021, 0x0000, 0x0001,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009,
+    0x000A, 0x000C, 0x000E, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0017, 0x0118, 0x011A, 0x011A, 0x011C, 0x011C, 0x011E,
+    0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D,
+    0x002E, 0x002F, 0x0030, 0x0130, 0x0031, 0x0132, 0x0032, 0x0132,
+    0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0138, 0x0039,
+    0x013A, 0x013A, 0x013C, 0x013C, 0x013E, 0x013E, 0x053F, 0x053F,
+    /* a = 0x27 */
+    0x0027, 0x0026, 0x0025, 0x0024, 0x0023, 0x0022, 0x0021, 0x0000,
+    0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008,
+    0x0009, 0x000B, 0x000D, 0x000F, 0x0110, 0x0112, 0x0112, 0x0114,
+    0x0114, 0x0116, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E,
+    0x002F, 0x0030, 0x0130, 0x0031, 0x0132, 0x0032, 0x0132, 0x0033,
+    0x0134, 0x0134, 0x0136, 0x0136, 0x0138, 0x0138, 0x0139, 0x0139,
+    0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x053F, 0x053F,
+    /* a = 0x28 */
+    0x0028, 0x0027, 0x0026, 0x0025, 0x0024, 0x0023, 0x0022, 0x0021,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0011, 0x0012, 0x0013,
+    0x0014, 0x0016, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0130, 0x0031, 0x0132, 0x0032, 0x0132, 0x0033, 0x0134,
+    0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0138, 0x0039, 0x013A,
+    0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x053F, 0x053F,
+    /* a = 0x29 */
+    0x0029, 0x0028, 0x0027, 0x0026, 0x0025, 0x0024, 0x0023, 0x0022,
+    0x0021, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006,
+    0x0007, 0x0009, 0x000B, 0x000D, 0x000F, 0x0110, 0x0112, 0x0112,
+    0x0114, 0x0116, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030,
+    0x0130, 0x0031, 0x0132, 0x0032, 0x0132, 0x0033, 0x0134, 0x0034,
+    0x0134, 0x0136, 0x0136, 0x0138, 0x0138, 0x0139, 0x0139, 0x013A,
+    0x013A, 0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x053F, 0x053F,
+    /* a = 0x2A */
+    0x002A, 0x0029, 0x0028, 0x0027, 0x0026, 0x0025, 0x0024, 0x0023,
+    0x0022, 0x0021, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005,
+    0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0011, 0x0012,
+    0x0013, 0x0015, 0x0017, 0x0118, 0x011A, 0x011A, 0x011C, 0x011C,
+    0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0130,
+    0x0031, 0x0132, 0x0032, 0x0132, 0x0033, 0x0134, 0x0034, 0x0134,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0138, 0x0039, 0x013A, 0x003A,
+    0x013A, 0x013C, 0x013C, 0x013E, 0x013E, 0x053F, 0x053F, 0x053F,
+    /* a = 0x2B */
+    0x002B, 0x002A, 0x0029, 0x0028, 0x0027, 0x0026, 0x0025, 0x0024,
+    0x0023, 0x0022, 0x0021, 0x0000, 0x0001, 0x0002, 0x0003, 0x0004,
+    0x0005, 0x0007, 0x0009, 0x000B, 0x000D, 0x000F, 0x0110, 0x0112,
+    0x0112, 0x0114, 0x0116, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C,
+    0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0130, 0x0031,
+    0x0132, 0x0032, 0x0132, 0x0033, 0x0134, 0x0034, 0x0134, 0x0035,
+    0x0136, 0x0136, 0x0138, 0x0138, 0x0139, 0x0139, 0x013A, 0x013A,
+    0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x2C */
+    0x002C, 0x002B, 0x002A, 0x0029, 0x0028, 0x0027, 0x0026, 0x0025,
+    0x0024, 0x0023, 0x0022, 0x0021, 0x0000, 0x0001, 0x0002, 0x0003,
+    0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010, 0x0011,
+    0x0012, 0x0014, 0x0016, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C,
+    0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0130, 0x0031, 0x0132,
+    0x0032, 0x0132, 0x0033, 0x0134, 0x0034, 0x0134, 0x0035, 0x0136,
+    0x0036, 0x0037, 0x0038, 0x0138, 0x0039, 0x013A, 0x003A, 0x013A,
+    0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x2D */
+    0x002D, 0x002C, 0x002B, 0x002A, 0x0029, 0x0028, 0x0027, 0x0026,
+    0x0025, 0x0024, 0x0023, 0x0022, 0x0021, 0x0000, 0x0001, 0x0002,
+    0x0003, 0x0005, 0x0007, 0x0009, 0x000B, 0x000D, 0x000F, 0x0110,
+    0x0112, 0x0114, 0x0116, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C,
+    0x002D, 0x002E, 0x002F, 0x0030, 0x0130, 0x0031, 0x0132, 0x0032,
+    0x0132, 0x0033, 0x0134, 0x0034, 0x0134, 0x0035, 0x0136, 0x0036,
+    0x0136, 0x0138, 0x0138, 0x0139, 0x0139, 0x013A, 0x013A, 0x013B,
+    0x013B, 0x013C, 0x013D, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x2E */
+    0x002E, 0x002D, 0x002C, 0x002B, 0x002A, 0x0029, 0x0028, 0x0027,
+    0x0026, 0x0025, 0x0024, 0x0023, 0x0022, 0x0021, 0x0000, 0x0001,
+    0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E, 0x0010,
+    0x0011, 0x0013, 0x0015, 0x0017, 0x0118, 0x011A, 0x011A, 0x011C,
+    0x002E, 0x002F, 0x0030, 0x0130, 0x0031, 0x0132, 0x0032, 0x0132,
+    0x0033, 0x0134, 0x0034, 0x0134, 0x0035, 0x0136, 0x0036, 0x0136,
+    0x0037, 0x0038, 0x0138, 0x0039, 0x013A, 0x003A, 0x013A, 0x003B,
+    0x013C, 0x013C, 0x013E, 0x013E, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x2F */
+    0x002F, 0x002E, 0x002D, 0x002C, 0x002B, 0x002A, 0x0029, 0x0028,
+    0x0027, 0x0026, 0x0025, 0x0024, 0x0023, 0x0022, 0x0021, 0x0000,
+    0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000B, 0x000D, 0x000F,
+    0x0110, 0x0112, 0x0114, 0x0116, 0x0118, 0x0119, 0x011A, 0x011B,
+    0x002F, 0x0030, 0x0130, 0x0031, 0x0132, 0x0032, 0x0132, 0x0033,
+    0x0134, 0x0034, 0x0134, 0x0035, 0x0136, 0x0036, 0x0136, 0x0037,
+    0x0138, 0x0138, 0x0139, 0x0139, 0x013A, 0x013A, 0x013B, 0x013B,
+    0x013C, 0x013D, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x30 */
+    0x0030, 0x002F, 0x002E, 0x002D, 0x002C, 0x002B, 0x002A, 0x0029,
+    0x0028, 0x0027, 0x0026, 0x0025, 0x0024, 0x0023, 0x0022, 0x0021,
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E,
+    0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x0019, 0x001A, 0x001B,
+    0x0030, 0x0130, 0x0031, 0x0132, 0x0032, 0x0132, 0x0033, 0x0134,
+    0x0034, 0x0134, 0x0035, 0x0136, 0x0036, 0x0136, 0x0037, 0x0138,
+    0x0038, 0x0138, 0x0039, 0x013A, 0x003A, 0x013A, 0x003B, 0x013C,
+    0x003C, 0x003D, 0x003E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x31 */
+    0x0031, 0x0130, 0x0030, 0x002F, 0x002E, 0x002D, 0x002C, 0x002B,
+    0x002A, 0x0029, 0x0028, 0x0027, 0x0026, 0x0025, 0x0024, 0x0023,
+    0x0022, 0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C,
+    0x000E, 0x0011, 0x0013, 0x0015, 0x0017, 0x0118, 0x011A, 0x011A,
+    0x0031, 0x0132, 0x0032, 0x0132, 0x0033, 0x0134, 0x0034, 0x0134,
+    0x0035, 0x0136, 0x0036, 0x0136, 0x0037, 0x0138, 0x0038, 0x0138,
+    0x0138, 0x0039, 0x013A, 0x003A, 0x013A, 0x003B, 0x013C, 0x003C,
+    0x013C, 0x013E, 0x013E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x32 */
+    0x0032, 0x0132, 0x0031, 0x0130, 0x0030, 0x002F, 0x002E, 0x002D,
+    0x002C, 0x002B, 0x002A, 0x0029, 0x0028, 0x0027, 0x0026, 0x0025,
+    0x0024, 0x0022, 0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A,
+    0x000C, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x0019, 0x001A,
+    0x0032, 0x0132, 0x0033, 0x0134, 0x0034, 0x0134, 0x0035, 0x0136,
+    0x0036, 0x0136, 0x0037, 0x0138, 0x0038, 0x0138, 0x0138, 0x0139,
+    0x0039, 0x013A, 0x003A, 0x013A, 0x003B, 0x013C, 0x003C, 0x013C,
+    0x003D, 0x003E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x33 */
+    0x0033, 0x0132, 0x0032, 0x0132, 0x0031, 0x0130, 0x0030, 0x002F,
+    0x002E, 0x002D, 0x002C, 0x002B, 0x002A, 0x0029, 0x0028, 0x0027,
+    0x0026, 0x0024, 0x0022, 0x0000, 0x0002, 0x0004, 0x0006, 0x0008,
+    0x000A, 0x000E, 0x0011, 0x0013, 0x0015, 0x0017, 0x0118, 0x011A,
+    0x0033, 0x0134, 0x0034, 0x0134, 0x0035, 0x0136, 0x0036, 0x0136,
+    0x0037, 0x0138, 0x0038, 0x0138, 0x0138, 0x0139, 0x0039, 0x0139,
+    0x013A, 0x003A, 0x013A, 0x003B, 0x013C, 0x003C, 0x013C, 0x003D,
+    0x013E, 0x013E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x34 */
+    0x0034, 0x0134, 0x0033, 0x0132, 0x0032, 0x0132, 0x0031, 0x0130,
+    0x0030, 0x002F, 0x002E, 0x002D, 0x002C, 0x002B, 0x002A, 0x0029,
+    0x0028, 0x0026, 0x0024, 0x0022, 0x0000, 0x0002, 0x0004, 0x0006,
+    0x0008, 0x000C, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x0019,
+    0x0034, 0x0134, 0x0035, 0x0136, 0x0036, 0x0136, 0x0037, 0x0138,
+    0x0038, 0x0138, 0x0138, 0x0139, 0x0039, 0x0139, 0x013A, 0x013A,
+    0x003A, 0x013A, 0x003B, 0x013C, 0x003C, 0x013C, 0x003D, 0x013E,
+    0x003E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x35 */
+    0x0035, 0x0134, 0x0034, 0x0134, 0x0033, 0x0132, 0x0032, 0x0132,
+    0x0031, 0x0130, 0x0030, 0x002F, 0x002E, 0x002D, 0x002C, 0x002B,
+    0x002A, 0x0028, 0x0026, 0x0024, 0x0022, 0x0000, 0x0002, 0x0004,
+    0x0006, 0x000A, 0x000E, 0x0011, 0x0013, 0x0015, 0x0017, 0x0118,
+    0x0035, 0x0136, 0x0036, 0x0136, 0x0037, 0x0138, 0x0038, 0x0138,
+    0x0138, 0x0139, 0x0039, 0x0139, 0x013A, 0x013A, 0x003A, 0x013A,
+    0x013A, 0x003B, 0x013C, 0x003C, 0x013C, 0x003D, 0x013E, 0x003E,
+    0x013E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x36 */
+    0x0036, 0x0136, 0x0035, 0x0134, 0x0034, 0x0134, 0x0033, 0x0132,
+    0x0032, 0x0132, 0x0031, 0x0130, 0x0030, 0x002F, 0x002E, 0x002D,
+    0x002C, 0x002A, 0x0028, 0x0026, 0x0024, 0x0022, 0x0000, 0x0002,
+    0x0004, 0x0008, 0x000C, 0x0010, 0x0012, 0x0014, 0x0016, 0x0018,
+    0x0036, 0x0136, 0x0037, 0x0138, 0x0038, 0x0138, 0x0138, 0x0139,
+    0x0039, 0x0139, 0x013A, 0x013A, 0x003A, 0x013A, 0x013A, 0x013B,
+    0x003B, 0x013C, 0x003C, 0x013C, 0x003D, 0x013E, 0x003E, 0x013E,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x37 */
+    0x0037, 0x0136, 0x0036, 0x0136, 0x0035, 0x0134, 0x0034, 0x0134,
+    0x0033, 0x0132, 0x0032, 0x0132, 0x0031, 0x0130, 0x0030, 0x002F,
+    0x002E, 0x002C, 0x002A, 0x0028, 0x0026, 0x0024, 0x0022, 0x0000,
+    0x0002, 0x0006, 0x000A, 0x000E, 0x0011, 0x0013, 0x0015, 0x0017,
+    0x0037, 0x0138, 0x0038, 0x0138, 0x0138, 0x0139, 0x0039, 0x0139,
+    0x013A, 0x013A, 0x003A, 0x013A, 0x013A, 0x013B, 0x003B, 0x013B,
+    0x013C, 0x003C, 0x013C, 0x003D, 0x013E, 0x003E, 0x013E, 0x003F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x38 */
+    0x0038, 0x0138, 0x0037, 0x0136, 0x0036, 0x0136, 0x0035, 0x0134,
+    0x0034, 0x0134, 0x0033, 0x0132, 0x0032, 0x0132, 0x0031, 0x0130,
+    0x0030, 0x002E, 0x002C, 0x002A, 0x0028, 0x0026, 0x0024, 0x0022,
+    0x0000, 0x0004, 0x0008, 0x000C, 0x0010, 0x0012, 0x0014, 0x0016,
+    0x0038, 0x0138, 0x0138, 0x0139, 0x0039, 0x0139, 0x013A, 0x013A,
+    0x003A, 0x013A, 0x013A, 0x013B, 0x003B, 0x013B, 0x013C, 0x013C,
+    0x003C, 0x013C, 0x003D, 0x013E, 0x003E, 0x013E, 0x003F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x39 */
+    0x0039, 0x0139, 0x0138, 0x0138, 0x0038, 0x0138, 0x0037, 0x0136,
+    0x0036, 0x0136, 0x0035, 0x0134, 0x0034, 0x0134, 0x0033, 0x0132,
+    0x0032, 0x0031, 0x0030, 0x002E, 0x002C, 0x002A, 0x0028, 0x0026,
+    0x0024, 0x0000, 0x0004, 0x0008, 0x000C, 0x0010, 0x0012, 0x0014,
+    0x0039, 0x0139, 0x013A, 0x013A, 0x003A, 0x013A, 0x013A, 0x013B,
+    0x003B, 0x013B, 0x013C, 0x013C, 0x003C, 0x013C, 0x013C, 0x013D,
+    0x003D, 0x013E, 0x003E, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x3A */
+    0x003A, 0x013A, 0x013A, 0x0139, 0x0039, 0x0139, 0x0138, 0x0138,
+    0x0038, 0x0138, 0x0037, 0x0136, 0x0036, 0x0136, 0x0035, 0x0134,
+    0x0034, 0x0033, 0x0032, 0x0031, 0x0030, 0x002E, 0x002C, 0x002A,
+    0x0028, 0x0024, 0x0000, 0x0004, 0x0008, 0x000C, 0x0010, 0x0012,
+    0x003A, 0x013A, 0x013A, 0x013B, 0x003B, 0x013B, 0x013C, 0x013C,
+    0x003C, 0x013C, 0x013C, 0x013D, 0x003D, 0x013D, 0x013E, 0x013E,
+    0x003E, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x3B */
+    0x003B, 0x013B, 0x013A, 0x013A, 0x003A, 0x013A, 0x013A, 0x0139,
+    0x0039, 0x0139, 0x0138, 0x0138, 0x0038, 0x0138, 0x0037, 0x0136,
+    0x0036, 0x0035, 0x0034, 0x0033, 0x0032, 0x0031, 0x0030, 0x002E,
+    0x002C, 0x0028, 0x0024, 0x0000, 0x0004, 0x0008, 0x000C, 0x0010,
+    0x003B, 0x013B, 0x013C, 0x013C, 0x003C, 0x013C, 0x013C, 0x013D,
+    0x003D, 0x013D, 0x013E, 0x013E, 0x003E, 0x013E, 0x013E, 0x013F,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x3C */
+    0x003C, 0x013C, 0x013C, 0x013B, 0x003B, 0x013B, 0x013A, 0x013A,
+    0x003A, 0x013A, 0x013A, 0x0139, 0x0039, 0x0139, 0x0138, 0x0138,
+    0x0038, 0x0037, 0x0036, 0x0035, 0x0034, 0x0033, 0x0032, 0x0031,
+    0x0030, 0x002C, 0x0028, 0x0024, 0x0000, 0x0004, 0x0008, 0x000C,
+    0x003C, 0x013C, 0x013C, 0x013D, 0x003D, 0x013D, 0x013E, 0x013E,
+    0x003E, 0x013E, 0x013E, 0x013F, 0x003F, 0x013F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x3D */
+    0x003D, 0x013D, 0x013C, 0x013C, 0x003C, 0x013C, 0x013C, 0x013B,
+    0x003B, 0x013B, 0x013A, 0x013A, 0x003A, 0x013A, 0x013A, 0x0139,
+    0x0039, 0x0138, 0x0038, 0x0037, 0x0036, 0x0035, 0x0034, 0x0033,
+    0x0032, 0x0030, 0x002C, 0x0028, 0x0024, 0x0000, 0x0004, 0x0008,
+    0x003D, 0x013D, 0x013E, 0x013E, 0x003E, 0x013E, 0x013E, 0x013F,
+    0x003F, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x3E */
+    0x003E, 0x013E, 0x013E, 0x013D, 0x003D, 0x013D, 0x013C, 0x013C,
+    0x003C, 0x013C, 0x013C, 0x013B, 0x003B, 0x013B, 0x013A, 0x013A,
+    0x003A, 0x013A, 0x0039, 0x0138, 0x0038, 0x0037, 0x0036, 0x0035,
+    0x0034, 0x0032, 0x0030, 0x002C, 0x0028, 0x0024, 0x0000, 0x0004,
+    0x003E, 0x013E, 0x013E, 0x013F, 0x003F, 0x013F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x3F */
+    0x003F, 0x013F, 0x013E, 0x013E, 0x003E, 0x013E, 0x013E, 0x013D,
+    0x003D, 0x013D, 0x013C, 0x013C, 0x003C, 0x013C, 0x013C, 0x013B,
+    0x003B, 0x013A, 0x003A, 0x013A, 0x0039, 0x0138, 0x0038, 0x0037,
+    0x0036, 0x0034, 0x0032, 0x0030, 0x002C, 0x0028, 0x0024, 0x0000,
+    0x003F, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F
+};
+
+const uint16_t softfloat_mulE2M3[4096] = {
+    /* a = 0x00 */
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    /* a = 0x01 */
+    0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0301, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0303, 0x0003, 0x0303, 0x0304, 0x0304,
+    0x0004, 0x0304, 0x0005, 0x0306, 0x0006, 0x0306, 0x0007, 0x0308,
+    0x0020, 0x0320, 0x0320, 0x0320, 0x0320, 0x0321, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0322, 0x0322, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0323, 0x0023, 0x0323, 0x0324, 0x0324,
+    0x0024, 0x0324, 0x0025, 0x0326, 0x0026, 0x0326, 0x0027, 0x0328,
+    /* a = 0x02 */
+    0x0000, 0x0300, 0x0300, 0x0301, 0x0001, 0x0301, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0303, 0x0003, 0x0303, 0x0304, 0x0304,
+    0x0004, 0x0304, 0x0005, 0x0306, 0x0006, 0x0306, 0x0007, 0x0308,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0020, 0x0320, 0x0320, 0x0321, 0x0021, 0x0321, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0323, 0x0023, 0x0323, 0x0324, 0x0324,
+    0x0024, 0x0324, 0x0025, 0x0326, 0x0026, 0x0326, 0x0027, 0x0328,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    /* a = 0x03 */
+    0x0000, 0x0300, 0x0301, 0x0301, 0x0302, 0x0302, 0x0302, 0x0303,
+    0x0003, 0x0303, 0x0304, 0x0304, 0x0304, 0x0305, 0x0305, 0x0306,
+    0x0006, 0x0307, 0x0308, 0x0108, 0x0009, 0x010A, 0x010A, 0x010B,
+    0x000C, 0x010E, 0x000F, 0x0110, 0x0011, 0x0112, 0x0112, 0x0113,
+    0x0020, 0x0320, 0x0321, 0x0321, 0x0322, 0x0322, 0x0322, 0x0323,
+    0x0023, 0x0323, 0x0324, 0x0324, 0x0324, 0x0325, 0x0325, 0x0326,
+    0x0026, 0x0327, 0x0328, 0x0128, 0x0029, 0x012A, 0x012A, 0x012B,
+    0x002C, 0x012E, 0x002F, 0x0130, 0x0031, 0x0132, 0x0132, 0x0133,
+    /* a = 0x04 */
+    0x0000, 0x0300, 0x0001, 0x0302, 0x0002, 0x0302, 0x0003, 0x0304,
+    0x0004, 0x0304, 0x0005, 0x0306, 0x0006, 0x0306, 0x0007, 0x0308,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0020, 0x0320, 0x0021, 0x0322, 0x0022, 0x0322, 0x0023, 0x0324,
+    0x0024, 0x0324, 0x0025, 0x0326, 0x0026, 0x0326, 0x0027, 0x0328,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    /* a = 0x05 */
+    0x0000, 0x0301, 0x0301, 0x0302, 0x0302, 0x0303, 0x0304, 0x0304,
+    0x0005, 0x0306, 0x0306, 0x0307, 0x0308, 0x0108, 0x0109, 0x0109,
+    0x000A, 0x010B, 0x010C, 0x010E, 0x000F, 0x0110, 0x0111, 0x0111,
+    0x0012, 0x0113, 0x0114, 0x0116, 0x0017, 0x0118, 0x0119, 0x0119,
+    0x0020, 0x0321, 0x0321, 0x0322, 0x0322, 0x0323, 0x0324, 0x0324,
+    0x0025, 0x0326, 0x0326, 0x0327, 0x0328, 0x0128, 0x0129, 0x0129,
+    0x002A, 0x012B, 0x012C, 0x012E, 0x002F, 0x0130, 0x0131, 0x0131,
+    0x0032, 0x0133, 0x0134, 0x0136, 0x0037, 0x0138, 0x0139, 0x0139,
+    /* a = 0x06 */
+    0x0000, 0x0301, 0x0302, 0x0302, 0x0003, 0x0304, 0x0304, 0x0305,
+    0x0006, 0x0307, 0x0308, 0x0108, 0x0009, 0x010A, 0x010A, 0x010B,
+    0x000C, 0x010E, 0x000F, 0x0110, 0x0011, 0x0112, 0x0112, 0x0113,
+    0x0014, 0x0116, 0x0017, 0x0118, 0x0019, 0x011A, 0x011A, 0x011B,
+    0x0020, 0x0321, 0x0322, 0x0322, 0x0023, 0x0324, 0x0324, 0x0325,
+    0x0026, 0x0327, 0x0328, 0x0128, 0x0029, 0x012A, 0x012A, 0x012B,
+    0x002C, 0x012E, 0x002F, 0x0130, 0x0031, 0x0132, 0x0132, 0x0133,
+    0x0034, 0x0136, 0x0037, 0x0138, 0x0039, 0x013A, 0x013A, 0x013B,
+    /* a = 0x07 */
+    0x0000, 0x0301, 0x0302, 0x0303, 0x0304, 0x0304, 0x0305, 0x0306,
+    0x0007, 0x2108, 0x0109, 0x010A, 0x010A, 0x010B, 0x010C, 0x010D,
+    0x000E, 0x0110, 0x0111, 0x0112, 0x0112, 0x0113, 0x0114, 0x0115,
+    0x0016, 0x0118, 0x0119, 0x011A, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x0020, 0x0321, 0x0322, 0x0323, 0x0324, 0x0324, 0x0325, 0x0326,
+    0x0027, 0x2128, 0x0129, 0x012A, 0x012A, 0x012B, 0x012C, 0x012D,
+    0x002E, 0x0130, 0x0131, 0x0132, 0x0132, 0x0133, 0x0134, 0x0135,
+    0x0036, 0x0138, 0x0139, 0x013A, 0x013A, 0x013B, 0x013C, 0x013D,
+    /* a = 0x08 */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    /* a = 0x09 */
+    0x0000, 0x0301, 0x0302, 0x0303, 0x0304, 0x0306, 0x0307, 0x2108,
+    0x0009, 0x010A, 0x010B, 0x010C, 0x010E, 0x010F, 0x0110, 0x0110,
+    0x0011, 0x0112, 0x0113, 0x0114, 0x0116, 0x0117, 0x0118, 0x0118,
+    0x0019, 0x011A, 0x011B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x0020, 0x0321, 0x0322, 0x0323, 0x0324, 0x0326, 0x0327, 0x2128,
+    0x0029, 0x012A, 0x012B, 0x012C, 0x012E, 0x012F, 0x0130, 0x0130,
+    0x0031, 0x0132, 0x0133, 0x0134, 0x0136, 0x0137, 0x0138, 0x0138,
+    0x0039, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F,
+    /* a = 0x0A */
+    0x0000, 0x0301, 0x0302, 0x0304, 0x0005, 0x0306, 0x0308, 0x0109,
+    0x000A, 0x010B, 0x010C, 0x010E, 0x000F, 0x0110, 0x0111, 0x0111,
+    0x0012, 0x0113, 0x0114, 0x0116, 0x0017, 0x0118, 0x0119, 0x0119,
+    0x001A, 0x011B, 0x011C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0321, 0x0322, 0x0324, 0x0025, 0x0326, 0x0328, 0x0129,
+    0x002A, 0x012B, 0x012C, 0x012E, 0x002F, 0x0130, 0x0131, 0x0131,
+    0x0032, 0x0133, 0x0134, 0x0136, 0x0037, 0x0138, 0x0139, 0x0139,
+    0x003A, 0x013B, 0x013C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x0B */
+    0x0000, 0x0301, 0x0303, 0x0304, 0x0306, 0x0307, 0x0108, 0x010A,
+    0x000B, 0x010C, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0112,
+    0x0013, 0x0114, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011A,
+    0x001B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0321, 0x0323, 0x0324, 0x0326, 0x0327, 0x0128, 0x012A,
+    0x002B, 0x012C, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132, 0x0132,
+    0x0033, 0x0134, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013A,
+    0x003B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x0C */
+    0x0000, 0x0302, 0x0003, 0x0304, 0x0006, 0x0308, 0x0009, 0x010A,
+    0x000C, 0x010E, 0x000F, 0x0110, 0x0011, 0x0112, 0x0112, 0x0113,
+    0x0014, 0x0116, 0x0017, 0x0118, 0x0019, 0x011A, 0x011A, 0x011B,
+    0x001C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0322, 0x0023, 0x0324, 0x0026, 0x0328, 0x0029, 0x012A,
+    0x002C, 0x012E, 0x002F, 0x0130, 0x0031, 0x0132, 0x0132, 0x0133,
+    0x0034, 0x0136, 0x0037, 0x0138, 0x0039, 0x013A, 0x013A, 0x013B,
+    0x003C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x0D */
+    0x0000, 0x0302, 0x0303, 0x0305, 0x0306, 0x0108, 0x010A, 0x010B,
+    0x000D, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0113, 0x0114,
+    0x0015, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011B, 0x011C,
+    0x001D, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0322, 0x0323, 0x0325, 0x0326, 0x0128, 0x012A, 0x012B,
+    0x002D, 0x012F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0133, 0x0134,
+    0x0035, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013B, 0x013C,
+    0x003D, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x0E */
+    0x0000, 0x0302, 0x0304, 0x0305, 0x0007, 0x0109, 0x010A, 0x010C,
+    0x000E, 0x0110, 0x0111, 0x0112, 0x0112, 0x0113, 0x0114, 0x0115,
+    0x0016, 0x0118, 0x0119, 0x011A, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x001E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0322, 0x0324, 0x0325, 0x0027, 0x0129, 0x012A, 0x012C,
+    0x002E, 0x0130, 0x0131, 0x0132, 0x0132, 0x0133, 0x0134, 0x0135,
+    0x0036, 0x0138, 0x0139, 0x013A, 0x013A, 0x013B, 0x013C, 0x013D,
+    0x003E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x0F */
+    0x0000, 0x0302, 0x0304, 0x0306, 0x0308, 0x0109, 0x010B, 0x010D,
+    0x000F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116,
+    0x0017, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0322, 0x0324, 0x0326, 0x0328, 0x0129, 0x012B, 0x012D,
+    0x002F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136,
+    0x0037, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x10 */
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002A, 0x002C, 0x002E,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x11 */
+    0x0000, 0x0302, 0x0304, 0x0307, 0x0009, 0x010B, 0x010E, 0x0110,
+    0x0011, 0x0112, 0x0113, 0x0114, 0x0116, 0x0117, 0x0118, 0x0118,
+    0x0019, 0x011A, 0x011B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0322, 0x0324, 0x0327, 0x0029, 0x012B, 0x012E, 0x0130,
+    0x0031, 0x0132, 0x0133, 0x0134, 0x0136, 0x0137, 0x0138, 0x0138,
+    0x0039, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x12 */
+    0x0000, 0x0302, 0x0005, 0x0308, 0x000A, 0x010C, 0x000F, 0x0111,
+    0x0012, 0x0113, 0x0114, 0x0116, 0x0017, 0x0118, 0x0119, 0x0119,
+    0x001A, 0x011B, 0x011C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0322, 0x0025, 0x0328, 0x002A, 0x012C, 0x002F, 0x0131,
+    0x0032, 0x0133, 0x0134, 0x0136, 0x0037, 0x0138, 0x0139, 0x0139,
+    0x003A, 0x013B, 0x013C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x13 */
+    0x0000, 0x0303, 0x0306, 0x0108, 0x000B, 0x010E, 0x0110, 0x0112,
+    0x0013, 0x0114, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011A,
+    0x001B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0323, 0x0326, 0x0128, 0x002B, 0x012E, 0x0130, 0x0132,
+    0x0033, 0x0134, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013A,
+    0x003B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x14 */
+    0x0000, 0x0003, 0x0006, 0x0009, 0x000C, 0x000F, 0x0011, 0x0112,
+    0x0014, 0x0116, 0x0017, 0x0118, 0x0019, 0x011A, 0x011A, 0x011B,
+    0x001C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0023, 0x0026, 0x0029, 0x002C, 0x002F, 0x0031, 0x0132,
+    0x0034, 0x0136, 0x0037, 0x0138, 0x0039, 0x013A, 0x013A, 0x013B,
+    0x003C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x15 */
+    0x0000, 0x0303, 0x0306, 0x010A, 0x000D, 0x0110, 0x0112, 0x0113,
+    0x0015, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011B, 0x011C,
+    0x001D, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0323, 0x0326, 0x012A, 0x002D, 0x0130, 0x0132, 0x0133,
+    0x0035, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013B, 0x013C,
+    0x003D, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x16 */
+    0x0000, 0x0304, 0x0007, 0x010A, 0x000E, 0x0111, 0x0112, 0x0114,
+    0x0016, 0x0118, 0x0119, 0x011A, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x001E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0324, 0x0027, 0x012A, 0x002E, 0x0131, 0x0132, 0x0134,
+    0x0036, 0x0138, 0x0139, 0x013A, 0x013A, 0x013B, 0x013C, 0x013D,
+    0x003E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x17 */
+    0x0000, 0x0304, 0x0308, 0x010B, 0x000F, 0x0111, 0x0113, 0x0115,
+    0x0017, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0324, 0x0328, 0x012B, 0x002F, 0x0131, 0x0133, 0x0135,
+    0x0037, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x18 */
+    0x0000, 0x0004, 0x0008, 0x000C, 0x0010, 0x0012, 0x0014, 0x0016,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0024, 0x0028, 0x002C, 0x0030, 0x0032, 0x0034, 0x0036,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x19 */
+    0x0000, 0x0304, 0x0009, 0x010E, 0x0011, 0x0113, 0x0116, 0x0118,
+    0x0019, 0x011A, 0x011B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0324, 0x0029, 0x012E, 0x0031, 0x0133, 0x0136, 0x0138,
+    0x0039, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x1A */
+    0x0000, 0x0005, 0x000A, 0x000F, 0x0012, 0x0114, 0x0017, 0x0119,
+    0x001A, 0x011B, 0x011C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0025, 0x002A, 0x002F, 0x0032, 0x0134, 0x0037, 0x0139,
+    0x003A, 0x013B, 0x013C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x1B */
+    0x0000, 0x0306, 0x000B, 0x0110, 0x0013, 0x0116, 0x0118, 0x011A,
+    0x001B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0326, 0x002B, 0x0130, 0x0033, 0x0136, 0x0138, 0x013A,
+    0x003B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x1C */
+    0x0000, 0x0006, 0x000C, 0x0011, 0x0014, 0x0017, 0x0019, 0x011A,
+    0x001C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0026, 0x002C, 0x0031, 0x0034, 0x0037, 0x0039, 0x013A,
+    0x003C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x1D */
+    0x0000, 0x0306, 0x000D, 0x0112, 0x0015, 0x0118, 0x011A, 0x011B,
+    0x001D, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0326, 0x002D, 0x0132, 0x0035, 0x0138, 0x013A, 0x013B,
+    0x003D, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x1E */
+    0x0000, 0x0007, 0x000E, 0x0112, 0x0016, 0x0119, 0x011A, 0x011C,
+    0x001E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0027, 0x002E, 0x0132, 0x0036, 0x0139, 0x013A, 0x013C,
+    0x003E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x1F */
+    0x0000, 0x0308, 0x000F, 0x0113, 0x0017, 0x0119, 0x011B, 0x011D,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x0020, 0x0328, 0x002F, 0x0133, 0x0037, 0x0139, 0x013B, 0x013D,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    /* a = 0x20 */
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /* a = 0x21 */
+    0x0020, 0x0320, 0x0320, 0x0320, 0x0320, 0x0321, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0322, 0x0322, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0323, 0x0023, 0x0323, 0x0324, 0x0324,
+    0x0024, 0x0324, 0x0025, 0x0326, 0x0026, 0x0326, 0x0027, 0x0328,
+    0x0000, 0x0300, 0x0300, 0x0300, 0x0300, 0x0301, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0303, 0x0003, 0x0303, 0x0304, 0x0304,
+    0x0004, 0x0304, 0x0005, 0x0306, 0x0006, 0x0306, 0x0007, 0x0308,
+    /* a = 0x22 */
+    0x0020, 0x0320, 0x0320, 0x0321, 0x0021, 0x0321, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0323, 0x0023, 0x0323, 0x0324, 0x0324,
+    0x0024, 0x0324, 0x0025, 0x0326, 0x0026, 0x0326, 0x0027, 0x0328,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0000, 0x0300, 0x0300, 0x0301, 0x0001, 0x0301, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0303, 0x0003, 0x0303, 0x0304, 0x0304,
+    0x0004, 0x0304, 0x0005, 0x0306, 0x0006, 0x0306, 0x0007, 0x0308,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    /* a = 0x23 */
+    0x0020, 0x0320, 0x0321, 0x0321, 0x0322, 0x0322, 0x0322, 0x0323,
+    0x0023, 0x0323, 0x0324, 0x0324, 0x0324, 0x0325, 0x0325, 0x0326,
+    0x0026, 0x0327, 0x0328, 0x0128, 0x0029, 0x012A, 0x012A, 0x012B,
+    0x002C, 0x012E, 0x002F, 0x0130, 0x0031, 0x0132, 0x0132, 0x0133,
+    0x0000, 0x0300, 0x0301, 0x0301, 0x0302, 0x0302, 0x0302, 0x0303,
+    0x0003, 0x0303, 0x0304, 0x0304, 0x0304, 0x0305, 0x0305, 0x0306,
+    0x0006, 0x0307, 0x0308, 0x0108, 0x0009, 0x010A, 0x010A, 0x010B,
+    0x000C, 0x010E, 0x000F, 0x0110, 0x0011, 0x0112, 0x0112, 0x0113,
+    /* a = 0x24 */
+    0x0020, 0x0320, 0x0021, 0x0322, 0x0022, 0x0322, 0x0023, 0x0324,
+    0x0024, 0x0324, 0x0025, 0x0326, 0x0026, 0x0326, 0x0027, 0x0328,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0000, 0x0300, 0x0001, 0x0302, 0x0002, 0x0302, 0x0003, 0x0304,
+    0x0004, 0x0304, 0x0005, 0x0306, 0x0006, 0x0306, 0x0007, 0x0308,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    /* a = 0x25 */
+    0x0020, 0x0321, 0x0321, 0x0322, 0x0322, 0x0323, 0x0324, 0x0324,
+    0x0025, 0x0326, 0x0326, 0x0327, 0x0328, 0x0128, 0x0129, 0x0129,
+    0x002A, 0x012B, 0x012C, 0x012E, 0x002F, 0x0130, 0x0131, 0x0131,
+    0x0032, 0x0133, 0x0134, 0x0136, 0x0037, 0x0138, 0x0139, 0x0139,
+    0x0000, 0x0301, 0x0301, 0x0302, 0x0302, 0x0303, 0x0304, 0x0304,
+    0x0005, 0x0306, 0x0306, 0x0307, 0x0308, 0x0108, 0x0109, 0x0109,
+    0x000A, 0x010B, 0x010C, 0x010E, 0x000F, 0x0110, 0x0111, 0x0111,
+    0x0012, 0x0113, 0x0114, 0x0116, 0x0017, 0x0118, 0x0119, 0x0119,
+    /* a = 0x26 */
+    0x0020, 0x0321, 0x0322, 0x0322, 0x0023, 0x0324, 0x0324, 0x0325,
+    0x0026, 0x0327, 0x0328, 0x0128, 0x0029, 0x012A, 0x012A, 0x012B,
+    0x002C, 0x012E, 0x002F, 0x0130, 0x0031, 0x0132, 0x0132, 0x0133,
+    0x0034, 0x0136, 0x0037, 0x0138, 0x0039, 0x013A, 0x013A, 0x013B,
+    0x0000, 0x0301, 0x0302, 0x0302, 0x0003, 0x0304, 0x0304, 0x0305,
+    0x0006, 0x0307, 0x0308, 0x0108, 0x0009, 0x010A, 0x010A, 0x010B,
+    0x000C, 0x010E, 0x000F, 0x0110, 0x0011, 0x0112, 0x0112, 0x0113,
+    0x0014, 0x0116, 0x0017, 0x0118, 0x0019, 0x011A, 0x011A, 0x011B,
+    /* a = 0x27 */
+    0x0020, 0x0321, 0x0322, 0x0323, 0x0324, 0x0324, 0x0325, 0x0326,
+    0x0027, 0x2128, 0x0129, 0x012A, 0x012A, 0x012B, 0x012C, 0x012D,
+    0x002E, 0x0130, 0x0131, 0x0132, 0x0132, 0x0133, 0x0134, 0x0135,
+    0x0036, 0x0138, 0x0139, 0x013A, 0x013A, 0x013B, 0x013C, 0x013D,
+    0x0000, 0x0301, 0x0302, 0x0303, 0x0304, 0x0304, 0x0305, 0x0306,
+    0x0007, 0x2108, 0x0109, 0x010A, 0x010A, 0x010B, 0x010C, 0x010D,
+    0x000E, 0x0110, 0x0111, 0x0112, 0x0112, 0x0113, 0x0114, 0x0115,
+    0x0016, 0x0118, 0x0119, 0x011A, 0x011A, 0x011B, 0x011C, 0x011D,
+    /* a = 0x28 */
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    /* a = 0x29 */
+    0x0020, 0x0321, 0x0322, 0x0323, 0x0324, 0x0326, 0x0327, 0x2128,
+    0x0029, 0x012A, 0x012B, 0x012C, 0x012E, 0x012F, 0x0130, 0x0130,
+    0x0031, 0x0132, 0x0133, 0x0134, 0x0136, 0x0137, 0x0138, 0x0138,
+    0x0039, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F,
+    0x0000, 0x0301, 0x0302, 0x0303, 0x0304, 0x0306, 0x0307, 0x2108,
+    0x0009, 0x010A, 0x010B, 0x010C, 0x010E, 0x010F, 0x0110, 0x0110,
+    0x0011, 0x0112, 0x0113, 0x0114, 0x0116, 0x0117, 0x0118, 0x0118,
+    0x0019, 0x011A, 0x011B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F,
+    /* a = 0x2A */
+    0x0020, 0x0321, 0x0322, 0x0324, 0x0025, 0x0326, 0x0328, 0x0129,
+    0x002A, 0x012B, 0x012C, 0x012E, 0x002F, 0x0130, 0x0131, 0x0131,
+    0x0032, 0x0133, 0x0134, 0x0136, 0x0037, 0x0138, 0x0139, 0x0139,
+    0x003A, 0x013B, 0x013C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0301, 0x0302, 0x0304, 0x0005, 0x0306, 0x0308, 0x0109,
+    0x000A, 0x010B, 0x010C, 0x010E, 0x000F, 0x0110, 0x0111, 0x0111,
+    0x0012, 0x0113, 0x0114, 0x0116, 0x0017, 0x0118, 0x0119, 0x0119,
+    0x001A, 0x011B, 0x011C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x2B */
+    0x0020, 0x0321, 0x0323, 0x0324, 0x0326, 0x0327, 0x0128, 0x012A,
+    0x002B, 0x012C, 0x012E, 0x012F, 0x0130, 0x0131, 0x0132, 0x0132,
+    0x0033, 0x0134, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013A,
+    0x003B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0301, 0x0303, 0x0304, 0x0306, 0x0307, 0x0108, 0x010A,
+    0x000B, 0x010C, 0x010E, 0x010F, 0x0110, 0x0111, 0x0112, 0x0112,
+    0x0013, 0x0114, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011A,
+    0x001B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x2C */
+    0x0020, 0x0322, 0x0023, 0x0324, 0x0026, 0x0328, 0x0029, 0x012A,
+    0x002C, 0x012E, 0x002F, 0x0130, 0x0031, 0x0132, 0x0132, 0x0133,
+    0x0034, 0x0136, 0x0037, 0x0138, 0x0039, 0x013A, 0x013A, 0x013B,
+    0x003C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0302, 0x0003, 0x0304, 0x0006, 0x0308, 0x0009, 0x010A,
+    0x000C, 0x010E, 0x000F, 0x0110, 0x0011, 0x0112, 0x0112, 0x0113,
+    0x0014, 0x0116, 0x0017, 0x0118, 0x0019, 0x011A, 0x011A, 0x011B,
+    0x001C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x2D */
+    0x0020, 0x0322, 0x0323, 0x0325, 0x0326, 0x0128, 0x012A, 0x012B,
+    0x002D, 0x012F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0133, 0x0134,
+    0x0035, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013B, 0x013C,
+    0x003D, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0302, 0x0303, 0x0305, 0x0306, 0x0108, 0x010A, 0x010B,
+    0x000D, 0x010F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0113, 0x0114,
+    0x0015, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011B, 0x011C,
+    0x001D, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x2E */
+    0x0020, 0x0322, 0x0324, 0x0325, 0x0027, 0x0129, 0x012A, 0x012C,
+    0x002E, 0x0130, 0x0131, 0x0132, 0x0132, 0x0133, 0x0134, 0x0135,
+    0x0036, 0x0138, 0x0139, 0x013A, 0x013A, 0x013B, 0x013C, 0x013D,
+    0x003E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0302, 0x0304, 0x0305, 0x0007, 0x0109, 0x010A, 0x010C,
+    0x000E, 0x0110, 0x0111, 0x0112, 0x0112, 0x0113, 0x0114, 0x0115,
+    0x0016, 0x0118, 0x0119, 0x011A, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x001E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x2F */
+    0x0020, 0x0322, 0x0324, 0x0326, 0x0328, 0x0129, 0x012B, 0x012D,
+    0x002F, 0x0130, 0x0131, 0x0132, 0x0133, 0x0134, 0x0135, 0x0136,
+    0x0037, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0302, 0x0304, 0x0306, 0x0308, 0x0109, 0x010B, 0x010D,
+    0x000F, 0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116,
+    0x0017, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x30 */
+    0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002A, 0x002C, 0x002E,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000A, 0x000C, 0x000E,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x31 */
+    0x0020, 0x0322, 0x0324, 0x0327, 0x0029, 0x012B, 0x012E, 0x0130,
+    0x0031, 0x0132, 0x0133, 0x0134, 0x0136, 0x0137, 0x0138, 0x0138,
+    0x0039, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0302, 0x0304, 0x0307, 0x0009, 0x010B, 0x010E, 0x0110,
+    0x0011, 0x0112, 0x0113, 0x0114, 0x0116, 0x0117, 0x0118, 0x0118,
+    0x0019, 0x011A, 0x011B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x32 */
+    0x0020, 0x0322, 0x0025, 0x0328, 0x002A, 0x012C, 0x002F, 0x0131,
+    0x0032, 0x0133, 0x0134, 0x0136, 0x0037, 0x0138, 0x0139, 0x0139,
+    0x003A, 0x013B, 0x013C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0302, 0x0005, 0x0308, 0x000A, 0x010C, 0x000F, 0x0111,
+    0x0012, 0x0113, 0x0114, 0x0116, 0x0017, 0x0118, 0x0119, 0x0119,
+    0x001A, 0x011B, 0x011C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x33 */
+    0x0020, 0x0323, 0x0326, 0x0128, 0x002B, 0x012E, 0x0130, 0x0132,
+    0x0033, 0x0134, 0x0136, 0x0137, 0x0138, 0x0139, 0x013A, 0x013A,
+    0x003B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0303, 0x0306, 0x0108, 0x000B, 0x010E, 0x0110, 0x0112,
+    0x0013, 0x0114, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011A,
+    0x001B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x34 */
+    0x0020, 0x0023, 0x0026, 0x0029, 0x002C, 0x002F, 0x0031, 0x0132,
+    0x0034, 0x0136, 0x0037, 0x0138, 0x0039, 0x013A, 0x013A, 0x013B,
+    0x003C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0003, 0x0006, 0x0009, 0x000C, 0x000F, 0x0011, 0x0112,
+    0x0014, 0x0116, 0x0017, 0x0118, 0x0019, 0x011A, 0x011A, 0x011B,
+    0x001C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x35 */
+    0x0020, 0x0323, 0x0326, 0x012A, 0x002D, 0x0130, 0x0132, 0x0133,
+    0x0035, 0x0137, 0x0138, 0x0139, 0x013A, 0x013B, 0x013B, 0x013C,
+    0x003D, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0303, 0x0306, 0x010A, 0x000D, 0x0110, 0x0112, 0x0113,
+    0x0015, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011B, 0x011C,
+    0x001D, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x36 */
+    0x0020, 0x0324, 0x0027, 0x012A, 0x002E, 0x0131, 0x0132, 0x0134,
+    0x0036, 0x0138, 0x0139, 0x013A, 0x013A, 0x013B, 0x013C, 0x013D,
+    0x003E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0304, 0x0007, 0x010A, 0x000E, 0x0111, 0x0112, 0x0114,
+    0x0016, 0x0118, 0x0119, 0x011A, 0x011A, 0x011B, 0x011C, 0x011D,
+    0x001E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x37 */
+    0x0020, 0x0324, 0x0328, 0x012B, 0x002F, 0x0131, 0x0133, 0x0135,
+    0x0037, 0x0138, 0x0139, 0x013A, 0x013B, 0x013C, 0x013D, 0x013E,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0304, 0x0308, 0x010B, 0x000F, 0x0111, 0x0113, 0x0115,
+    0x0017, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C, 0x011D, 0x011E,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x38 */
+    0x0020, 0x0024, 0x0028, 0x002C, 0x0030, 0x0032, 0x0034, 0x0036,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0004, 0x0008, 0x000C, 0x0010, 0x0012, 0x0014, 0x0016,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x39 */
+    0x0020, 0x0324, 0x0029, 0x012E, 0x0031, 0x0133, 0x0136, 0x0138,
+    0x0039, 0x013A, 0x013B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0304, 0x0009, 0x010E, 0x0011, 0x0113, 0x0116, 0x0118,
+    0x0019, 0x011A, 0x011B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x3A */
+    0x0020, 0x0025, 0x002A, 0x002F, 0x0032, 0x0134, 0x0037, 0x0139,
+    0x003A, 0x013B, 0x013C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0005, 0x000A, 0x000F, 0x0012, 0x0114, 0x0017, 0x0119,
+    0x001A, 0x011B, 0x011C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x3B */
+    0x0020, 0x0326, 0x002B, 0x0130, 0x0033, 0x0136, 0x0138, 0x013A,
+    0x003B, 0x013C, 0x013E, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0306, 0x000B, 0x0110, 0x0013, 0x0116, 0x0118, 0x011A,
+    0x001B, 0x011C, 0x011E, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x3C */
+    0x0020, 0x0026, 0x002C, 0x0031, 0x0034, 0x0037, 0x0039, 0x013A,
+    0x003C, 0x013E, 0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0006, 0x000C, 0x0011, 0x0014, 0x0017, 0x0019, 0x011A,
+    0x001C, 0x011E, 0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x3D */
+    0x0020, 0x0326, 0x002D, 0x0132, 0x0035, 0x0138, 0x013A, 0x013B,
+    0x003D, 0x013F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0306, 0x000D, 0x0112, 0x0015, 0x0118, 0x011A, 0x011B,
+    0x001D, 0x011F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x3E */
+    0x0020, 0x0027, 0x002E, 0x0132, 0x0036, 0x0139, 0x013A, 0x013C,
+    0x003E, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0007, 0x000E, 0x0112, 0x0016, 0x0119, 0x011A, 0x011C,
+    0x001E, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    /* a = 0x3F */
+    0x0020, 0x0328, 0x002F, 0x0133, 0x0037, 0x0139, 0x013B, 0x013D,
+    0x003F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x0000, 0x0308, 0x000F, 0x0113, 0x0017, 0x0119, 0x011B, 0x011D,
+    0x001F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F
+};
+
+const uint16_t softfloat_divE2M3[4096] = {
+    /* a = 0x00 */
+    0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    /* a = 0x01 */
+    0x081F, 0x0008, 0x0004, 0x0303, 0x0002, 0x0302, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x083F, 0x0028, 0x0024, 0x0323, 0x0022, 0x0322, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
+    0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
+    /* a = 0x02 */
+    0x081F, 0x0010, 0x0008, 0x0305, 0x0004, 0x0303, 0x0303, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x083F, 0x0030, 0x0028, 0x0325, 0x0024, 0x0323, 0x0323, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
+    /* a = 0x03 */
+    0x081F, 0x0014, 0x000C, 0x0008, 0x0006, 0x0305, 0x0004, 0x0303,
+    0x0003, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0301, 0x0301, 0x0301, 0x0001, 0x0301, 0x0301, 0x0301,
+    0x0301, 0x0301, 0x0301, 0x0301, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x083F, 0x0034, 0x002C, 0x0028, 0x0026, 0x0325, 0x0024, 0x0323,
+    0x0023, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322,
+    0x0322, 0x0321, 0x0321, 0x0321, 0x0021, 0x0321, 0x0321, 0x0321,
+    0x0321, 0x0321, 0x0321, 0x0321, 0x0320, 0x0320, 0x0320, 0x0320,
+    /* a = 0x04 */
+    0x081F, 0x0018, 0x0010, 0x010B, 0x0008, 0x0306, 0x0305, 0x0305,
+    0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x083F, 0x0038, 0x0030, 0x012B, 0x0028, 0x0326, 0x0325, 0x0325,
+    0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    /* a = 0x05 */
+    0x081F, 0x001A, 0x0012, 0x010D, 0x000A, 0x0008, 0x0307, 0x0306,
+    0x0005, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301, 0x0301,
+    0x0301, 0x0301, 0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x083F, 0x003A, 0x0032, 0x012D, 0x002A, 0x0028, 0x0327, 0x0326,
+    0x0025, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0323,
+    0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321, 0x0321,
+    0x0321, 0x0321, 0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    /* a = 0x06 */
+    0x081F, 0x001C, 0x0014, 0x0010, 0x000C, 0x010A, 0x0008, 0x0307,
+    0x0006, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303,
+    0x0003, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0301, 0x0301, 0x0301, 0x0001, 0x0301, 0x0301, 0x0301,
+    0x083F, 0x003C, 0x0034, 0x0030, 0x002C, 0x012A, 0x0028, 0x0327,
+    0x0026, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323,
+    0x0023, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322,
+    0x0322, 0x0321, 0x0321, 0x0321, 0x0021, 0x0321, 0x0321, 0x0321,
+    /* a = 0x07 */
+    0x081F, 0x001E, 0x0016, 0x0111, 0x000E, 0x010B, 0x0109, 0x0008,
+    0x0007, 0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304,
+    0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302,
+    0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0001, 0x0301,
+    0x083F, 0x003E, 0x0036, 0x0131, 0x002E, 0x012B, 0x0129, 0x0028,
+    0x0027, 0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324,
+    0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322,
+    0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0021, 0x0321,
+    /* a = 0x08 */
+    0x081F, 0x051F, 0x0018, 0x0113, 0x0010, 0x010D, 0x010B, 0x0109,
+    0x0008, 0x0307, 0x0306, 0x0306, 0x0305, 0x0305, 0x0305, 0x0304,
+    0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x083F, 0x053F, 0x0038, 0x0133, 0x0030, 0x012D, 0x012B, 0x0129,
+    0x0028, 0x0327, 0x0326, 0x0326, 0x0325, 0x0325, 0x0325, 0x0324,
+    0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    /* a = 0x09 */
+    0x081F, 0x051F, 0x0019, 0x0014, 0x0011, 0x010E, 0x000C, 0x010A,
+    0x0009, 0x0008, 0x0307, 0x0307, 0x0006, 0x0306, 0x0305, 0x0305,
+    0x0304, 0x0004, 0x0304, 0x0303, 0x0003, 0x0303, 0x0303, 0x0302,
+    0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301,
+    0x083F, 0x053F, 0x0039, 0x0034, 0x0031, 0x012E, 0x002C, 0x012A,
+    0x0029, 0x0028, 0x0327, 0x0327, 0x0026, 0x0326, 0x0325, 0x0325,
+    0x0324, 0x0024, 0x0324, 0x0323, 0x0023, 0x0323, 0x0323, 0x0322,
+    0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321,
+    /* a = 0x0A */
+    0x081F, 0x051F, 0x001A, 0x0115, 0x0012, 0x0010, 0x010D, 0x010B,
+    0x000A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306, 0x0305,
+    0x0005, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301, 0x0301,
+    0x083F, 0x053F, 0x003A, 0x0135, 0x0032, 0x0030, 0x012D, 0x012B,
+    0x002A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326, 0x0325,
+    0x0025, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0323,
+    0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321, 0x0321,
+    /* a = 0x0B */
+    0x081F, 0x051F, 0x001B, 0x0117, 0x0013, 0x0111, 0x010F, 0x010D,
+    0x000B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306,
+    0x0306, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303,
+    0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301,
+    0x083F, 0x053F, 0x003B, 0x0137, 0x0033, 0x0131, 0x012F, 0x012D,
+    0x002B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326,
+    0x0326, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323,
+    0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321,
+    /* a = 0x0C */
+    0x081F, 0x051F, 0x001C, 0x0018, 0x0014, 0x0112, 0x0010, 0x010E,
+    0x000C, 0x010B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306,
+    0x0006, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303,
+    0x0003, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302,
+    0x083F, 0x053F, 0x003C, 0x0038, 0x0034, 0x0132, 0x0030, 0x012E,
+    0x002C, 0x012B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326,
+    0x0026, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323,
+    0x0023, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322,
+    /* a = 0x0D */
+    0x081F, 0x051F, 0x001D, 0x0119, 0x0015, 0x0112, 0x0111, 0x010F,
+    0x000D, 0x010C, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307, 0x0307,
+    0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303,
+    0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302,
+    0x083F, 0x053F, 0x003D, 0x0139, 0x0035, 0x0132, 0x0131, 0x012F,
+    0x002D, 0x012C, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327, 0x0327,
+    0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323,
+    0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322,
+    /* a = 0x0E */
+    0x081F, 0x051F, 0x001E, 0x0119, 0x0016, 0x0113, 0x0111, 0x0010,
+    0x000E, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307,
+    0x0007, 0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304,
+    0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302,
+    0x083F, 0x053F, 0x003E, 0x0139, 0x0036, 0x0133, 0x0131, 0x0030,
+    0x002E, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327,
+    0x0027, 0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324,
+    0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322,
+    /* a = 0x0F */
+    0x081F, 0x051F, 0x001F, 0x001A, 0x0017, 0x0014, 0x0012, 0x0111,
+    0x000F, 0x010D, 0x000C, 0x010B, 0x000A, 0x0109, 0x0109, 0x0008,
+    0x0308, 0x0307, 0x0006, 0x0305, 0x0005, 0x0305, 0x0304, 0x0004,
+    0x0304, 0x0303, 0x0003, 0x0303, 0x0302, 0x0302, 0x0302, 0x0002,
+    0x083F, 0x053F, 0x003F, 0x003A, 0x0037, 0x0034, 0x0032, 0x0131,
+    0x002F, 0x012D, 0x002C, 0x012B, 0x002A, 0x0129, 0x0129, 0x0028,
+    0x0328, 0x0327, 0x0026, 0x0325, 0x0025, 0x0325, 0x0324, 0x0024,
+    0x0324, 0x0323, 0x0023, 0x0323, 0x0322, 0x0322, 0x0322, 0x0022,
+    /* a = 0x10 */
+    0x081F, 0x051F, 0x051F, 0x011B, 0x0018, 0x0115, 0x0113, 0x0111,
+    0x0010, 0x010E, 0x010D, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109,
+    0x0008, 0x0307, 0x0306, 0x0306, 0x0305, 0x0305, 0x0305, 0x0304,
+    0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0302,
+    0x083F, 0x053F, 0x053F, 0x013B, 0x0038, 0x0135, 0x0133, 0x0131,
+    0x0030, 0x012E, 0x012D, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129,
+    0x0028, 0x0327, 0x0326, 0x0326, 0x0325, 0x0325, 0x0325, 0x0324,
+    0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0322,
+    /* a = 0x11 */
+    0x081F, 0x051F, 0x051F, 0x001C, 0x0019, 0x0116, 0x0014, 0x0112,
+    0x0011, 0x0010, 0x010E, 0x010D, 0x000C, 0x010B, 0x010A, 0x010A,
+    0x0009, 0x0008, 0x0307, 0x0307, 0x0006, 0x0306, 0x0305, 0x0305,
+    0x0304, 0x0004, 0x0304, 0x0303, 0x0003, 0x0303, 0x0303, 0x0302,
+    0x083F, 0x053F, 0x053F, 0x003C, 0x0039, 0x0136, 0x0034, 0x0132,
+    0x0031, 0x0030, 0x012E, 0x012D, 0x002C, 0x012B, 0x012A, 0x012A,
+    0x0029, 0x0028, 0x0327, 0x0327, 0x0026, 0x0326, 0x0325, 0x0325,
+    0x0324, 0x0024, 0x0324, 0x0323, 0x0023, 0x0323, 0x0323, 0x0322,
+    /* a = 0x12 */
+    0x081F, 0x051F, 0x051F, 0x011D, 0x001A, 0x0018, 0x0115, 0x0113,
+    0x0012, 0x0111, 0x0010, 0x010F, 0x010D, 0x010C, 0x010B, 0x010B,
+    0x000A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306, 0x0305,
+    0x0005, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x083F, 0x053F, 0x053F, 0x013D, 0x003A, 0x0038, 0x0135, 0x0133,
+    0x0032, 0x0131, 0x0030, 0x012F, 0x012D, 0x012C, 0x012B, 0x012B,
+    0x002A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326, 0x0325,
+    0x0025, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0323,
+    /* a = 0x13 */
+    0x081F, 0x051F, 0x051F, 0x011F, 0x001B, 0x0119, 0x0117, 0x0115,
+    0x0013, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D, 0x010C,
+    0x000B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306,
+    0x0306, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303,
+    0x083F, 0x053F, 0x053F, 0x013F, 0x003B, 0x0139, 0x0137, 0x0135,
+    0x0033, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D, 0x012C,
+    0x002B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326,
+    0x0326, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323,
+    /* a = 0x14 */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001C, 0x011A, 0x0018, 0x0116,
+    0x0014, 0x0113, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D,
+    0x000C, 0x010B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306,
+    0x0006, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003C, 0x013A, 0x0038, 0x0136,
+    0x0034, 0x0133, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D,
+    0x002C, 0x012B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326,
+    0x0026, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323,
+    /* a = 0x15 */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001D, 0x011A, 0x0119, 0x0117,
+    0x0015, 0x0114, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F, 0x010E,
+    0x000D, 0x010C, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307, 0x0307,
+    0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003D, 0x013A, 0x0139, 0x0137,
+    0x0035, 0x0134, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F, 0x012E,
+    0x002D, 0x012C, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327, 0x0327,
+    0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323,
+    /* a = 0x16 */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001E, 0x011B, 0x0119, 0x0018,
+    0x0016, 0x0114, 0x0113, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F,
+    0x000E, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307,
+    0x0007, 0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003E, 0x013B, 0x0139, 0x0038,
+    0x0036, 0x0134, 0x0133, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F,
+    0x002E, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327,
+    0x0027, 0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324,
+    /* a = 0x17 */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001F, 0x001C, 0x001A, 0x0119,
+    0x0017, 0x0115, 0x0014, 0x0113, 0x0012, 0x0111, 0x0111, 0x0010,
+    0x000F, 0x010D, 0x000C, 0x010B, 0x000A, 0x0109, 0x0109, 0x0008,
+    0x0308, 0x0307, 0x0006, 0x0305, 0x0005, 0x0305, 0x0304, 0x0004,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003F, 0x003C, 0x003A, 0x0139,
+    0x0037, 0x0135, 0x0034, 0x0133, 0x0032, 0x0131, 0x0131, 0x0030,
+    0x002F, 0x012D, 0x002C, 0x012B, 0x002A, 0x0129, 0x0129, 0x0028,
+    0x0328, 0x0327, 0x0026, 0x0325, 0x0025, 0x0325, 0x0324, 0x0024,
+    /* a = 0x18 */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011D, 0x011B, 0x0119,
+    0x0018, 0x0116, 0x0115, 0x0114, 0x0113, 0x0112, 0x0111, 0x0111,
+    0x0010, 0x010E, 0x010D, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109,
+    0x0008, 0x0307, 0x0306, 0x0306, 0x0305, 0x0305, 0x0305, 0x0304,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013D, 0x013B, 0x0139,
+    0x0038, 0x0136, 0x0135, 0x0134, 0x0133, 0x0132, 0x0131, 0x0131,
+    0x0030, 0x012E, 0x012D, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129,
+    0x0028, 0x0327, 0x0326, 0x0326, 0x0325, 0x0325, 0x0325, 0x0324,
+    /* a = 0x19 */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011E, 0x001C, 0x011A,
+    0x0019, 0x0018, 0x0116, 0x0115, 0x0014, 0x0113, 0x0112, 0x0112,
+    0x0011, 0x0010, 0x010E, 0x010D, 0x000C, 0x010B, 0x010A, 0x010A,
+    0x0009, 0x0008, 0x0307, 0x0307, 0x0006, 0x0306, 0x0305, 0x0305,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013E, 0x003C, 0x013A,
+    0x0039, 0x0038, 0x0136, 0x0135, 0x0034, 0x0133, 0x0132, 0x0132,
+    0x0031, 0x0030, 0x012E, 0x012D, 0x002C, 0x012B, 0x012A, 0x012A,
+    0x0029, 0x0028, 0x0327, 0x0327, 0x0026, 0x0326, 0x0325, 0x0325,
+    /* a = 0x1A */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011D, 0x011B,
+    0x001A, 0x0119, 0x0018, 0x0117, 0x0115, 0x0114, 0x0113, 0x0113,
+    0x0012, 0x0111, 0x0010, 0x010F, 0x010D, 0x010C, 0x010B, 0x010B,
+    0x000A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306, 0x0305,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013D, 0x013B,
+    0x003A, 0x0139, 0x0038, 0x0137, 0x0135, 0x0134, 0x0133, 0x0133,
+    0x0032, 0x0131, 0x0030, 0x012F, 0x012D, 0x012C, 0x012B, 0x012B,
+    0x002A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326, 0x0325,
+    /* a = 0x1B */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011F, 0x011D,
+    0x001B, 0x011A, 0x0119, 0x0018, 0x0117, 0x0116, 0x0115, 0x0114,
+    0x0013, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D, 0x010C,
+    0x000B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013F, 0x013D,
+    0x003B, 0x013A, 0x0139, 0x0038, 0x0137, 0x0136, 0x0135, 0x0134,
+    0x0033, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D, 0x012C,
+    0x002B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326,
+    /* a = 0x1C */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011E,
+    0x001C, 0x011B, 0x011A, 0x0119, 0x0018, 0x0117, 0x0116, 0x0115,
+    0x0014, 0x0113, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D,
+    0x000C, 0x010B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013E,
+    0x003C, 0x013B, 0x013A, 0x0139, 0x0038, 0x0137, 0x0136, 0x0135,
+    0x0034, 0x0133, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D,
+    0x002C, 0x012B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326,
+    /* a = 0x1D */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011F,
+    0x001D, 0x011C, 0x011A, 0x0119, 0x0119, 0x0018, 0x0117, 0x0116,
+    0x0015, 0x0114, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F, 0x010E,
+    0x000D, 0x010C, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307, 0x0307,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013F,
+    0x003D, 0x013C, 0x013A, 0x0139, 0x0139, 0x0038, 0x0137, 0x0136,
+    0x0035, 0x0134, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F, 0x012E,
+    0x002D, 0x012C, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327, 0x0327,
+    /* a = 0x1E */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001E, 0x011C, 0x011B, 0x011A, 0x0119, 0x0119, 0x0018, 0x0117,
+    0x0016, 0x0114, 0x0113, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F,
+    0x000E, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x003E, 0x013C, 0x013B, 0x013A, 0x0139, 0x0139, 0x0038, 0x0137,
+    0x0036, 0x0134, 0x0133, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F,
+    0x002E, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327,
+    /* a = 0x1F */
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001F, 0x011D, 0x001C, 0x011B, 0x001A, 0x0119, 0x0119, 0x0018,
+    0x0017, 0x0115, 0x0014, 0x0113, 0x0012, 0x0111, 0x0111, 0x0010,
+    0x000F, 0x010D, 0x000C, 0x010B, 0x000A, 0x0109, 0x0109, 0x0008,
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x003F, 0x013D, 0x003C, 0x013B, 0x003A, 0x0139, 0x0139, 0x0038,
+    0x0037, 0x0135, 0x0034, 0x0133, 0x0032, 0x0131, 0x0131, 0x0030,
+    0x002F, 0x012D, 0x002C, 0x012B, 0x002A, 0x0129, 0x0129, 0x0028,
+    /* a = 0x20 */
+    0x1000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    /* a = 0x21 */
+    0x083F, 0x0028, 0x0024, 0x0323, 0x0022, 0x0322, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
+    0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
+    0x081F, 0x0008, 0x0004, 0x0303, 0x0002, 0x0302, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    /* a = 0x22 */
+    0x083F, 0x0030, 0x0028, 0x0325, 0x0024, 0x0323, 0x0323, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
+    0x081F, 0x0010, 0x0008, 0x0305, 0x0004, 0x0303, 0x0303, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,
+    /* a = 0x23 */
+    0x083F, 0x0034, 0x002C, 0x0028, 0x0026, 0x0325, 0x0024, 0x0323,
+    0x0023, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322,
+    0x0322, 0x0321, 0x0321, 0x0321, 0x0021, 0x0321, 0x0321, 0x0321,
+    0x0321, 0x0321, 0x0321, 0x0321, 0x0320, 0x0320, 0x0320, 0x0320,
+    0x081F, 0x0014, 0x000C, 0x0008, 0x0006, 0x0305, 0x0004, 0x0303,
+    0x0003, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0301, 0x0301, 0x0301, 0x0001, 0x0301, 0x0301, 0x0301,
+    0x0301, 0x0301, 0x0301, 0x0301, 0x0300, 0x0300, 0x0300, 0x0300,
+    /* a = 0x24 */
+    0x083F, 0x0038, 0x0030, 0x012B, 0x0028, 0x0326, 0x0325, 0x0325,
+    0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x081F, 0x0018, 0x0010, 0x010B, 0x0008, 0x0306, 0x0305, 0x0305,
+    0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    /* a = 0x25 */
+    0x083F, 0x003A, 0x0032, 0x012D, 0x002A, 0x0028, 0x0327, 0x0326,
+    0x0025, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0323,
+    0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321, 0x0321,
+    0x0321, 0x0321, 0x0021, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x081F, 0x001A, 0x0012, 0x010D, 0x000A, 0x0008, 0x0307, 0x0306,
+    0x0005, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301, 0x0301,
+    0x0301, 0x0301, 0x0001, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    /* a = 0x26 */
+    0x083F, 0x003C, 0x0034, 0x0030, 0x002C, 0x012A, 0x0028, 0x0327,
+    0x0026, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323,
+    0x0023, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322,
+    0x0322, 0x0321, 0x0321, 0x0321, 0x0021, 0x0321, 0x0321, 0x0321,
+    0x081F, 0x001C, 0x0014, 0x0010, 0x000C, 0x010A, 0x0008, 0x0307,
+    0x0006, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303,
+    0x0003, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0301, 0x0301, 0x0301, 0x0001, 0x0301, 0x0301, 0x0301,
+    /* a = 0x27 */
+    0x083F, 0x003E, 0x0036, 0x0131, 0x002E, 0x012B, 0x0129, 0x0028,
+    0x0027, 0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324,
+    0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322,
+    0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0021, 0x0321,
+    0x081F, 0x001E, 0x0016, 0x0111, 0x000E, 0x010B, 0x0109, 0x0008,
+    0x0007, 0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304,
+    0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302,
+    0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0001, 0x0301,
+    /* a = 0x28 */
+    0x083F, 0x053F, 0x0038, 0x0133, 0x0030, 0x012D, 0x012B, 0x0129,
+    0x0028, 0x0327, 0x0326, 0x0326, 0x0325, 0x0325, 0x0325, 0x0324,
+    0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0322,
+    0x0022, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321, 0x0321, 0x0321,
+    0x081F, 0x051F, 0x0018, 0x0113, 0x0010, 0x010D, 0x010B, 0x0109,
+    0x0008, 0x0307, 0x0306, 0x0306, 0x0305, 0x0305, 0x0305, 0x0304,
+    0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0302,
+    0x0002, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301, 0x0301, 0x0301,
+    /* a = 0x29 */
+    0x083F, 0x053F, 0x0039, 0x0034, 0x0031, 0x012E, 0x002C, 0x012A,
+    0x0029, 0x0028, 0x0327, 0x0327, 0x0026, 0x0326, 0x0325, 0x0325,
+    0x0324, 0x0024, 0x0324, 0x0323, 0x0023, 0x0323, 0x0323, 0x0322,
+    0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321, 0x0321, 0x0321,
+    0x081F, 0x051F, 0x0019, 0x0014, 0x0011, 0x010E, 0x000C, 0x010A,
+    0x0009, 0x0008, 0x0307, 0x0307, 0x0006, 0x0306, 0x0305, 0x0305,
+    0x0304, 0x0004, 0x0304, 0x0303, 0x0003, 0x0303, 0x0303, 0x0302,
+    0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301, 0x0301, 0x0301,
+    /* a = 0x2A */
+    0x083F, 0x053F, 0x003A, 0x0135, 0x0032, 0x0030, 0x012D, 0x012B,
+    0x002A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326, 0x0325,
+    0x0025, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0323,
+    0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321, 0x0321,
+    0x081F, 0x051F, 0x001A, 0x0115, 0x0012, 0x0010, 0x010D, 0x010B,
+    0x000A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306, 0x0305,
+    0x0005, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301, 0x0301,
+    /* a = 0x2B */
+    0x083F, 0x053F, 0x003B, 0x0137, 0x0033, 0x0131, 0x012F, 0x012D,
+    0x002B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326,
+    0x0326, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323,
+    0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322, 0x0321,
+    0x081F, 0x051F, 0x001B, 0x0117, 0x0013, 0x0111, 0x010F, 0x010D,
+    0x000B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306,
+    0x0306, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303,
+    0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302, 0x0301,
+    /* a = 0x2C */
+    0x083F, 0x053F, 0x003C, 0x0038, 0x0034, 0x0132, 0x0030, 0x012E,
+    0x002C, 0x012B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326,
+    0x0026, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323,
+    0x0023, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322, 0x0322,
+    0x081F, 0x051F, 0x001C, 0x0018, 0x0014, 0x0112, 0x0010, 0x010E,
+    0x000C, 0x010B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306,
+    0x0006, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303,
+    0x0003, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302, 0x0302,
+    /* a = 0x2D */
+    0x083F, 0x053F, 0x003D, 0x0139, 0x0035, 0x0132, 0x0131, 0x012F,
+    0x002D, 0x012C, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327, 0x0327,
+    0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323,
+    0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322, 0x0322,
+    0x081F, 0x051F, 0x001D, 0x0119, 0x0015, 0x0112, 0x0111, 0x010F,
+    0x000D, 0x010C, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307, 0x0307,
+    0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303,
+    0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302, 0x0302,
+    /* a = 0x2E */
+    0x083F, 0x053F, 0x003E, 0x0139, 0x0036, 0x0133, 0x0131, 0x0030,
+    0x002E, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327,
+    0x0027, 0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324,
+    0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0022, 0x0322,
+    0x081F, 0x051F, 0x001E, 0x0119, 0x0016, 0x0113, 0x0111, 0x0010,
+    0x000E, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307,
+    0x0007, 0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304,
+    0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0002, 0x0302,
+    /* a = 0x2F */
+    0x083F, 0x053F, 0x003F, 0x003A, 0x0037, 0x0034, 0x0032, 0x0131,
+    0x002F, 0x012D, 0x002C, 0x012B, 0x002A, 0x0129, 0x0129, 0x0028,
+    0x0328, 0x0327, 0x0026, 0x0325, 0x0025, 0x0325, 0x0324, 0x0024,
+    0x0324, 0x0323, 0x0023, 0x0323, 0x0322, 0x0322, 0x0322, 0x0022,
+    0x081F, 0x051F, 0x001F, 0x001A, 0x0017, 0x0014, 0x0012, 0x0111,
+    0x000F, 0x010D, 0x000C, 0x010B, 0x000A, 0x0109, 0x0109, 0x0008,
+    0x0308, 0x0307, 0x0006, 0x0305, 0x0005, 0x0305, 0x0304, 0x0004,
+    0x0304, 0x0303, 0x0003, 0x0303, 0x0302, 0x0302, 0x0302, 0x0002,
+    /* a = 0x30 */
+    0x083F, 0x053F, 0x053F, 0x013B, 0x0038, 0x0135, 0x0133, 0x0131,
+    0x0030, 0x012E, 0x012D, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129,
+    0x0028, 0x0327, 0x0326, 0x0326, 0x0325, 0x0325, 0x0325, 0x0324,
+    0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0322, 0x0322, 0x0322,
+    0x081F, 0x051F, 0x051F, 0x011B, 0x0018, 0x0115, 0x0113, 0x0111,
+    0x0010, 0x010E, 0x010D, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109,
+    0x0008, 0x0307, 0x0306, 0x0306, 0x0305, 0x0305, 0x0305, 0x0304,
+    0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0302, 0x0302, 0x0302,
+    /* a = 0x31 */
+    0x083F, 0x053F, 0x053F, 0x003C, 0x0039, 0x0136, 0x0034, 0x0132,
+    0x0031, 0x0030, 0x012E, 0x012D, 0x002C, 0x012B, 0x012A, 0x012A,
+    0x0029, 0x0028, 0x0327, 0x0327, 0x0026, 0x0326, 0x0325, 0x0325,
+    0x0324, 0x0024, 0x0324, 0x0323, 0x0023, 0x0323, 0x0323, 0x0322,
+    0x081F, 0x051F, 0x051F, 0x001C, 0x0019, 0x0116, 0x0014, 0x0112,
+    0x0011, 0x0010, 0x010E, 0x010D, 0x000C, 0x010B, 0x010A, 0x010A,
+    0x0009, 0x0008, 0x0307, 0x0307, 0x0006, 0x0306, 0x0305, 0x0305,
+    0x0304, 0x0004, 0x0304, 0x0303, 0x0003, 0x0303, 0x0303, 0x0302,
+    /* a = 0x32 */
+    0x083F, 0x053F, 0x053F, 0x013D, 0x003A, 0x0038, 0x0135, 0x0133,
+    0x0032, 0x0131, 0x0030, 0x012F, 0x012D, 0x012C, 0x012B, 0x012B,
+    0x002A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326, 0x0325,
+    0x0025, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323, 0x0323,
+    0x081F, 0x051F, 0x051F, 0x011D, 0x001A, 0x0018, 0x0115, 0x0113,
+    0x0012, 0x0111, 0x0010, 0x010F, 0x010D, 0x010C, 0x010B, 0x010B,
+    0x000A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306, 0x0305,
+    0x0005, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303, 0x0303,
+    /* a = 0x33 */
+    0x083F, 0x053F, 0x053F, 0x013F, 0x003B, 0x0139, 0x0137, 0x0135,
+    0x0033, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D, 0x012C,
+    0x002B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326,
+    0x0326, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323, 0x0323,
+    0x081F, 0x051F, 0x051F, 0x011F, 0x001B, 0x0119, 0x0117, 0x0115,
+    0x0013, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D, 0x010C,
+    0x000B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306,
+    0x0306, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303, 0x0303,
+    /* a = 0x34 */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003C, 0x013A, 0x0038, 0x0136,
+    0x0034, 0x0133, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D,
+    0x002C, 0x012B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326,
+    0x0026, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323, 0x0323,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001C, 0x011A, 0x0018, 0x0116,
+    0x0014, 0x0113, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D,
+    0x000C, 0x010B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306,
+    0x0006, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303, 0x0303,
+    /* a = 0x35 */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003D, 0x013A, 0x0139, 0x0137,
+    0x0035, 0x0134, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F, 0x012E,
+    0x002D, 0x012C, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327, 0x0327,
+    0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324, 0x0323,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001D, 0x011A, 0x0119, 0x0117,
+    0x0015, 0x0114, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F, 0x010E,
+    0x000D, 0x010C, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307, 0x0307,
+    0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304, 0x0303,
+    /* a = 0x36 */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003E, 0x013B, 0x0139, 0x0038,
+    0x0036, 0x0134, 0x0133, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F,
+    0x002E, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327,
+    0x0027, 0x0326, 0x0326, 0x0325, 0x0325, 0x0324, 0x0024, 0x0324,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001E, 0x011B, 0x0119, 0x0018,
+    0x0016, 0x0114, 0x0113, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F,
+    0x000E, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307,
+    0x0007, 0x0306, 0x0306, 0x0305, 0x0305, 0x0304, 0x0004, 0x0304,
+    /* a = 0x37 */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x003F, 0x003C, 0x003A, 0x0139,
+    0x0037, 0x0135, 0x0034, 0x0133, 0x0032, 0x0131, 0x0131, 0x0030,
+    0x002F, 0x012D, 0x002C, 0x012B, 0x002A, 0x0129, 0x0129, 0x0028,
+    0x0328, 0x0327, 0x0026, 0x0325, 0x0025, 0x0325, 0x0324, 0x0024,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x001F, 0x001C, 0x001A, 0x0119,
+    0x0017, 0x0115, 0x0014, 0x0113, 0x0012, 0x0111, 0x0111, 0x0010,
+    0x000F, 0x010D, 0x000C, 0x010B, 0x000A, 0x0109, 0x0109, 0x0008,
+    0x0308, 0x0307, 0x0006, 0x0305, 0x0005, 0x0305, 0x0304, 0x0004,
+    /* a = 0x38 */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013D, 0x013B, 0x0139,
+    0x0038, 0x0136, 0x0135, 0x0134, 0x0133, 0x0132, 0x0131, 0x0131,
+    0x0030, 0x012E, 0x012D, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129,
+    0x0028, 0x0327, 0x0326, 0x0326, 0x0325, 0x0325, 0x0325, 0x0324,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011D, 0x011B, 0x0119,
+    0x0018, 0x0116, 0x0115, 0x0114, 0x0113, 0x0112, 0x0111, 0x0111,
+    0x0010, 0x010E, 0x010D, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109,
+    0x0008, 0x0307, 0x0306, 0x0306, 0x0305, 0x0305, 0x0305, 0x0304,
+    /* a = 0x39 */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013E, 0x003C, 0x013A,
+    0x0039, 0x0038, 0x0136, 0x0135, 0x0034, 0x0133, 0x0132, 0x0132,
+    0x0031, 0x0030, 0x012E, 0x012D, 0x002C, 0x012B, 0x012A, 0x012A,
+    0x0029, 0x0028, 0x0327, 0x0327, 0x0026, 0x0326, 0x0325, 0x0325,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011E, 0x001C, 0x011A,
+    0x0019, 0x0018, 0x0116, 0x0115, 0x0014, 0x0113, 0x0112, 0x0112,
+    0x0011, 0x0010, 0x010E, 0x010D, 0x000C, 0x010B, 0x010A, 0x010A,
+    0x0009, 0x0008, 0x0307, 0x0307, 0x0006, 0x0306, 0x0305, 0x0305,
+    /* a = 0x3A */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013D, 0x013B,
+    0x003A, 0x0139, 0x0038, 0x0137, 0x0135, 0x0134, 0x0133, 0x0133,
+    0x0032, 0x0131, 0x0030, 0x012F, 0x012D, 0x012C, 0x012B, 0x012B,
+    0x002A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326, 0x0325,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011D, 0x011B,
+    0x001A, 0x0119, 0x0018, 0x0117, 0x0115, 0x0114, 0x0113, 0x0113,
+    0x0012, 0x0111, 0x0010, 0x010F, 0x010D, 0x010C, 0x010B, 0x010B,
+    0x000A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306, 0x0305,
+    /* a = 0x3B */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013F, 0x013D,
+    0x003B, 0x013A, 0x0139, 0x0038, 0x0137, 0x0136, 0x0135, 0x0134,
+    0x0033, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D, 0x012C,
+    0x002B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326, 0x0326,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011F, 0x011D,
+    0x001B, 0x011A, 0x0119, 0x0018, 0x0117, 0x0116, 0x0115, 0x0114,
+    0x0013, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D, 0x010C,
+    0x000B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306, 0x0306,
+    /* a = 0x3C */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013E,
+    0x003C, 0x013B, 0x013A, 0x0139, 0x0038, 0x0137, 0x0136, 0x0135,
+    0x0034, 0x0133, 0x0132, 0x0131, 0x0030, 0x012F, 0x012E, 0x012D,
+    0x002C, 0x012B, 0x012A, 0x0129, 0x0028, 0x0327, 0x0327, 0x0326,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011E,
+    0x001C, 0x011B, 0x011A, 0x0119, 0x0018, 0x0117, 0x0116, 0x0115,
+    0x0014, 0x0113, 0x0112, 0x0111, 0x0010, 0x010F, 0x010E, 0x010D,
+    0x000C, 0x010B, 0x010A, 0x0109, 0x0008, 0x0307, 0x0307, 0x0306,
+    /* a = 0x3D */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x013F,
+    0x003D, 0x013C, 0x013A, 0x0139, 0x0139, 0x0038, 0x0137, 0x0136,
+    0x0035, 0x0134, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F, 0x012E,
+    0x002D, 0x012C, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327, 0x0327,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x011F,
+    0x001D, 0x011C, 0x011A, 0x0119, 0x0119, 0x0018, 0x0117, 0x0116,
+    0x0015, 0x0114, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F, 0x010E,
+    0x000D, 0x010C, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307, 0x0307,
+    /* a = 0x3E */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x003E, 0x013C, 0x013B, 0x013A, 0x0139, 0x0139, 0x0038, 0x0137,
+    0x0036, 0x0134, 0x0133, 0x0132, 0x0131, 0x0131, 0x0030, 0x012F,
+    0x002E, 0x012C, 0x012B, 0x012A, 0x0129, 0x0129, 0x0028, 0x0327,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001E, 0x011C, 0x011B, 0x011A, 0x0119, 0x0119, 0x0018, 0x0117,
+    0x0016, 0x0114, 0x0113, 0x0112, 0x0111, 0x0111, 0x0010, 0x010F,
+    0x000E, 0x010C, 0x010B, 0x010A, 0x0109, 0x0109, 0x0008, 0x0307,
+    /* a = 0x3F */
+    0x083F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F, 0x053F,
+    0x003F, 0x013D, 0x003C, 0x013B, 0x003A, 0x0139, 0x0139, 0x0038,
+    0x0037, 0x0135, 0x0034, 0x0133, 0x0032, 0x0131, 0x0131, 0x0030,
+    0x002F, 0x012D, 0x002C, 0x012B, 0x002A, 0x0129, 0x0129, 0x0028,
+    0x081F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F, 0x051F,
+    0x001F, 0x011D, 0x001C, 0x011B, 0x001A, 0x0119, 0x0119, 0x0018,
+    0x0017, 0x0115, 0x0014, 0x0113, 0x0012, 0x0111, 0x0111, 0x0010,
+    0x000F, 0x010D, 0x000C, 0x010B, 0x000A, 0x0109, 0x0109, 0x0008
+};
+
+const uint16_t softfloat_sqrtE2M3[64] = {
+    0x0000, 0x0303, 0x0004, 0x0305, 0x0306, 0x0306, 0x0307, 0x0307,
+    0x0008, 0x0108, 0x0109, 0x0109, 0x010A, 0x010A, 0x010B, 0x010B,
+    0x010B, 0x000C, 0x010D, 0x010D, 0x010E, 0x010E, 0x010F, 0x010F,
+    0x0010, 0x0110, 0x0111, 0x0111, 0x0112, 0x0112, 0x0113, 0x0113,
+    0x0020, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000
+};
+
@@ -0,0 +1,78 @@
+
+/*============================================================================
+
+This C source file is part of the SoftFloat IEEE Floating-Point Arithmetic
+Package, Release 3c, by John R. Hauser.
+
+Copyright 2011, 2012, 2013, 2014, 2015, 2016 The Regents of the University of
+California.  All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+ 1. Redistributions of source code must retain the above copyright notice,
+    this list of conditions, and the following disclaimer.
+
+ 2. Redistributions in binary form must reproduce the above copyright notice,
+    this list of conditions, and the following disclaimer in the documentation
+    and/or other materials provided with the distribution.
+
+ 3. Neither the name of the University nor the names of its contributors may
+    be used to endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE REGENTS AND CONTRIBUTORS "AS IS", AND ANY
+EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE, ARE
+DISCLAIMED.  IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+=============================================================================*/
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform.h"
+#include "internals.h"
+#include "softfloat.h"
+
+struct exp16_sig32
+ softfloat_unpackPositUI( uint_fast8_t n, uint_fast8_t es, uint_fast32_t uiA )
+{
+    uint32_t bits;
+    bool regimeOnes;
+    int_fast8_t count, k;
+    uint64_t rest;
+    int_fast16_t exp;
+    struct exp16_sig32 z;
+
+    /*------------------------------------------------------------------------
+    | 'uiA' is a positive posit.  The regime is the run of equal bits after
+    | the sign; the exponent and fraction follow its terminating bit.
+    *------------------------------------------------------------------------*/
+    bits = (uint32_t) (uiA<<(33 - n));
+    regimeOnes = bits>>31;
+    if ( regimeOnes ) {
+        count = softfloat_countLeadingZeros32( ~bits );
+        k = count - 1;
+    } else {
+        count = softfloat_countLeadingZeros32( bits );
+        k = -count;
+    }
+    rest = (uint64_t) bits<<32<<(count + 1);
+    exp = 0;
+    if ( es ) {
+        exp = rest>>(64 - es);
+        rest <<= es;
+    }
+    z.exp = k * ((int_fast16_t) 1<<es) + exp;
+    z.sig = 0x40000000 | (uint32_t) (rest>>34);
+    return z;
+
+}
+
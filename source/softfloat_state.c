@@ -48,5 +48,10 @@ THREAD_LOCAL uint_fast8_t softfloat_roundingMode = softfloat_round_near_even;
 THREAD_LOCAL uint_fast8_t softfloat_detectTininess = init_detectTininess;
 THREAD_LOCAL uint_fast8_t softfloat_exceptionFlags = 0;
 
+THREAD_LOCAL uint_fast64_t softfloat_stochasticSeed = 0;
+THREAD_LOCAL uint_fast64_t softfloat_stochasticCounter = 0;
+
 THREAD_LOCAL uint_fast8_t extF80_roundingPrecision = 80;
 
+THREAD_LOCAL uint_fast8_t e4m3_overflowMode = e4m3_overflow_nan;
+
@@ -0,0 +1,62 @@
+#include "softfloat.hpp"
+#include <stdio.h>
+
+/*
+ * Sign operations and classification of float128_t as seen by a user of the
+ * public headers alone.  The word holding the sign must be found without the
+ * build's platform.h, which such users never include.
+ *
+ * To compile:
+ * g++ test_f128_sign.cpp -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -o test_f128_sign
+ */
+
+#ifdef LITTLEENDIAN
+#error "test_f128_sign must be compiled without platform.h"
+#endif
+
+static int failures = 0;
+
+static bool eq(float128_t a, float128_t b)
+{
+    return f128M_eq(&a, &b);
+}
+
+static void check(bool ok, const char *what)
+{
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        ++failures;
+    }
+}
+
+int main()
+{
+    float128_t one, minusOne, zero, nan, inf;
+    i32_to_f128M(1, &one);
+    i32_to_f128M(-1, &minusOne);
+    i32_to_f128M(0, &zero);
+    f128M_div(&zero, &zero, &nan);
+    f128M_div(&one, &zero, &inf);
+
+    check(eq(f128_neg(one), minusOne), "f128_neg(1) == -1");
+    check(eq(f128_abs(minusOne), one), "f128_abs(-1) == 1");
+    check(eq(f128_copySign(one, minusOne), minusOne), "f128_copySign(1, -1) == -1");
+    check(!f128_signbit(one) && f128_signbit(minusOne), "f128_signbit");
+    check(f128_signbit(f128_neg(zero)), "f128_signbit(-0)");
+    check(f128_isNaN(nan) && !f128_isNaN(inf) && !f128_isNaN(one), "f128_isNaN");
+    check(f128_isInf(inf) && !f128_isInf(nan) && !f128_isInf(one), "f128_isInf");
+    check(f128_classify(minusOne) == softfloat_class_negNormal, "f128_classify(-1)");
+    check(f128_classify(inf) == softfloat_class_posInf, "f128_classify(+inf)");
+
+    float128_t z;
+    f128M_neg(&one, &z);
+    check(f128M_eq(&z, &minusOne), "f128M_neg(1) == -1");
+
+    check(-float128(1.0) < float128(0.0), "-float128(1.0) < 0");
+    check(-float128(1.0) == float128(-1.0), "-float128(1.0) == -1");
+
+    if (failures)
+        return 1;
+    printf("test_f128_sign: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "softfloat.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Round-to-nearest-even batch conversions between float32_t/float16_t and
+ * fixed point, which take a vectorized path for chunks of ordinary elements.
+ * Every batch must give the results and flags of the same elements widened
+ * to float64_t and converted through f64_to_fixed_array, or converted by
+ * fixed_to_f64_array and rounded with f64_to_f32/f64_to_f16.  The batches mix
+ * values in range with ties, saturating values, NaNs, infinities and
+ * subnormal results.
+ *
+ * To compile:
+ * gcc test_fixed_array.c -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -o test_fixed_array
+ */
+
+#define BATCHES 20000
+#define MAXN 600
+
+static const int size[] = { 1, 1, 2, 4 };
+static unsigned long long state = 0x2545F4914F6CDD1DULL;
+static int failures = 0;
+
+static unsigned long rnd(void)
+{
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return (unsigned long) (state >> 32);
+}
+
+/* Biased exponent near the integer range of 'type' scaled by 2^-fracBits */
+static long nearExp(int type, int fracBits, long bias, long expMax)
+{
+	static const int bits[] = { 7, 8, 15, 31 };
+	long e = bias - fracBits + (long) (rnd() % (bits[type] + 3)) - 2;
+
+	if (rnd() % 8 == 0)
+		e += (long) (rnd() % 40) - 20;
+	return (e < 0) ? 0 : (e > expMax) ? expMax : e;
+}
+
+static void check(const char *what, int type, int fracBits, size_t n, const void *got, const void *expected, size_t bytes, int gotFlags, int expectedFlags)
+{
+	if (memcmp(got, expected, bytes) || (gotFlags != expectedFlags)) {
+		if (failures < 10)
+			printf("FAIL: %s, type %d, fracBits %d, %lu elements (flags %x, expected %x)\n", what, type, fracBits, (unsigned long) n, gotFlags, expectedFlags);
+		++failures;
+	}
+}
+
+int main(void)
+{
+	static float32_t a32[MAXN], z32[MAXN], e32[MAXN];
+	static float16_t a16[MAXN], z16[MAXN], e16[MAXN];
+	static float64_t a64[MAXN];
+	static unsigned char fix[MAXN * 4], z[MAXN * 4], e[MAXN * 4];
+	long batch;
+	size_t i, n;
+	int type, fracBits, flags;
+
+	softfloat_roundingMode = softfloat_round_near_even;
+	for (batch = 0; batch < BATCHES; ++batch) {
+		type = (int) (rnd() % 4);
+		fracBits = (int) (rnd() % 24) - 4;
+		n = 1 + rnd() % ((batch % 8) ? 40 : MAXN);
+		for (i = 0; i < n; ++i) {
+			unsigned long r = rnd();
+			long v;
+
+			a32[i].v = (uint32_t) ((r & 0x807FFFFF) | ((unsigned long) nearExp(type, fracBits, 127, 255) << 23));
+			a16[i].v = (uint16_t) ((r & 0x83FF) | ((unsigned long) nearExp(type, fracBits, 15, 31) << 10));
+			if (rnd() % 4 == 0) {
+				/* Ties and exact values: clear the low bits */
+				a32[i].v &= ~(uint32_t) ((1UL << (rnd() % 24)) - 1);
+				a16[i].v &= ~(uint16_t) ((1UL << (rnd() % 11)) - 1);
+			}
+			v = (long) rnd() >> (rnd() % 32);
+			memcpy(fix + i * size[type], &v, size[type]);
+		}
+
+		softfloat_exceptionFlags = 0;
+		f32_to_fixed_array(type, fracBits, a32, z, n);
+		flags = softfloat_exceptionFlags;
+		softfloat_exceptionFlags = 0;
+		for (i = 0; i < n; ++i)
+			a64[i] = f32_to_f64(a32[i]);
+		f64_to_fixed_array(type, fracBits, a64, e, n);
+		check("f32_to_fixed_array", type, fracBits, n, z, e, n * size[type], flags, softfloat_exceptionFlags);
+
+		softfloat_exceptionFlags = 0;
+		f16_to_fixed_array(type, fracBits, a16, z, n);
+		flags = softfloat_exceptionFlags;
+		softfloat_exceptionFlags = 0;
+		for (i = 0; i < n; ++i)
+			a64[i] = f16_to_f64(a16[i]);
+		f64_to_fixed_array(type, fracBits, a64, e, n);
+		check("f16_to_fixed_array", type, fracBits, n, z, e, n * size[type], flags, softfloat_exceptionFlags);
+
+		softfloat_exceptionFlags = 0;
+		fixed_to_f32_array(type, fracBits, fix, z32, n);
+		flags = softfloat_exceptionFlags;
+		softfloat_exceptionFlags = 0;
+		fixed_to_f64_array(type, fracBits, fix, a64, n);
+		for (i = 0; i < n; ++i)
+			e32[i] = f64_to_f32(a64[i]);
+		check("fixed_to_f32_array", type, fracBits, n, z32, e32, n * sizeof(float32_t), flags, softfloat_exceptionFlags);
+
+		softfloat_exceptionFlags = 0;
+		fixed_to_f16_array(type, fracBits, fix, z16, n);
+		flags = softfloat_exceptionFlags;
+		softfloat_exceptionFlags = 0;
+		fixed_to_f64_array(type, fracBits, fix, a64, n);
+		for (i = 0; i < n; ++i)
+			e16[i] = f64_to_f16(a64[i]);
+		check("fixed_to_f16_array", type, fracBits, n, z16, e16, n * sizeof(float16_t), flags, softfloat_exceptionFlags);
+	}
+
+	if (failures)
+		return 1;
+	printf("test_fixed_array: all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,65 @@
+#include "flexfloat.h"
+#include <stdio.h>
+
+/*
+ * Round-to-nearest-even results of the flexfloat operations in <11, 51>, one
+ * bit narrower than binary64. A binary64 result rounded to nearest and then
+ * rounded again to this format is wrong in each of these cases.
+ *
+ * To compile:
+ * gcc test_flexfloat_51.c -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -lm -o test_flexfloat_51
+ */
+
+static const flexfloat_desc_t desc51 = { 11, 51 };
+static int failures = 0;
+
+static void check(const char *what, const flexfloat_t *z, double expected)
+{
+	double got = ff_get_double(z);
+
+	if (got != expected) {
+		printf("FAIL: %s = %a, expected %a\n", what, got, expected);
+		++failures;
+	}
+}
+
+int main(void)
+{
+	flexfloat_t a, b, c, z;
+
+	softfloat_roundingMode = softfloat_round_near_even;
+	ff_init(&z, desc51);
+
+	ff_init_double(&a, 0x1.2126817e884fcp-1, desc51);
+	ff_init_double(&b, 0x1.855d6312746f4p-7, desc51);
+	ff_mul(&z, &a, &b);
+	check("ff_mul", &z, 0x1.b7c8fda90c64ep-8);
+
+	ff_init_double(&a, 0x1.d0edb1eda0ab0p-3, desc51);
+	ff_init_double(&b, -0x1.923a729c77f22p-48, desc51);
+	ff_add(&z, &a, &b);
+	check("ff_add", &z, 0x1.d0edb1eda09e6p-3);
+	ff_init_double(&b, 0x1.923a729c77f22p-48, desc51);
+	ff_sub(&z, &a, &b);
+	check("ff_sub", &z, 0x1.d0edb1eda09e6p-3);
+
+	ff_init_double(&a, -0x1.b1feeae248484p+3, desc51);
+	ff_init_double(&b, 0x1.cc01128e80636p+6, desc51);
+	ff_div(&z, &a, &b);
+	check("ff_div", &z, -0x1.e30d4063e431ep-4);
+
+	ff_init_double(&a, -0x1.3f63b7a0ac3ccp+4, desc51);
+	ff_init_double(&b, 0x1.df159d568efa4p+7, desc51);
+	ff_init_double(&c, -0x1.72fde552df634p+4, desc51);
+	ff_fma(&z, &a, &b, &c);
+	check("ff_fma", &z, -0x1.2c4e43ed3ed8ap+12);
+
+	ff_init_double(&a, 0x1.230d9c44ae2b2p+5, desc51);
+	ff_sqrt(&z, &a);
+	check("ff_sqrt", &z, 0x1.8207b32b22046p+2);
+
+	if (failures)
+		return 1;
+	printf("test_flexfloat_51: all checks passed\n");
+	return 0;
+}
@@ -0,0 +1,59 @@
+#include "flexfloat.hpp"
+#include <stdio.h>
+
+/*
+ * flexfloat<E, M> results in the current rounding mode for the formats at
+ * the edges of the backends: binary32 itself, which takes the float backend,
+ * and <11, 51>, one bit narrower than binary64.
+ *
+ * To compile:
+ * g++ test_flexfloat_rounding.cpp -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -o test_flexfloat_rounding
+ */
+
+static int failures = 0;
+
+static void check(double got, double expected, const char *what)
+{
+    if (got != expected) {
+        printf("FAIL: %s = %a, expected %a\n", what, got, expected);
+        ++failures;
+    }
+}
+
+int main()
+{
+    typedef flexfloat<8, 23> binary32;
+    typedef flexfloat<11, 51> narrow64;
+
+    const binary32 one(1.0f), tiny(0x1p-30f);
+    const uint_fast8_t modes[] = {
+        softfloat_round_near_even, softfloat_round_minMag, softfloat_round_min,
+        softfloat_round_max, softfloat_round_near_maxMag
+    };
+    const double sums[] = { 0x1p+0, 0x1p+0, 0x1p+0, 0x1.000002p+0, 0x1p+0 };
+    const double differences[] = { 0x1p+0, 0x1.fffffep-1, 0x1.fffffep-1, 0x1p+0, 0x1p+0 };
+
+    for (int i = 0; i < 5; ++i) {
+        softfloat_roundingMode = modes[i];
+        check(double(one + tiny), sums[i], "flexfloat<8, 23> 1 + 2^-30");
+        check(double(one - tiny), differences[i], "flexfloat<8, 23> 1 - 2^-30");
+        check(double(one * binary32(1.0f + 0x1p-23f) * binary32(1.0f + 0x1p-23f)),
+            (modes[i] == softfloat_round_max) ? 0x1.000006p+0 : 0x1.000004p+0,
+            "flexfloat<8, 23> (1 + 2^-23)^2");
+    }
+
+    softfloat_roundingMode = softfloat_round_near_even;
+    check(double(narrow64(0x1.2126817e884fcp-1) * narrow64(0x1.855d6312746f4p-7)),
+        0x1.b7c8fda90c64ep-8, "flexfloat<11, 51> product");
+    check(double(narrow64(0x1.d0edb1eda0ab0p-3) - narrow64(0x1.923a729c77f22p-48)),
+        0x1.d0edb1eda09e6p-3, "flexfloat<11, 51> difference");
+    check(double(narrow64(-0x1.b1feeae248484p+3) / narrow64(0x1.cc01128e80636p+6)),
+        -0x1.e30d4063e431ep-4, "flexfloat<11, 51> quotient");
+    check(double(sqrt(narrow64(0x1.230d9c44ae2b2p+5))),
+        0x1.8207b32b22046p+2, "flexfloat<11, 51> square root");
+
+    if (failures)
+        return 1;
+    printf("test_flexfloat_rounding: all checks passed\n");
+    return 0;
+}
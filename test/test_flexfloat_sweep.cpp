@@ -0,0 +1,43 @@
+#include "flexfloat_sweep.hpp"
+#include <stdio.h>
+
+/*
+ * A precision sweep runs its formats on worker threads. They must round in
+ * the caller's rounding mode, not in the default one of a new thread. That
+ * only differs when the library keeps its state per thread, as when built
+ * with -DTHREAD_LOCAL=_Thread_local (C) and -DTHREAD_LOCAL=thread_local (C++).
+ *
+ * To compile:
+ * g++ test_flexfloat_sweep.cpp -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -pthread -o test_flexfloat_sweep
+ */
+
+struct one_plus_tiny {
+    template <typename Tag> void operator()(Tag, std::vector<double> &out) const {
+        typedef typename Tag::type T;
+        out.assign(1, double(T(1.0) + T(0x1p-20)));
+    }
+};
+
+int main()
+{
+    typedef flexfloat_formats<flexfloat_format<5, 10>, flexfloat_format<8, 7>, flexfloat_format<6, 4> > formats;
+    int failures = 0;
+
+    softfloat_roundingMode = softfloat_round_max;
+    std::vector<flexfloat_sweep_result> res = flexfloat_sweep(one_plus_tiny(), formats(), 3);
+    softfloat_roundingMode = softfloat_round_near_even;
+
+    for (size_t i = 0; i < res.size(); ++i) {
+        // Rounded up to the next value above 1, against a reference of 1 + 2^-20
+        double expected = std::ldexp(1.0, -res[i].frac_bits) - 0x1p-20;
+        if (res[i].max_abs != expected) {
+            printf("FAIL: <%d, %d> error %a, expected %a\n", res[i].exp_bits, res[i].frac_bits, res[i].max_abs, expected);
+            ++failures;
+        }
+    }
+
+    if (failures)
+        return 1;
+    printf("test_flexfloat_sweep: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include "softfloat.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Stochastic rounding of a discarded part far below the rounding bits.  Each
+ * case counts how often the result rounds away from zero over N draws from a
+ * fixed seed; the count must stay within a factor of 4 of the exact
+ * probability times N (or below 8 when that product is below 1), where a
+ * sticky bit jammed below the rounding bits gives one in 2^7 to 2^16.
+ *
+ * To compile:
+ * gcc test_stochastic_rounding.c -I ../source/include/ ../build/Linux-386-GCC/softfloat.a -o test_stochastic_rounding
+ */
+
+#define N (1L << 22)
+
+static int failures = 0;
+
+static float32_t f32(float f)
+{
+	float32_t x;
+	memcpy(&x, &f, sizeof(x));
+	return x;
+}
+
+static float64_t f64(double d)
+{
+	float64_t x;
+	memcpy(&x, &d, sizeof(x));
+	return x;
+}
+
+static bfloat16_t bf16(float f)
+{
+	bfloat16_t x;
+	x.v = f32(f).v >> 16;
+	return x;
+}
+
+static void check(const char *what, long up, double expected)
+{
+	long lo = (long) (expected / 4), hi = (expected < 2.0) ? 8 : (long) (expected * 4);
+
+	if (up < lo || up > hi) {
+		printf("FAIL: %s rounded up %ld times in %ld, expected about %g\n", what, up, N, expected);
+		++failures;
+	}
+}
+
+int main(void)
+{
+	const float32_t one32 = f32(1.0f), sq = f32(1.0f + 0x1p-23f);
+	const float64_t one64 = f64(1.0);
+	const bfloat16_t one16 = bf16(1.0f);
+	long i, up;
+
+	softfloat_roundingMode = softfloat_round_stochastic;
+	softfloat_stochasticSeed = 1;
+	softfloat_stochasticCounter = 0;
+
+	for (i = 0, up = 0; i < N; ++i)
+		up += f32_add(one32, f32(0x1p-40f)).v != one32.v;
+	check("f32_add(1, 2^-40)", up, N * 0x1p-17);
+
+	for (i = 0, up = 0; i < N; ++i)
+		up += f32_mul(sq, sq).v != f32(1.0f + 0x1p-22f).v;
+	check("f32_mul(1 + 2^-23, 1 + 2^-23)", up, N * 0x1p-23);
+
+	for (i = 0, up = 0; i < N; ++i)
+		up += f64_add(one64, f64(0x1p-64)).v != one64.v;
+	check("f64_add(1, 2^-64)", up, N * 0x1p-12);
+
+	for (i = 0, up = 0; i < N; ++i)
+		up += bf16_add(one16, bf16(0x1p-40f)).v != one16.v;
+	check("bf16_add(1, 2^-40)", up, N * 0x1p-33);
+
+	if (failures)
+		return 1;
+	printf("test_stochastic_rounding: all checks passed\n");
+	return 0;
+}